@@ -0,0 +1,174 @@
+##############################
+# Dependencies
+##############################
+
+find_package(Qt6 6.4 COMPONENTS Widgets Network REQUIRED)
+
+set(BENCHMARK_ENABLE_TESTING OFF)
+set(BENCHMARK_ENABLE_INSTALL OFF)
+FetchContent_Declare(
+    benchmark
+    GIT_REPOSITORY "https://github.com/google/benchmark.git"
+    GIT_TAG "v1.9.4"
+    GIT_SHALLOW ON
+    FIND_PACKAGE_ARGS)
+
+FetchContent_MakeAvailable(benchmark)
+
+
+##############################
+# General Settings
+##############################
+
+set(LOOT_SRC_BENCHMARKS_GUI_CPP_FILES
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/benchmarks/main.cpp")
+
+set(LOOT_SRC_BENCHMARKS_GUI_H_FILES
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/benchmarks/game_benchmarks.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/benchmarks/plugin_item_filter_model_benchmarks.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/benchmarks/qt_helpers_benchmarks.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/benchmarks/synthetic_game.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/test_helpers.h")
+
+source_group(TREE "${CMAKE_SOURCE_DIR}/src/tests"
+    PREFIX "Header Files"
+    FILES ${LOOT_SRC_BENCHMARKS_GUI_H_FILES})
+
+source_group(TREE "${CMAKE_SOURCE_DIR}/src/tests/gui"
+    PREFIX "Source Files"
+    FILES ${LOOT_SRC_BENCHMARKS_GUI_CPP_FILES})
+
+set(LOOT_GUI_BENCHMARKS_ALL_SOURCES
+    ${LOOT_SRC_BENCHMARKS_GUI_CPP_FILES}
+    ${LOOT_SRC_BENCHMARKS_GUI_H_FILES}
+    "${CMAKE_BINARY_DIR}/generated/version.cpp"
+    "${CMAKE_SOURCE_DIR}/resources/resources.qrc"
+    "${CMAKE_SOURCE_DIR}/src/gui/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/counters.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/general_info.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/icon_factory.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_item_filter_model.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_item_model.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/common.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/detail.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/epic_games_store.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/generic.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/gog.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/heroic.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/microsoft_store.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/registry.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/steam.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/store_cache.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_id.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_settings.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/userlist_writer.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/validation.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/logging.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/translate.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/counters.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/filters_states.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/general_info.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/icon_factory.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_item_filter_model.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/plugin_item_model.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/store_cache.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_settings.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/userlist_writer.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/logging.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.h")
+
+##############################
+# Define Targets
+##############################
+
+# Build application benchmarks.
+add_executable(loot_gui_benchmarks ${LOOT_GUI_BENCHMARKS_ALL_SOURCES})
+add_dependencies(loot_gui_benchmarks ValveFileVDF)
+target_link_libraries(loot_gui_benchmarks PRIVATE
+    Qt::Widgets Qt::Network Qt::Concurrent
+    Boost::headers Boost::locale
+    benchmark::benchmark
+    fmt::fmt
+    libloot::libloot
+    spdlog::spdlog
+    tomlplusplus::tomlplusplus
+    ValveFileVDF::ValveFileVDF)
+
+##############################
+# Set Target-Specific Flags
+##############################
+
+if(TARGET MINIZIP::minizip)
+    target_link_libraries(loot_gui_benchmarks PRIVATE MINIZIP::minizip)
+elseif(TARGET MINIZIP::minizip-ng)
+    target_link_libraries(loot_gui_benchmarks PRIVATE MINIZIP::minizip-ng)
+endif()
+
+target_include_directories(loot_gui_benchmarks PRIVATE "${CMAKE_SOURCE_DIR}/src")
+target_include_directories(loot_gui_benchmarks SYSTEM PRIVATE
+    ${VALVE_FILE_VDF_INCLUDE_DIRS})
+
+set_target_properties(loot_gui_benchmarks PROPERTIES
+        CXX_STANDARD 17
+        CXX_STANDARD_REQUIRED ON
+        AUTOMOC ON
+        AUTORCC ON
+        AUTOUIC ON)
+
+if(WIN32)
+    target_compile_definitions(loot_gui_benchmarks PRIVATE
+        UNICODE _UNICODE NOMINMAX BOOST_UUID_FORCE_AUTO_LINK)
+
+    if(CMAKE_HOST_LINUX)
+        target_compile_definitions(loot_gui_benchmarks PRIVATE LOOT_STATIC)
+
+        target_link_libraries(loot_gui_benchmarks PRIVATE BZip2::BZip2)
+    endif()
+else()
+    target_link_libraries(loot_gui_benchmarks PRIVATE ${ICU_TARGETS})
+endif()
+
+if(MSVC)
+    target_compile_options(loot_gui_benchmarks PRIVATE
+        "/permissive-" "/W4" "/bigobj" "/MP")
+endif()
+
+##############################
+# Post-Build Steps
+##############################
+
+if(WIN32 AND CMAKE_HOST_WIN32)
+    # Copy Qt binaries and resources.
+    add_custom_command(TARGET loot_gui_benchmarks POST_BUILD
+        COMMAND "${QT_DIR}/bin/windeployqt" "$<TARGET_FILE:loot_gui_benchmarks>"
+        COMMENT "Running windeployqt..."
+        VERBATIM)
+endif()
+
+# Copy the API binary to the build directory.
+add_custom_command(TARGET loot_gui_benchmarks POST_BUILD
+   COMMAND "${CMAKE_COMMAND}" -E copy_if_different
+       "$<TARGET_FILE:libloot::libloot>"
+       "$<TARGET_FILE_DIR:loot_gui_benchmarks>/$<TARGET_FILE_NAME:libloot::libloot>"
+    VERBATIM)
+
+if(LINUX)
+    add_custom_command(TARGET loot_gui_benchmarks POST_BUILD
+        COMMAND "${CMAKE_COMMAND}" -E copy_if_different
+            "$<TARGET_SONAME_FILE:libloot::libloot>"
+            "$<TARGET_FILE_DIR:loot_gui_benchmarks>/$<TARGET_SONAME_FILE_NAME:libloot::libloot>"
+        VERBATIM)
+endif()
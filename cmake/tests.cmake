@@ -38,6 +38,7 @@ set(LOOT_SRC_TESTS_GUI_H_FILES
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/heroic_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/microsoft_store_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/steam_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/store_cache_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection/test_registry.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/detection_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/game_test.h"
@@ -45,11 +46,16 @@ set(LOOT_SRC_TESTS_GUI_H_FILES
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/games_manager_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/group_node_positions_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/helpers_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/game/userlist_writer_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/loot_paths_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/state/loot_settings_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/state/tracing_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/completion_model_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/groups_editor/graph_layout_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/helpers_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/non_blocking_test_task.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/tasks_test.h"
+    "${CMAKE_SOURCE_DIR}/src/tests/gui/qt/tasks/update_masterlist_task_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/backup_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/helpers_test.h"
     "${CMAKE_SOURCE_DIR}/src/tests/gui/sourced_message_test.h"
@@ -73,8 +79,13 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/helpers.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/completion_model.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/groups_editor/graph_layout.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_session.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_task.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/tasks.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/update_masterlist_task.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/common.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/detail.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/epic_games_store.cpp"
@@ -84,6 +95,7 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/microsoft_store.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/registry.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/steam.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/store_cache.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_id.cpp"
@@ -91,18 +103,26 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/games_manager.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/group_node_positions.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/helpers.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/userlist_writer.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/validation.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/logging.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_paths.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_settings.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_state.cpp"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/translate.cpp"
     "${CMAKE_SOURCE_DIR}/src/gui/backup.h"
     "${CMAKE_SOURCE_DIR}/src/gui/helpers.h"
     "${CMAKE_SOURCE_DIR}/src/gui/plugin_item.h"
     "${CMAKE_SOURCE_DIR}/src/gui/sourced_message.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/completion_model.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/groups_editor/graph_layout.h"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_session.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/network_task.h"
     "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/tasks.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/qt/tasks/update_masterlist_task.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/cancellation_token.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/change_count.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/common.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/detail.h"
@@ -114,17 +134,21 @@ set(LOOT_GUI_TESTS_ALL_SOURCES
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/microsoft_store.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/registry.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/steam.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection/store_cache.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/detection.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_id.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_settings.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/game_snapshot.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/games_manager.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/group_node_positions.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/helpers.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/game/userlist_writer.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/game/validation.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_paths.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_settings.h"
     "${CMAKE_SOURCE_DIR}/src/gui/state/loot_state.h"
+    "${CMAKE_SOURCE_DIR}/src/gui/state/tracing.h"
     "${CMAKE_SOURCE_DIR}/src/gui/translate.h")
 
 ##############################
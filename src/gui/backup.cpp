@@ -26,73 +26,183 @@
 #include "gui/backup.h"
 
 #include <mz.h>
+#include <mz_crypt.h>
+#include <mz_os.h>
 #include <mz_strm.h>
+#include <mz_strm_mem.h>
+#include <mz_strm_zlib.h>
 #include <mz_zip.h>
 #include <mz_zip_rw.h>
 
+#include <algorithm>
+#include <condition_variable>
 #include <cstdint>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
 
 #include "gui/state/logging.h"
 
-namespace loot {
-std::filesystem::path compressDirectory(const std::filesystem::path& dir) {
-  std::filesystem::path archivePath = dir;
-  archivePath += ".zip";
+namespace {
+using loot::getLogger;
 
-  auto archivePathString = archivePath.u8string();
-  auto rootPathString = dir.u8string();
+// Compressed files are held in memory until they can be written in order, so
+// limit how far ahead of the writer the compressing threads can get.
+constexpr size_t FILES_IN_FLIGHT_PER_THREAD = 2;
+constexpr size_t MAX_COMPRESSION_THREADS = 8;
+constexpr std::streamsize READ_CHUNK_SIZE = 1024 * 1024;
 
-  auto zipWriter = mz_zip_writer_create();
+struct CompressedFile {
+  std::string data;
+  uint32_t crc{0};
+  int64_t uncompressedSize{0};
+  time_t modifiedDate{0};
+};
 
-  mz_zip_writer_set_compress_method(zipWriter, MZ_COMPRESS_METHOD_DEFLATE);
+void checkResult(int32_t result, const std::string& message) {
+  if (result == MZ_OK) {
+    return;
+  }
 
-  auto result =
-      mz_zip_writer_open_file(zipWriter, archivePathString.c_str(), 0, 0);
-  if (result != MZ_OK) {
-    mz_zip_writer_delete(&zipWriter);
+  auto logger = getLogger();
+  if (logger) {
+    logger->error("{}, got error code {}", message, result);
+  }
 
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to open zip file at {}, got error code {}",
-                    archivePathString,
-                    result);
+  throw std::runtime_error(message);
+}
+
+class DeflateStream {
+public:
+  DeflateStream() :
+      memStream(mz_stream_mem_create()), zlibStream(mz_stream_zlib_create()) {
+    try {
+      checkResult(mz_stream_mem_open(memStream,
+                                     nullptr,
+                                     MZ_OPEN_MODE_CREATE | MZ_OPEN_MODE_WRITE),
+                  "Failed to open memory stream");
+      checkResult(mz_stream_set_base(zlibStream, memStream),
+                  "Failed to set deflate stream base");
+      checkResult(mz_stream_open(zlibStream, nullptr, MZ_OPEN_MODE_WRITE),
+                  "Failed to open deflate stream");
+    } catch (...) {
+      deleteStreams();
+      throw;
     }
+  }
 
-    throw std::runtime_error("Failed to open zip file for writing");
+  DeflateStream(const DeflateStream&) = delete;
+  DeflateStream(DeflateStream&&) = delete;
+
+  ~DeflateStream() { deleteStreams(); }
+
+  DeflateStream& operator=(const DeflateStream&) = delete;
+  DeflateStream& operator=(DeflateStream&&) = delete;
+
+  void write(const char* data, int32_t size) {
+    if (mz_stream_write(zlibStream, data, size) != size) {
+      throw std::runtime_error("Failed to write to deflate stream");
+    }
   }
 
-  result = mz_zip_writer_add_path(
-      zipWriter, rootPathString.c_str(), rootPathString.c_str(), 0, 1);
+  std::string finish() {
+    checkResult(mz_stream_close(zlibStream), "Failed to close deflate stream");
 
-  if (result != MZ_OK) {
-    mz_zip_writer_close(zipWriter);
-    mz_zip_writer_delete(&zipWriter);
+    const void* buffer = nullptr;
+    int32_t length = 0;
+    mz_stream_mem_get_buffer(memStream, &buffer);
+    mz_stream_mem_get_buffer_length(memStream, &length);
 
-    auto logger = getLogger();
-    if (logger) {
-      logger->error("Failed to add path {} to zip file, got error code {}",
-                    rootPathString,
-                    result);
+    return std::string(static_cast<const char*>(buffer),
+                       static_cast<size_t>(length));
+  }
+
+private:
+  void* memStream;
+  void* zlibStream;
+
+  void deleteStreams() {
+    mz_stream_zlib_delete(&zlibStream);
+    mz_stream_mem_delete(&memStream);
+  }
+};
+
+CompressedFile compressFile(const std::filesystem::path& path) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in.is_open()) {
+    throw std::runtime_error("Failed to open " + path.u8string());
+  }
+
+  CompressedFile file;
+  DeflateStream stream;
+  std::string buffer(READ_CHUNK_SIZE, '\0');
+
+  while (in) {
+    in.read(buffer.data(), READ_CHUNK_SIZE);
+    const auto bytesRead = static_cast<int32_t>(in.gcount());
+    if (bytesRead == 0) {
+      break;
     }
 
-    throw std::runtime_error("Failed to add path to zip file");
+    file.crc = mz_crypt_crc32_update(
+        file.crc, reinterpret_cast<const uint8_t*>(buffer.data()), bytesRead);
+    file.uncompressedSize += bytesRead;
+    stream.write(buffer.data(), bytesRead);
   }
 
-  mz_zip_writer_close(zipWriter);
-  mz_zip_writer_delete(&zipWriter);
+  if (in.bad()) {
+    throw std::runtime_error("Failed to read " + path.u8string());
+  }
 
-  return archivePath;
+  file.data = stream.finish();
+
+  time_t accessedDate = 0;
+  time_t creationDate = 0;
+  mz_os_get_file_date(path.u8string().c_str(),
+                      &file.modifiedDate,
+                      &accessedDate,
+                      &creationDate);
+
+  return file;
 }
 
-void createBackup(const std::filesystem::path& sourceDir,
-                  const std::filesystem::path& destDir) {
-  auto logger = getLogger();
-  if (logger) {
-    logger->trace("Creating backup of {} in {}",
-                  sourceDir.u8string(),
-                  destDir.u8string());
+void writeEntry(void* zipWriter,
+                const std::filesystem::path& relativePath,
+                const CompressedFile& file) {
+  const auto entryName = relativePath.generic_u8string();
+
+  mz_zip_file fileInfo{};
+  fileInfo.version_madeby = MZ_VERSION_MADEBY;
+  fileInfo.flag = MZ_ZIP_FLAG_UTF8;
+  fileInfo.compression_method = MZ_COMPRESS_METHOD_DEFLATE;
+  fileInfo.modified_date = file.modifiedDate;
+  fileInfo.crc = file.crc;
+  fileInfo.compressed_size = static_cast<int64_t>(file.data.size());
+  fileInfo.uncompressed_size = file.uncompressedSize;
+  fileInfo.filename = entryName.c_str();
+
+  checkResult(mz_zip_writer_entry_open(zipWriter, &fileInfo),
+              "Failed to open zip entry for " + entryName);
+
+  const auto size = static_cast<int32_t>(file.data.size());
+  if (mz_zip_writer_entry_write(zipWriter, file.data.data(), size) != size) {
+    throw std::runtime_error("Failed to write zip entry for " + entryName);
   }
 
+  checkResult(mz_zip_writer_entry_close(zipWriter),
+              "Failed to close zip entry for " + entryName);
+}
+}
+
+namespace loot {
+std::vector<std::filesystem::path> findFilesToBackup(
+    const std::filesystem::path& sourceDir) {
+  auto logger = getLogger();
+
+  std::vector<std::filesystem::path> relativePaths;
+
   for (auto it = std::filesystem::recursive_directory_iterator(sourceDir);
        it != std::filesystem::recursive_directory_iterator();
        ++it) {
@@ -111,7 +221,7 @@ void createBackup(const std::filesystem::path& sourceDir,
 
     if (!it->is_regular_file() ||
         (it.depth() == 0 && filename == "LOOTDebugLog.txt")) {
-      // Skip copying the debug log and anything that isn't a normal file.
+      // Skip the debug log and anything that isn't a normal file.
       if (logger) {
         logger->debug(
             "Skipping directory entry {} at depth {}", filename, it.depth());
@@ -119,16 +229,194 @@ void createBackup(const std::filesystem::path& sourceDir,
       continue;
     }
 
-    auto destPath = destDir / path.lexically_relative(sourceDir);
+    relativePaths.push_back(path.lexically_relative(sourceDir));
+  }
+
+  return relativePaths;
+}
+
+void compressFiles(const std::filesystem::path& sourceDir,
+                   const std::vector<std::filesystem::path>& relativePaths,
+                   const std::filesystem::path& archivePath,
+                   const BackupProgressCallback& progressCallback) {
+  const auto archivePathString = archivePath.u8string();
+
+  auto zipWriter = mz_zip_writer_create();
+
+  // Entries are compressed before they're given to the writer.
+  mz_zip_writer_set_compress_method(zipWriter, MZ_COMPRESS_METHOD_DEFLATE);
+  mz_zip_writer_set_raw(zipWriter, 1);
+
+  auto result =
+      mz_zip_writer_open_file(zipWriter, archivePathString.c_str(), 0, 0);
+  if (result != MZ_OK) {
+    mz_zip_writer_delete(&zipWriter);
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to open zip file at {}, got error code {}",
+                    archivePathString,
+                    result);
+    }
+
+    throw std::runtime_error("Failed to open zip file for writing");
+  }
+
+  const auto threadCount =
+      std::clamp(static_cast<size_t>(std::thread::hardware_concurrency()),
+                 size_t{1},
+                 MAX_COMPRESSION_THREADS);
+  const auto maxFilesInFlight = threadCount * FILES_IN_FLIGHT_PER_THREAD;
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  std::vector<std::optional<CompressedFile>> compressedFiles(
+      relativePaths.size());
+  size_t nextToCompress = 0;
+  size_t nextToWrite = 0;
+  bool stop = false;
+  std::exception_ptr exception;
+
+  const auto compressNextFiles = [&]() {
+    while (true) {
+      size_t index = 0;
+      {
+        std::unique_lock lock(mutex);
+        condition.wait(lock, [&]() {
+          return stop || nextToCompress >= relativePaths.size() ||
+                 nextToCompress < nextToWrite + maxFilesInFlight;
+        });
+
+        if (stop || nextToCompress >= relativePaths.size()) {
+          return;
+        }
+
+        index = nextToCompress;
+        nextToCompress += 1;
+      }
+
+      try {
+        auto file = compressFile(sourceDir / relativePaths.at(index));
+
+        std::lock_guard lock(mutex);
+        compressedFiles.at(index) = std::move(file);
+      } catch (...) {
+        std::lock_guard lock(mutex);
+        if (!exception) {
+          exception = std::current_exception();
+        }
+        stop = true;
+      }
+
+      condition.notify_all();
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < threadCount; i += 1) {
+    threads.emplace_back(compressNextFiles);
+  }
+
+  // Write entries in the order they were given so that the archive's
+  // content doesn't depend on thread scheduling.
+  try {
+    for (size_t i = 0; i < relativePaths.size(); i += 1) {
+      CompressedFile file;
+      {
+        std::unique_lock lock(mutex);
+        condition.wait(
+            lock, [&]() { return stop || compressedFiles.at(i).has_value(); });
 
-    std::filesystem::create_directories(destPath.parent_path());
+        if (!compressedFiles.at(i).has_value()) {
+          break;
+        }
 
-    std::filesystem::copy(path, destPath);
+        file = std::move(compressedFiles.at(i).value());
+        compressedFiles.at(i).reset();
+        nextToWrite = i + 1;
+      }
+
+      condition.notify_all();
+
+      writeEntry(zipWriter, relativePaths.at(i), file);
+
+      if (progressCallback) {
+        progressCallback(i + 1, relativePaths.size());
+      }
+    }
+  } catch (...) {
+    std::lock_guard lock(mutex);
+    if (!exception) {
+      exception = std::current_exception();
+    }
   }
 
+  {
+    std::lock_guard lock(mutex);
+    stop = true;
+  }
+  condition.notify_all();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  result = mz_zip_writer_close(zipWriter);
+  mz_zip_writer_delete(&zipWriter);
+
+  if (!exception && result != MZ_OK) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to close zip file at {}, got error code {}",
+                    archivePathString,
+                    result);
+    }
+
+    exception = std::make_exception_ptr(
+        std::runtime_error("Failed to finish writing zip file"));
+  }
+
+  if (exception) {
+    std::error_code errorCode;
+    std::filesystem::remove(archivePath, errorCode);
+
+    std::rethrow_exception(exception);
+  }
+}
+
+std::optional<std::filesystem::path> createBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& archivePath,
+    const BackupProgressCallback& progressCallback) {
+  auto logger = getLogger();
+  if (logger) {
+    logger->trace("Creating backup of {} in {}",
+                  sourceDir.u8string(),
+                  archivePath.u8string());
+  }
+
+  if (!std::filesystem::exists(sourceDir)) {
+    return std::nullopt;
+  }
+
+  const auto relativePaths = findFilesToBackup(sourceDir);
+  if (relativePaths.empty()) {
+    if (logger) {
+      logger->info("No files to back up in {}", sourceDir.u8string());
+    }
+    return std::nullopt;
+  }
+
+  std::filesystem::create_directories(archivePath.parent_path());
+
+  compressFiles(sourceDir, relativePaths, archivePath, progressCallback);
+
   if (logger) {
-    logger->info(
-        "Backup of {} created in {}", sourceDir.u8string(), destDir.u8string());
+    logger->info("Backup of {} created in {}",
+                 sourceDir.u8string(),
+                 archivePath.u8string());
   }
+
+  return archivePath;
 }
 }
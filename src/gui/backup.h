@@ -22,17 +22,38 @@
     along with LOOT.  If not, see
     <https://www.gnu.org/licenses/>.
     */
-
 #ifndef LOOT_GUI_BACKUP
 #define LOOT_GUI_BACKUP
 
 #include <filesystem>
+#include <functional>
+#include <optional>
+#include <vector>
 
 namespace loot {
-std::filesystem::path compressDirectory(const std::filesystem::path& dir);
-
-void createBackup(const std::filesystem::path& sourceDir,
-                  const std::filesystem::path& destDir);
+typedef std::function<void(size_t filesBackedUp, size_t totalFiles)>
+    BackupProgressCallback;
+
+// Get the paths, relative to sourceDir, of the files in sourceDir that should
+// be backed up. LOOT's debug log, its backups directory and any .git
+// directories are skipped.
+std::vector<std::filesystem::path> findFilesToBackup(
+    const std::filesystem::path& sourceDir);
+
+// Write the given files to a zip archive at archivePath. Files are compressed
+// in parallel and read directly from sourceDir. The progress callback is
+// called from the calling thread after each file is written.
+void compressFiles(const std::filesystem::path& sourceDir,
+                   const std::vector<std::filesystem::path>& relativePaths,
+                   const std::filesystem::path& archivePath,
+                   const BackupProgressCallback& progressCallback = {});
+
+// Back up the files in sourceDir to a zip archive at archivePath, returning
+// the archive's path, or nullopt if there was nothing to back up.
+std::optional<std::filesystem::path> createBackup(
+    const std::filesystem::path& sourceDir,
+    const std::filesystem::path& archivePath,
+    const BackupProgressCallback& progressCallback = {});
 }
 
 #endif
@@ -569,4 +569,28 @@ std::filesystem::path getLocalAppDataPath() {
 }
 
 std::string crcToString(uint32_t crc) { return fmt::format("{:08X}", crc); }
+
+void addToHash(QCryptographicHash& hash, std::string_view data) {
+  const auto size = static_cast<uint64_t>(data.size());
+  hash.addData(
+      QByteArrayView(reinterpret_cast<const char*>(&size), sizeof(size)));
+  hash.addData(
+      QByteArrayView(data.data(), static_cast<qsizetype>(data.size())));
+}
+
+void writeFileAtomically(const std::filesystem::path& path,
+                         std::string_view content) {
+  auto tempPath = path;
+  tempPath += ".tmp";
+
+  std::ofstream out(tempPath, std::ios::binary);
+  out.write(content.data(), static_cast<std::streamsize>(content.size()));
+  out.close();
+
+  if (out.fail()) {
+    throw std::runtime_error("Failed to write " + tempPath.u8string());
+  }
+
+  std::filesystem::rename(tempPath, path);
+}
 }
@@ -27,8 +27,10 @@
 
 #include <loot/enum/message_type.h>
 
+#include <QtCore/QCryptographicHash>
 #include <filesystem>
 #include <optional>
+#include <string_view>
 #include <vector>
 
 #include "gui/sourced_message.h"
@@ -60,5 +62,14 @@ std::filesystem::path getUserProfilePath();
 std::filesystem::path getLocalAppDataPath();
 
 std::string crcToString(uint32_t crc);
+
+// Add the data to the hash, prefixed with its size so that consecutive values
+// can't be confused with one another.
+void addToHash(QCryptographicHash& hash, std::string_view data);
+
+// Write to a temporary file and then replace the given file with it so that
+// the file is never left partially written.
+void writeFileAtomically(const std::filesystem::path& path,
+                         std::string_view content);
 }
 #endif
@@ -34,6 +34,7 @@
 #include "gui/helpers.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 
 namespace {
@@ -416,7 +417,11 @@ std::string PluginItem::getLoadOrderIndexText() const {
 std::vector<PluginItem> getPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
-    const std::string& language) {
+    const std::string& language,
+    const CancellationToken& cancellationToken,
+    const std::function<void(size_t, size_t)>& sendProgressUpdate) {
+  TraceSpan span("getPluginItems");
+
   const std::function<PluginItem(
       std::shared_ptr<const PluginInterface>, std::optional<short>, bool)>
       mapper = [&](std::shared_ptr<const PluginInterface> plugin,
@@ -430,6 +435,7 @@ std::vector<PluginItem> getPluginItems(
                           language);
       };
 
-  return mapFromLoadOrderData(game, pluginNames, mapper);
+  return mapFromLoadOrderData(
+      game, pluginNames, mapper, cancellationToken, sendProgressUpdate);
 }
 }
@@ -29,11 +29,13 @@
 #include <loot/metadata/group.h>
 #include <loot/plugin_interface.h>
 
+#include <functional>
 #include <optional>
 #include <regex>
 #include <string>
 
 #include "gui/sourced_message.h"
+#include "gui/state/cancellation_token.h"
 #include "gui/state/game/game.h"
 
 namespace loot {
@@ -90,7 +92,9 @@ struct PluginItem {
 std::vector<PluginItem> getPluginItems(
     const std::vector<std::string>& pluginNames,
     const gui::Game& game,
-    const std::string& language);
+    const std::string& language,
+    const CancellationToken& cancellationToken = CancellationToken(),
+    const std::function<void(size_t, size_t)>& sendProgressUpdate = nullptr);
 }
 
 #endif
@@ -62,6 +62,13 @@ void Card::paintEvent(QPaintEvent* event) {
 
   const auto cardRect = rect();
 
+  const auto shadowNearColor = shadowNearColor_.isValid()
+                                   ? shadowNearColor_
+                                   : palette().color(QPalette::Shadow);
+  const auto shadowFarColor = shadowFarColor_.isValid()
+                                  ? shadowFarColor_
+                                  : palette().color(QPalette::Window);
+
   if (paintTopShadow_) {
     // Draw top border shadow.
     painter.fillRect(
@@ -69,7 +76,7 @@ void Card::paintEvent(QPaintEvent* event) {
         0,
         cardRect.width(),
         CARD_TOP_SHADOW_HEIGHT,
-        GetCardTopBorderShadowBrush(shadowNearColor_, shadowFarColor_));
+        GetCardTopBorderShadowBrush(shadowNearColor, shadowFarColor));
   }
 
   // Draw bottom border shadow.
@@ -79,6 +86,6 @@ void Card::paintEvent(QPaintEvent* event) {
       0,
       cardRect.width(),
       CARD_BOTTOM_SHADOW_HEIGHT,
-      GetCardBottomBorderShadowBrush(shadowNearColor_, shadowFarColor_));
+      GetCardBottomBorderShadowBrush(shadowNearColor, shadowFarColor));
 }
 }
@@ -45,6 +45,7 @@ protected:
   void paintEvent(QPaintEvent* event) override;
 
 private:
+  // If these aren't set by a style sheet, colours from the palette are used.
   QColor shadowNearColor_;
   QColor shadowFarColor_;
   bool paintTopShadow_;
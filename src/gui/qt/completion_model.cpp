@@ -0,0 +1,129 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/completion_model.h"
+
+#include <algorithm>
+
+namespace {
+// Orders strings the same way as QCompleter expects for a case-insensitively
+// sorted model, breaking ties between strings that differ only in case so
+// that the order is stable.
+bool isLessThan(const QString& lhs, const QString& rhs) {
+  const auto result = QString::compare(lhs, rhs, Qt::CaseInsensitive);
+  if (result != 0) {
+    return result < 0;
+  }
+
+  return QString::compare(lhs, rhs, Qt::CaseSensitive) < 0;
+}
+}
+
+namespace loot {
+CompletionModel::CompletionModel(QObject* parent) :
+    QAbstractListModel(parent) {}
+
+void CompletionModel::setCompletions(
+    const std::vector<std::string>& newCompletions) {
+  std::vector<QString> sorted;
+  sorted.reserve(newCompletions.size());
+  for (const auto& completion : newCompletions) {
+    sorted.push_back(QString::fromStdString(completion));
+  }
+
+  std::sort(sorted.begin(), sorted.end(), isLessThan);
+  sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+  // Walk the current and new lists together, removing runs of rows that are
+  // no longer present and inserting runs of rows that are new.
+  size_t row = 0;
+  auto newIt = sorted.begin();
+  while (row < completions.size() || newIt != sorted.end()) {
+    if (newIt == sorted.end() ||
+        (row < completions.size() && isLessThan(completions[row], *newIt))) {
+      auto last = row + 1;
+      while (last < completions.size() &&
+             (newIt == sorted.end() || isLessThan(completions[last], *newIt))) {
+        last += 1;
+      }
+
+      beginRemoveRows(QModelIndex(), static_cast<int>(row),
+                      static_cast<int>(last - 1));
+      completions.erase(completions.begin() + row,
+                        completions.begin() + last);
+      endRemoveRows();
+    } else if (row == completions.size() ||
+               isLessThan(*newIt, completions[row])) {
+      auto runEnd = newIt + 1;
+      while (runEnd != sorted.end() &&
+             (row == completions.size() ||
+              isLessThan(*runEnd, completions[row]))) {
+        ++runEnd;
+      }
+
+      const auto count = static_cast<size_t>(std::distance(newIt, runEnd));
+      beginInsertRows(QModelIndex(), static_cast<int>(row),
+                      static_cast<int>(row + count - 1));
+      completions.insert(completions.begin() + row, newIt, runEnd);
+      endInsertRows();
+
+      row += count;
+      newIt = runEnd;
+    } else {
+      row += 1;
+      ++newIt;
+    }
+  }
+}
+
+QCompleter* CompletionModel::createCompleter(QObject* parent) {
+  auto completer = new QCompleter(this, parent);
+  completer->setCaseSensitivity(Qt::CaseInsensitive);
+  completer->setModelSorting(QCompleter::CaseInsensitivelySortedModel);
+
+  return completer;
+}
+
+int CompletionModel::rowCount(const QModelIndex& parent) const {
+  if (parent.isValid()) {
+    return 0;
+  }
+
+  return static_cast<int>(completions.size());
+}
+
+QVariant CompletionModel::data(const QModelIndex& index, int role) const {
+  if (!index.isValid() || index.row() < 0 ||
+      static_cast<size_t>(index.row()) >= completions.size()) {
+    return QVariant();
+  }
+
+  if (role == Qt::DisplayRole || role == Qt::EditRole) {
+    return completions.at(index.row());
+  }
+
+  return QVariant();
+}
+}
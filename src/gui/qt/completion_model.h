@@ -0,0 +1,61 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_COMPLETION_MODEL
+#define LOOT_GUI_QT_COMPLETION_MODEL
+
+#include <QtCore/QAbstractListModel>
+#include <QtWidgets/QCompleter>
+#include <string>
+#include <vector>
+
+namespace loot {
+// A list of completion strings that is kept sorted case-insensitively, so that
+// completers using it can find matches for a prefix using a binary search
+// instead of scanning every row.
+//
+// Setting the completions only inserts and removes the rows that changed, so
+// a single instance can be shared between widgets without them needing to
+// rebuild anything when the completions are updated.
+class CompletionModel : public QAbstractListModel {
+  Q_OBJECT
+public:
+  explicit CompletionModel(QObject* parent);
+
+  void setCompletions(const std::vector<std::string>& completions);
+
+  // Create a case-insensitive completer that uses this model.
+  QCompleter* createCompleter(QObject* parent);
+
+  int rowCount(const QModelIndex& parent = QModelIndex()) const override;
+
+  QVariant data(const QModelIndex& index, int role) const override;
+
+private:
+  std::vector<QString> completions;
+};
+}
+
+#endif
@@ -38,7 +38,14 @@ FiltersWidget::FiltersWidget(QWidget* parent) : QFrame(parent) { setupUi(); }
 void FiltersWidget::setGameId(const GameId newGameId) { gameId = newGameId; }
 
 void FiltersWidget::setPlugins(const std::vector<std::string>& pluginNames) {
+  // Raw data changes don't usually change which plugins are loaded, so only
+  // rebuild the list if they have.
+  if (pluginNames == overlapFilterPluginNames) {
+    return;
+  }
+
   setComboBoxItems(overlapFilter, pluginNames);
+  overlapFilterPluginNames = pluginNames;
 }
 
 void FiltersWidget::setGroups(const std::vector<std::string>& groupNames) {
@@ -62,6 +69,8 @@ void FiltersWidget::resetOverlapAndGroupsFilters() {
   emit pluginFilterChanged(getPluginFiltersState());
 }
 
+void FiltersWidget::resetOverlapFilter() { overlapFilter->setCurrentIndex(0); }
+
 void FiltersWidget::showCreationClubPluginsFilter(bool show) {
   creationClubPluginsFilter->setVisible(show);
 }
@@ -50,6 +50,7 @@ public:
   void setPluginCounts(size_t hidden, size_t total);
 
   void resetOverlapAndGroupsFilters();
+  void resetOverlapFilter();
 
   void showCreationClubPluginsFilter(bool show);
 
@@ -96,6 +97,8 @@ private:
 
   LootSettings::Filters warningsAndErrorFilterMemory;
   GameId gameId{GameId::tes3};
+  // The plugins listed by the overlap filter, in load order.
+  std::vector<std::string> overlapFilterPluginNames;
 
   void setupUi();
 
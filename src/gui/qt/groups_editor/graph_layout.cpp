@@ -0,0 +1,266 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2021    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/qt/groups_editor/graph_layout.h"
+
+#include <QtCore/QCryptographicHash>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "gui/helpers.h"
+
+namespace {
+template<typename T>
+void addValueToHash(QCryptographicHash &hash, T value) {
+  hash.addData(
+      QByteArrayView(reinterpret_cast<const char *>(&value), sizeof(value)));
+}
+
+bool overlaps(const QPointF &position1,
+              const QSizeF &size1,
+              const QPointF &position2,
+              const QSizeF &size2) {
+  const auto xDistance = std::abs(position1.x() - position2.x());
+  const auto yDistance = std::abs(position1.y() - position2.y());
+
+  return xDistance < (size1.width() + size2.width()) / 2 &&
+         yDistance < (size1.height() + size2.height()) / 2 + loot::NODE_SPACING;
+}
+
+// Moves the given position down until the node at the given index wouldn't
+// overlap any of the positioned nodes.
+QPointF findFreePosition(QPointF position,
+                         size_t index,
+                         const loot::GraphLayoutInput &input,
+                         const std::vector<std::optional<QPointF>> &positions) {
+  const auto &size = input.nodeSizes.at(index);
+
+  bool overlapFound = true;
+  while (overlapFound) {
+    overlapFound = false;
+    for (size_t i = 0; i < positions.size(); i += 1) {
+      if (positions[i].has_value() &&
+          overlaps(position, size, positions[i].value(), input.nodeSizes[i])) {
+        position.setY(position.y() + loot::NODE_SPACING);
+        overlapFound = true;
+        break;
+      }
+    }
+  }
+
+  return position;
+}
+}
+
+namespace loot {
+std::string getGraphLayoutKey(const GraphLayoutInput &input, LayoutMode mode) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+
+  addValueToHash(hash, mode);
+
+  for (const auto &name : input.nodeNames) {
+    addToHash(hash, name);
+  }
+
+  for (const auto &size : input.nodeSizes) {
+    addValueToHash(hash, size.width());
+    addValueToHash(hash, size.height());
+  }
+
+  addValueToHash(hash, input.edges.size());
+  for (const auto &[from, to] : input.edges) {
+    addValueToHash(hash, from);
+    addValueToHash(hash, to);
+  }
+
+  return hash.result().toHex().toStdString();
+}
+
+GraphLayout calculateIncrementalLayout(const GraphLayoutInput &input,
+                                       const GraphLayout &fixedLayout) {
+  if (input.nodeNames.size() != input.nodeSizes.size()) {
+    throw std::invalid_argument(
+        "Graph layout input has a different number of node names and sizes");
+  }
+
+  const auto nodeCount = input.nodeNames.size();
+
+  std::vector<std::optional<QPointF>> positions(nodeCount);
+  std::vector<size_t> unplacedNodes;
+  for (size_t i = 0; i < nodeCount; i += 1) {
+    const auto it = fixedLayout.find(input.nodeNames[i]);
+    if (it == fixedLayout.end()) {
+      unplacedNodes.push_back(i);
+    } else {
+      positions[i] = it->second;
+    }
+  }
+
+  std::vector<std::vector<size_t>> predecessors(nodeCount);
+  std::vector<std::vector<size_t>> successors(nodeCount);
+  for (const auto &[from, to] : input.edges) {
+    if (from >= nodeCount || to >= nodeCount) {
+      throw std::logic_error("Node is not in graph");
+    }
+
+    successors[from].push_back(to);
+    predecessors[to].push_back(from);
+  }
+
+  // Users may have rearranged the graph, so work out which way its edges
+  // generally point to know which side of its neighbours a node belongs on.
+  double flow = 0;
+  for (const auto &[from, to] : input.edges) {
+    if (positions[from].has_value() && positions[to].has_value()) {
+      flow += positions[to].value().x() - positions[from].value().x();
+    }
+  }
+  const double direction = flow < 0 ? -1.0 : 1.0;
+
+  // Returns the position past the furthest of the given neighbours in the
+  // given direction, level with their average height.
+  const auto besideNeighbours = [&](size_t index,
+                                    const std::vector<size_t> &neighbours,
+                                    double side) -> std::optional<QPointF> {
+    std::optional<double> furthestX;
+    double ySum = 0;
+    size_t placedCount = 0;
+    for (const auto neighbour : neighbours) {
+      if (!positions[neighbour].has_value()) {
+        continue;
+      }
+
+      const auto &position = positions[neighbour].value();
+      const auto x = position.x() +
+                     side * ((input.nodeSizes[neighbour].width() +
+                              input.nodeSizes[index].width()) /
+                                 2 +
+                             LAYER_SPACING);
+      if (!furthestX.has_value() || side * x > side * furthestX.value()) {
+        furthestX = x;
+      }
+
+      ySum += position.y();
+      placedCount += 1;
+    }
+
+    if (placedCount == 0) {
+      return std::nullopt;
+    }
+
+    return QPointF(furthestX.value(), ySum / placedCount);
+  };
+
+  GraphLayout layout;
+  const auto place = [&](size_t index, const QPointF &position) {
+    positions[index] = findFreePosition(position, index, input, positions);
+    layout.emplace(input.nodeNames[index], positions[index].value());
+  };
+
+  // Keep going until no more nodes can be placed next to their neighbours,
+  // so that chains of new nodes are placed one after another.
+  bool nodeWasPlaced = true;
+  while (nodeWasPlaced) {
+    nodeWasPlaced = false;
+
+    for (auto it = unplacedNodes.begin(); it != unplacedNodes.end();) {
+      auto position = besideNeighbours(*it, predecessors[*it], direction);
+      if (!position.has_value()) {
+        position = besideNeighbours(*it, successors[*it], -direction);
+      }
+
+      if (position.has_value()) {
+        place(*it, position.value());
+        it = unplacedNodes.erase(it);
+        nodeWasPlaced = true;
+      } else {
+        ++it;
+      }
+    }
+  }
+
+  if (unplacedNodes.empty()) {
+    return layout;
+  }
+
+  // The remaining nodes have no positioned neighbours, so put them in a column
+  // past the end of the graph.
+  std::optional<QPointF> columnPosition;
+  for (size_t i = 0; i < nodeCount; i += 1) {
+    if (!positions[i].has_value()) {
+      continue;
+    }
+
+    const auto x = positions[i].value().x() +
+                   direction * (input.nodeSizes[i].width() + LAYER_SPACING);
+    const auto y = positions[i].value().y();
+    if (!columnPosition.has_value()) {
+      columnPosition = QPointF(x, y);
+    } else {
+      if (direction * x > direction * columnPosition.value().x()) {
+        columnPosition.value().setX(x);
+      }
+      if (y < columnPosition.value().y()) {
+        columnPosition.value().setY(y);
+      }
+    }
+  }
+
+  for (const auto index : unplacedNodes) {
+    place(index, columnPosition.value_or(QPointF(0, 0)));
+  }
+
+  return layout;
+}
+
+std::optional<GraphLayout> GraphLayoutCache::find(
+    const std::string &key) const {
+  for (const auto &[entryKey, layout] : entries) {
+    if (entryKey == key) {
+      return layout;
+    }
+  }
+
+  return std::nullopt;
+}
+
+void GraphLayoutCache::insert(const std::string &key,
+                              const GraphLayout &layout) {
+  const auto it =
+      std::find_if(entries.begin(), entries.end(), [&](const auto &entry) {
+        return entry.first == key;
+      });
+  if (it != entries.end()) {
+    entries.erase(it);
+  }
+
+  entries.emplace_front(key, layout);
+
+  if (entries.size() > MAX_ENTRIES) {
+    entries.pop_back();
+  }
+}
+}
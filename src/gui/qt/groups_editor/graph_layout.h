@@ -0,0 +1,88 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2021    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QT_GROUPS_EDITOR_GRAPH_LAYOUT
+#define LOOT_GUI_QT_GROUPS_EDITOR_GRAPH_LAYOUT
+
+#include <QtCore/QPoint>
+#include <QtCore/QSizeF>
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace loot {
+constexpr qreal NODE_SPACING = 70;
+constexpr qreal LAYER_SPACING = 30.0;
+
+enum struct LayoutMode {
+  // Uses heuristics that are fast enough for interactive use, at the cost of
+  // longer edges.
+  Fast,
+  // Uses an LP-based ranking and coordinate assignment, which can take
+  // seconds for large graphs.
+  Optimal
+};
+
+// A copy of the graph's structure that doesn't reference any scene items, so
+// that it can be laid out off the UI thread. Nodes are sorted by name.
+struct GraphLayoutInput {
+  std::vector<std::string> nodeNames;
+  std::vector<QSizeF> nodeSizes;
+  // Pairs of indices into nodeNames, from the source to the destination node.
+  std::vector<std::pair<size_t, size_t>> edges;
+};
+
+// Node positions, keyed by node name.
+typedef std::map<std::string, QPointF> GraphLayout;
+
+// Returns a string that identifies the given input and mode, for use as a
+// layout cache key.
+std::string getGraphLayoutKey(const GraphLayoutInput& input, LayoutMode mode);
+
+// Returns positions for the nodes that aren't in fixedLayout, without moving
+// any of the nodes that are. Each new node is placed beside the nodes that it
+// shares edges with, and nodes with no positioned neighbours are placed beside
+// the rest of the graph.
+GraphLayout calculateIncrementalLayout(const GraphLayoutInput& input,
+                                       const GraphLayout& fixedLayout);
+
+// Holds the most recently calculated layouts so that they can be reused
+// without being recalculated.
+class GraphLayoutCache {
+public:
+  std::optional<GraphLayout> find(const std::string& key) const;
+  void insert(const std::string& key, const GraphLayout& layout);
+
+private:
+  static constexpr size_t MAX_ENTRIES = 8;
+
+  std::deque<std::pair<std::string, GraphLayout>> entries;
+};
+}
+
+#endif
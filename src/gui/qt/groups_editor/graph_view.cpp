@@ -27,22 +27,23 @@
 
 #include <math.h>
 
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtGui/QGuiApplication>
 #include <QtGui/QKeyEvent>
 #include <QtWidgets/QStyle>
 #include <set>
 
 #include "gui/qt/groups_editor/edge.h"
-#include "gui/qt/groups_editor/layout.h"
 #include "gui/qt/groups_editor/node.h"
 #include "gui/state/logging.h"
+#include "gui/state/tracing.h"
 
 namespace {
 using loot::Node;
 
-std::map<std::string, Node *>::iterator insertNode(
+std::unordered_map<std::string, Node *>::iterator insertNode(
     loot::GraphView *graphView,
-    std::map<std::string, Node *> &map,
+    std::unordered_map<std::string, Node *> &map,
     const std::string &name,
     bool isUserMetadata,
     bool containsInstalledPlugins) {
@@ -71,19 +72,23 @@ std::map<std::string, QPointF> convertNodePositions(
   return map;
 }
 
-void setNodePositions(const std::vector<Node *> &nodes,
-                      const std::map<std::string, QPointF> &savedPositions) {
+// Returns the positions that were set, which may not include all nodes.
+loot::GraphLayout setNodePositions(
+    const std::vector<Node *> &nodes,
+    const std::map<std::string, QPointF> &savedPositions) {
+  loot::GraphLayout setPositions;
+
   for (const auto node : nodes) {
     const auto name = node->getName().toStdString();
     const auto positionIt = savedPositions.find(name);
 
-    if (positionIt == savedPositions.end()) {
-      throw std::runtime_error(
-          "Failed to set node positions, could not find position for " + name);
-    } else {
+    if (positionIt != savedPositions.end()) {
       node->setPosition(positionIt->second);
+      setPositions.insert(*positionIt);
     }
   }
+
+  return setPositions;
 }
 }
 
@@ -118,22 +123,22 @@ void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
                           const std::set<std::string> &installedPluginGroups,
                           const std::vector<GroupNodePosition> &nodePositions) {
   // Remove all existing items.
+  cancelLayout();
   scene()->clear();
+  nodesByName.clear();
   hasUnsavedLayoutChanges_ = false;
 
   // Now add the given groups.
-  std::map<std::string, Node *> groupNameNodeMap;
-
   for (const auto &group : masterlistGroups) {
     auto name = group.GetName();
     const auto containsInstalledPlugins = installedPluginGroups.count(name) > 0;
-    insertNode(this, groupNameNodeMap, name, false, containsInstalledPlugins);
+    insertNode(this, nodesByName, name, false, containsInstalledPlugins);
   }
 
   for (const auto &group : userGroups) {
     auto name = group.GetName();
     const auto containsInstalledPlugins = installedPluginGroups.count(name) > 0;
-    insertNode(this, groupNameNodeMap, name, true, containsInstalledPlugins);
+    insertNode(this, nodesByName, name, true, containsInstalledPlugins);
   }
 
   // Now add edges to represent all the dependencies between groups.
@@ -141,11 +146,11 @@ void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
   // not, add it as a user group.
   for (const auto &group : masterlistGroups) {
     for (const auto &groupName : group.GetAfterGroups()) {
-      auto node = groupNameNodeMap.at(group.GetName());
+      auto node = nodesByName.at(group.GetName());
       const auto containsInstalledPlugins =
           installedPluginGroups.count(groupName) > 0;
       const auto it = insertNode(
-          this, groupNameNodeMap, groupName, true, containsInstalledPlugins);
+          this, nodesByName, groupName, true, containsInstalledPlugins);
 
       auto edge = new Edge(it->second, node, false);
       scene()->addItem(edge);
@@ -154,11 +159,11 @@ void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
 
   for (const auto &group : userGroups) {
     for (const auto &groupName : group.GetAfterGroups()) {
-      auto node = groupNameNodeMap.at(group.GetName());
+      auto node = nodesByName.at(group.GetName());
       const auto containsInstalledPlugins =
           installedPluginGroups.count(groupName) > 0;
       const auto it = insertNode(
-          this, groupNameNodeMap, groupName, true, containsInstalledPlugins);
+          this, nodesByName, groupName, true, containsInstalledPlugins);
 
       auto edge = new Edge(it->second, node, true);
       scene()->addItem(edge);
@@ -170,16 +175,11 @@ void GraphView::setGroups(const std::vector<Group> &masterlistGroups,
 }
 
 bool GraphView::addGroup(const std::string &name) {
-  auto qName = QString::fromStdString(name);
-
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (node && node->getName() == qName) {
-      return false;
-    }
+  if (findNode(name) != nullptr) {
+    return false;
   }
 
-  auto node = new Node(this, qName, true, false);
+  auto node = new Node(this, QString::fromStdString(name), true, false);
 
   auto pos = mapToScene(width() / 2, height() / 2);
   while (scene()->itemAt(pos, QTransform())) {
@@ -188,45 +188,47 @@ bool GraphView::addGroup(const std::string &name) {
   scene()->addItem(node);
   node->setPosition(pos);
 
+  nodesByName.emplace(name, node);
+
   return true;
 }
 
 void GraphView::renameGroup(const std::string &oldName,
                             const std::string &newName) {
-  auto qOldName = QString::fromStdString(oldName);
-
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (node && node->getName() == qOldName) {
-      node->setName(QString::fromStdString(newName));
-      return;
-    }
+  const auto it = nodesByName.find(oldName);
+  if (it == nodesByName.end()) {
+    return;
   }
+
+  const auto node = it->second;
+  node->setName(QString::fromStdString(newName));
+
+  nodesByName.erase(it);
+  nodesByName.insert_or_assign(newName, node);
 }
 
 void GraphView::setGroupContainsInstalledPlugins(
     const std::string &name,
     bool containsInstalledPlugins) {
-  const auto qName = QString::fromStdString(name);
+  const auto node = findNode(name);
+  if (node != nullptr) {
+    node->setContainsInstalledPlugins(containsInstalledPlugins);
+  }
+}
 
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (!node || node->getName() != qName) {
-      continue;
-    }
+void GraphView::autoLayout(LayoutMode mode) {
+  startLayout(getGraphLayoutInput(getNodes()), mode);
+}
 
-    node->setContainsInstalledPlugins(containsInstalledPlugins);
+void GraphView::cancelLayout() {
+  if (!layoutCancelled) {
     return;
   }
-}
 
-void GraphView::autoLayout() {
-  doLayout({});
+  *layoutCancelled = true;
+  layoutCancelled.reset();
 
-  // Reset unsaved change tracker because all user customisations have been
-  // removed (while the auto layout results can vary, they're all pretty
-  // similar and not worth counting as a user customisation).
-  hasUnsavedLayoutChanges_ = false;
+  emit layoutFinished();
 }
 
 void GraphView::registerUserLayoutChange() { hasUnsavedLayoutChanges_ = true; }
@@ -282,20 +284,19 @@ bool GraphView::hasUnsavedLayoutChanges() const {
   return hasUnsavedLayoutChanges_;
 }
 
-bool GraphView::isUserGroup(const std::string &name) const {
-  auto qName = QString::fromStdString(name);
+bool GraphView::isLayoutInProgress() const {
+  return layoutCancelled != nullptr;
+}
 
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (node && node->getName() == qName) {
-      return node->isUserMetadata();
-    }
-  }
+bool GraphView::isUserGroup(const std::string &name) const {
+  const auto node = findNode(name);
 
-  return false;
+  return node != nullptr && node->isUserMetadata();
 }
 
 void GraphView::handleGroupRemoved(const QString &name) {
+  nodesByName.erase(name.toStdString());
+
   emit groupRemoved(name);
 }
 
@@ -314,6 +315,17 @@ void GraphView::setBackgroundColor(QColor color) {
   setBackgroundBrush(QBrush(backgroundColor));
 }
 
+void GraphView::setColors(QColor master, QColor user, QColor background) {
+  masterColor = master;
+  userColor = user;
+  setBackgroundColor(background);
+
+  // Nodes pick up their colours when they're created, and the graph is
+  // rebuilt whenever the groups editor is opened, so only the existing items
+  // need repainting.
+  scene()->update();
+}
+
 #if QT_CONFIG(wheelevent)
 void GraphView::wheelEvent(QWheelEvent *event) {
   static constexpr double ROTATION_SCALING_FACTOR = 30.0 * 8.0;
@@ -340,28 +352,56 @@ void GraphView::wheelEvent(QWheelEvent *event) {
 }
 #endif
 
-void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
+std::vector<Node *> GraphView::getNodes() const {
   std::vector<Node *> nodes;
-  for (const auto item : scene()->items()) {
-    auto node = qgraphicsitem_cast<Node *>(item);
-    if (node) {
-      nodes.push_back(node);
-    }
+  nodes.reserve(nodesByName.size());
+  for (const auto &[name, node] : nodesByName) {
+    nodes.push_back(node);
   }
 
+  return nodes;
+}
+
+Node *GraphView::findNode(const std::string &name) const {
+  const auto it = nodesByName.find(name);
+  if (it == nodesByName.end()) {
+    return nullptr;
+  }
+
+  return it->second;
+}
+
+void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
+  const auto nodes = getNodes();
+
   const auto logger = getLogger();
 
   if (!nodePositions.empty()) {
     try {
       const auto nodePositionsMap = convertNodePositions(nodePositions);
 
-      setNodePositions(nodes, nodePositionsMap);
+      const auto savedLayout = setNodePositions(nodes, nodePositionsMap);
 
-      if (logger) {
-        logger->debug("Graph layout loaded from saved node positions");
-      }
+      if (!savedLayout.empty()) {
+        if (logger) {
+          logger->debug("Graph layout loaded from saved node positions");
+        }
 
-      return;
+        // Groups that were added since the positions were saved (e.g. by a
+        // masterlist update) are placed without moving any other groups.
+        if (savedLayout.size() < nodes.size()) {
+          if (logger) {
+            logger->debug("Placing {} groups that have no saved position",
+                          nodes.size() - savedLayout.size());
+          }
+
+          const auto newLayout = calculateIncrementalLayout(
+              getGraphLayoutInput(nodes), savedLayout);
+          setNodePositions(nodes, newLayout);
+        }
+
+        return;
+      }
     } catch (const std::exception &e) {
       if (logger) {
         logger->warn("Failed to set node positions from stored data: {}",
@@ -370,18 +410,91 @@ void GraphView::doLayout(const std::vector<GroupNodePosition> &nodePositions) {
     }
   }
 
-  if (logger) {
-    logger->debug("Calculating new graph layout");
+  const auto input = getGraphLayoutInput(nodes);
+
+  // Reuse an optimal layout if one has already been calculated, otherwise
+  // start with a fast layout so that the graph can be shown quickly.
+  const auto optimalLayout =
+      layoutCache.find(getGraphLayoutKey(input, LayoutMode::Optimal));
+  if (optimalLayout.has_value()) {
+    if (logger) {
+      logger->debug("Graph layout loaded from cache");
+    }
+
+    applyLayout(optimalLayout.value());
+    return;
   }
 
-  const auto calculatedNodePositions = calculateGraphLayout(nodes);
-  for (const auto &[node, position] : calculatedNodePositions) {
-    if (node == nullptr) {
-      throw std::logic_error(
-          "calculated node positions map contains a null node pointer");
+  startLayout(input, LayoutMode::Fast);
+}
+
+void GraphView::startLayout(const GraphLayoutInput &input, LayoutMode mode) {
+  cancelLayout();
+
+  const auto logger = getLogger();
+
+  const auto key = getGraphLayoutKey(input, mode);
+  const auto cachedLayout = layoutCache.find(key);
+  if (cachedLayout.has_value()) {
+    if (logger) {
+      logger->debug("Graph layout loaded from cache");
     }
 
-    node->setPosition(position);
+    applyLayout(cachedLayout.value());
+    return;
+  }
+
+  if (logger) {
+    logger->debug("Calculating new graph layout");
   }
+
+  const auto cancelled = std::make_shared<std::atomic<bool>>(false);
+  layoutCancelled = cancelled;
+
+  emit layoutStarted();
+
+  QtConcurrent::run([input, mode, cancelled]() {
+    TraceSpan span("calculateGraphLayout");
+
+    return calculateGraphLayout(input, mode, *cancelled);
+  })
+      .then(this,
+            [this, key, cancelled](const std::optional<GraphLayout> &layout) {
+              if (*cancelled || !layout.has_value()) {
+                return;
+              }
+
+              layoutCache.insert(key, layout.value());
+              layoutCancelled.reset();
+
+              applyLayout(layout.value());
+
+              emit layoutFinished();
+            })
+      .onFailed(this, [this, cancelled](const std::exception &e) {
+        if (*cancelled) {
+          return;
+        }
+
+        layoutCancelled.reset();
+
+        const auto logger = getLogger();
+        if (logger) {
+          logger->error("Failed to calculate graph layout: {}", e.what());
+        }
+
+        emit layoutFailed(QString::fromStdString(e.what()));
+      });
+}
+
+void GraphView::applyLayout(const GraphLayout &layout) {
+  // Groups may have been added or renamed while the layout was being
+  // calculated, so leave any nodes that aren't in the layout where they are.
+  setNodePositions(getNodes(), layout);
+
+  // Reset unsaved change tracker because all user customisations have been
+  // removed (while the auto layout results can vary, they're all pretty
+  // similar and not worth counting as a user customisation).
+  hasUnsavedLayoutChanges_ = false;
 }
 }
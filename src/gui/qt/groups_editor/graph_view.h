@@ -29,8 +29,12 @@
 #include <loot/metadata/group.h>
 
 #include <QtWidgets/QGraphicsView>
+#include <atomic>
+#include <memory>
 #include <set>
+#include <unordered_map>
 
+#include "gui/qt/groups_editor/layout.h"
 #include "gui/state/game/group_node_positions.h"
 
 namespace loot {
@@ -55,12 +59,17 @@ public:
   void renameGroup(const std::string &oldName, const std::string &newName);
   void setGroupContainsInstalledPlugins(const std::string &name,
                                         bool containsInstalledPlugins);
-  void autoLayout();
+  // Calculates the layout in the background, emitting layoutStarted() before
+  // and layoutFinished() or layoutFailed() after, unless a cached layout can
+  // be used.
+  void autoLayout(LayoutMode mode);
+  void cancelLayout();
   void registerUserLayoutChange();
 
   std::vector<Group> getUserGroups() const;
   std::vector<GroupNodePosition> getNodePositions() const;
   bool hasUnsavedLayoutChanges() const;
+  bool isLayoutInProgress() const;
   bool isUserGroup(const std::string &name) const;
 
   void handleGroupRemoved(const QString &name);
@@ -71,10 +80,14 @@ public:
   QColor getBackgroundColor() const;
 
   void setBackgroundColor(QColor color);
+  void setColors(QColor master, QColor user, QColor background);
 
 signals:
   void groupRemoved(const QString name);
   void groupSelected(const QString &name);
+  void layoutStarted();
+  void layoutFinished();
+  void layoutFailed(const QString &message);
 
 protected:
 #if QT_CONFIG(wheelevent)
@@ -88,8 +101,16 @@ private:
   QColor userColor;
   QColor backgroundColor;
   bool hasUnsavedLayoutChanges_{false};
+  std::unordered_map<std::string, Node *> nodesByName;
+  GraphLayoutCache layoutCache;
+  // Set to true to discard the result of the layout that's in progress.
+  std::shared_ptr<std::atomic<bool>> layoutCancelled;
 
+  std::vector<Node *> getNodes() const;
+  Node *findNode(const std::string &name) const;
   void doLayout(const std::vector<GroupNodePosition> &nodePositions);
+  void startLayout(const GraphLayoutInput &input, LayoutMode mode);
+  void applyLayout(const GraphLayout &layout);
 };
 }
 
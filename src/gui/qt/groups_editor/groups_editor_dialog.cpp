@@ -28,7 +28,6 @@
 #include <fmt/base.h>
 
 #include <QtWidgets/QCompleter>
-#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QFormLayout>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QMessageBox>
@@ -155,6 +154,13 @@ void GroupsEditorDialog::setGroups(
   initialNodePositions = nodePositions;
   selectedGroupName = std::nullopt;
   newPluginGroups.clear();
+  pluginIndicesByGroup = pluginItemModel->getPluginIndicesByGroup();
+}
+
+void GroupsEditorDialog::setGraphColors(QColor master,
+                                        QColor user,
+                                        QColor background) {
+  graphView->setColors(master, user, background);
 }
 
 std::vector<Group> loot::GroupsEditorDialog::getUserGroups() const {
@@ -224,11 +230,24 @@ void GroupsEditorDialog::setupUi() {
   renameGroupButton->setObjectName("renameGroupButton");
   renameGroupButton->setDisabled(true);
 
+  actionAutoArrangeFast->setObjectName("actionAutoArrangeFast");
+  actionAutoArrangeOptimal->setObjectName("actionAutoArrangeOptimal");
+  menuAutoArrange->addAction(actionAutoArrangeFast);
+  menuAutoArrange->addAction(actionAutoArrangeOptimal);
+
   autoArrangeButton->setObjectName("autoArrangeButton");
+  autoArrangeButton->setMenu(menuAutoArrange);
+
+  // Layout progress can't be measured, so show a busy indicator.
+  layoutProgressBar->setObjectName("layoutProgressBar");
+  layoutProgressBar->setRange(0, 0);
+  layoutProgressBar->setTextVisible(false);
+  layoutProgressBar->setVisible(false);
+
+  cancelLayoutButton->setObjectName("cancelLayoutButton");
+  cancelLayoutButton->setVisible(false);
 
-  auto buttonBox = new QDialogButtonBox(
-      QDialogButtonBox::Save | QDialogButtonBox::Cancel, this);
-  buttonBox->setObjectName("dialogButtons");
+  dialogButtons->setObjectName("dialogButtons");
 
   auto dialogLayout = new QVBoxLayout();
   auto mainLayout = new QHBoxLayout();
@@ -252,12 +271,14 @@ void GroupsEditorDialog::setupUi() {
   sidebarLayout->addLayout(formLayout);
   sidebarLayout->addWidget(divider2);
   sidebarLayout->addWidget(autoArrangeButton);
+  sidebarLayout->addWidget(layoutProgressBar);
+  sidebarLayout->addWidget(cancelLayoutButton);
 
   mainLayout->addWidget(graphView, 1);
   mainLayout->addLayout(sidebarLayout);
 
   dialogLayout->addLayout(mainLayout);
-  dialogLayout->addWidget(buttonBox);
+  dialogLayout->addWidget(dialogButtons);
 
   setLayout(dialogLayout);
 
@@ -286,6 +307,13 @@ void GroupsEditorDialog::translateUi() {
   addGroupButton->setText(qTranslate("Add a new group"));
   renameGroupButton->setText(qTranslate("Rename current group"));
   autoArrangeButton->setText(qTranslate("Auto arrange groups"));
+  /* translators: This string is an action in the Groups Editor's auto
+     arrange groups menu. */
+  actionAutoArrangeFast->setText(qTranslate("&Quick arrangement"));
+  /* translators: This string is an action in the Groups Editor's auto
+     arrange groups menu. */
+  actionAutoArrangeOptimal->setText(qTranslate("&Optimal arrangement (slow)"));
+  cancelLayoutButton->setText(qTranslate("Cancel arrangement"));
 }
 
 void GroupsEditorDialog::closeEvent(QCloseEvent* event) {
@@ -294,6 +322,8 @@ void GroupsEditorDialog::closeEvent(QCloseEvent* event) {
     return;
   }
 
+  graphView->cancelLayout();
+
   QDialog::closeEvent(event);
 }
 
@@ -368,17 +398,36 @@ void GroupsEditorDialog::refreshPluginLists() {
     defaultPluginsCheckBox->setChecked(false);
   }
 
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
+  const auto& plugins = pluginItemModel->getPluginItems();
+  static const std::set<size_t> NO_PLUGINS;
+  const auto groupIt = pluginIndicesByGroup.find(groupName);
+  const auto& groupPluginIndices =
+      groupIt == pluginIndicesByGroup.end() ? NO_PLUGINS : groupIt->second;
+
+  for (const auto index : groupPluginIndices) {
+    groupPluginsList->addItem(QString::fromStdString(plugins.at(index).name));
+  }
 
-    if (pluginGroup == groupName) {
-      groupPluginsList->addItem(QString::fromStdString(plugin.name));
-    } else if (!defaultPluginsCheckBox->isChecked() ||
-               pluginGroup == Group::DEFAULT_NAME) {
-      nonGroupPluginsList->addItem(QString::fromStdString(plugin.name));
+  const auto addNonGroupPlugin = [&](const PluginItem& plugin) {
+    nonGroupPluginsList->addItem(QString::fromStdString(plugin.name));
 
-      // Add plugins that aren't in the current group to the combo box.
-      pluginComboBox->addItem(QString::fromStdString(plugin.name));
+    // Add plugins that aren't in the current group to the combo box.
+    pluginComboBox->addItem(QString::fromStdString(plugin.name));
+  };
+
+  if (defaultPluginsCheckBox->isChecked()) {
+    const auto defaultIt =
+        pluginIndicesByGroup.find(std::string(Group::DEFAULT_NAME));
+    if (defaultIt != pluginIndicesByGroup.end()) {
+      for (const auto index : defaultIt->second) {
+        addNonGroupPlugin(plugins.at(index));
+      }
+    }
+  } else {
+    for (size_t i = 0; i < plugins.size(); i += 1) {
+      if (groupPluginIndices.count(i) == 0) {
+        addNonGroupPlugin(plugins[i]);
+      }
     }
   }
 
@@ -403,15 +452,16 @@ void GroupsEditorDialog::refreshPluginLists() {
   addPluginButton->setEnabled(false);
 }
 
-const PluginItem* GroupsEditorDialog::getPluginItem(
+std::optional<size_t> GroupsEditorDialog::findPluginIndex(
     const std::string& pluginName) const {
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    if (compareFilenames(plugin.name, pluginName) == 0) {
-      return &plugin;
+  const auto& plugins = pluginItemModel->getPluginItems();
+  for (size_t i = 0; i < plugins.size(); i += 1) {
+    if (compareFilenames(plugins[i].name, pluginName) == 0) {
+      return i;
     }
   }
 
-  return nullptr;
+  return std::nullopt;
 }
 
 const std::string GroupsEditorDialog::getPluginGroup(
@@ -425,21 +475,35 @@ const std::string GroupsEditorDialog::getPluginGroup(
 
 bool GroupsEditorDialog::containsMoreThanOnePlugin(
     const std::string& groupName) const {
-  size_t pluginsCount = 0;
+  const auto it = pluginIndicesByGroup.find(groupName);
 
-  for (const auto& plugin : pluginItemModel->getPluginItems()) {
-    const auto pluginGroup = getPluginGroup(plugin);
+  return it != pluginIndicesByGroup.end() && it->second.size() > 1;
+}
 
-    if (pluginGroup == groupName) {
-      if (pluginsCount == 1) {
-        return true;
-      }
+void GroupsEditorDialog::setPluginGroup(size_t pluginIndex,
+                                        const std::string& groupName) {
+  const auto& plugin = pluginItemModel->getPluginItems().at(pluginIndex);
 
-      pluginsCount += 1;
+  const auto it = pluginIndicesByGroup.find(getPluginGroup(plugin));
+  if (it != pluginIndicesByGroup.end()) {
+    it->second.erase(pluginIndex);
+    if (it->second.empty()) {
+      pluginIndicesByGroup.erase(it);
     }
   }
 
-  return false;
+  pluginIndicesByGroup[groupName].insert(pluginIndex);
+
+  // Check the group against the plugin's saved group and just remove
+  // the plugin from the map if the two are equal, to prevent moving a
+  // plugin to a new group and back again from being treated as an unsaved
+  // change.
+  if (plugin.group == groupName) {
+    newPluginGroups.erase(plugin.name);
+  } else {
+    // Store the plugin's new group.
+    newPluginGroups.insert_or_assign(plugin.name, groupName);
+  }
 }
 
 void GroupsEditorDialog::handleException(const std::exception& exception) {
@@ -464,19 +528,19 @@ void GroupsEditorDialog::setListTitles(const std::string& groupName) {
       fmt::format(translate("Plugins not in {0}"), groupName)));
 }
 
-std::vector<const PluginItem*> GroupsEditorDialog::getPluginsToAdd() const {
-  std::vector<const PluginItem*> pluginsToAdd;
+std::vector<size_t> GroupsEditorDialog::getPluginsToAdd() const {
+  std::vector<size_t> pluginsToAdd;
   for (const auto& listItem : nonGroupPluginsList->selectedItems()) {
-    const auto pluginItem = getPluginItem(listItem->text().toStdString());
-    if (pluginItem) {
-      pluginsToAdd.push_back(pluginItem);
+    const auto pluginIndex = findPluginIndex(listItem->text().toStdString());
+    if (pluginIndex.has_value()) {
+      pluginsToAdd.push_back(pluginIndex.value());
     }
   }
 
   const auto pluginName = pluginComboBox->currentText().toStdString();
-  const auto pluginItem = getPluginItem(pluginName);
-  if (pluginItem) {
-    pluginsToAdd.push_back(pluginItem);
+  const auto pluginIndex = findPluginIndex(pluginName);
+  if (pluginIndex.has_value()) {
+    pluginsToAdd.push_back(pluginIndex.value());
   }
 
   return pluginsToAdd;
@@ -585,7 +649,7 @@ void GroupsEditorDialog::on_pluginComboBox_editTextChanged(
         nonGroupPluginsList->selectedItems().isEmpty();
 
     const auto hasValidPluginName =
-        getPluginItem(text.toStdString()) != nullptr;
+        findPluginIndex(text.toStdString()).has_value();
 
     addPluginButton->setEnabled(!isSelectionEmpty || hasValidPluginName);
   } catch (const std::exception& e) {
@@ -620,24 +684,16 @@ void GroupsEditorDialog::on_addPluginButton_clicked() {
 
     const auto pluginsToAdd = getPluginsToAdd();
 
-    for (const auto pluginItem : pluginsToAdd) {
+    for (const auto pluginIndex : pluginsToAdd) {
       // Get the plugin's current group.
-      const auto currentPluginGroup = getPluginGroup(*pluginItem);
+      const auto currentPluginGroup =
+          getPluginGroup(pluginItemModel->getPluginItems().at(pluginIndex));
 
       // Count how many plugins are in the current group.
       const auto containsOtherPlugins =
           containsMoreThanOnePlugin(currentPluginGroup);
 
-      // Check the group against the plugin's saved group and just remove
-      // the plugin from the map if the two are equal, to prevent moving a
-      // plugin to a new group and back again from being treated as an unsaved
-      // change.
-      if (pluginItem->group == groupName) {
-        newPluginGroups.erase(pluginItem->name);
-      } else {
-        // Store the plugin's new group.
-        newPluginGroups.insert_or_assign(pluginItem->name, groupName);
-      }
+      setPluginGroup(pluginIndex, groupName);
 
       // Update whether or not the plugin's old group still contains any
       // plugins.
@@ -697,11 +753,12 @@ void GroupsEditorDialog::on_renameGroupButton_clicked() {
     graphView->renameGroup(oldName, newName);
 
     // Update plugin groups (step 3).
-    for (const auto& plugin : pluginItemModel->getPluginItems()) {
-      const auto pluginGroup = getPluginGroup(plugin);
-
-      if (pluginGroup == oldName) {
-        newPluginGroups.insert_or_assign(plugin.name, newName);
+    const auto oldGroupIt = pluginIndicesByGroup.find(oldName);
+    if (oldGroupIt != pluginIndicesByGroup.end()) {
+      // Copy the indices, as setPluginGroup() modifies the set.
+      const auto pluginIndices = oldGroupIt->second;
+      for (const auto pluginIndex : pluginIndices) {
+        setPluginGroup(pluginIndex, newName);
       }
     }
 
@@ -715,9 +772,45 @@ void GroupsEditorDialog::on_renameGroupButton_clicked() {
   }
 }
 
-void GroupsEditorDialog::on_autoArrangeButton_clicked() {
+void GroupsEditorDialog::on_graphView_layoutStarted() {
+  autoArrangeButton->setEnabled(false);
+  dialogButtons->button(QDialogButtonBox::Save)->setEnabled(false);
+  layoutProgressBar->setVisible(true);
+  cancelLayoutButton->setVisible(true);
+}
+
+void GroupsEditorDialog::on_graphView_layoutFinished() {
+  autoArrangeButton->setEnabled(true);
+  dialogButtons->button(QDialogButtonBox::Save)->setEnabled(true);
+  layoutProgressBar->setVisible(false);
+  cancelLayoutButton->setVisible(false);
+}
+
+void GroupsEditorDialog::on_graphView_layoutFailed(const QString& message) {
+  on_graphView_layoutFinished();
+
+  handleException(std::runtime_error(message.toStdString()));
+}
+
+void GroupsEditorDialog::on_actionAutoArrangeFast_triggered() {
+  try {
+    graphView->autoLayout(LayoutMode::Fast);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void GroupsEditorDialog::on_actionAutoArrangeOptimal_triggered() {
   try {
-    graphView->autoLayout();
+    graphView->autoLayout(LayoutMode::Optimal);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void GroupsEditorDialog::on_cancelLayoutButton_clicked() {
+  try {
+    graphView->cancelLayout();
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -737,6 +830,8 @@ void GroupsEditorDialog::on_dialogButtons_rejected() {
       return;
     }
 
+    graphView->cancelLayout();
+
     reject();
   } catch (const std::exception& e) {
     handleException(e);
@@ -30,10 +30,12 @@
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QDialog>
+#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QLineEdit>
 #include <QtWidgets/QListWidget>
 #include <QtWidgets/QMenu>
+#include <QtWidgets/QProgressBar>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QWidget>
 #include <set>
@@ -83,6 +85,8 @@ public:
                  const std::set<std::string> &installedPluginGroups,
                  const std::vector<GroupNodePosition> &nodePositions);
 
+  void setGraphColors(QColor master, QColor user, QColor background);
+
   std::vector<Group> getUserGroups() const;
   std::vector<GroupNodePosition> getNodePositions() const;
   std::unordered_map<std::string, std::string> getNewPluginGroups() const;
@@ -98,14 +102,22 @@ private:
   QPushButton *addPluginButton{new QPushButton(this)};
 
   QPushButton *autoArrangeButton{new QPushButton(this)};
+  QProgressBar *layoutProgressBar{new QProgressBar(this)};
+  QPushButton *cancelLayoutButton{new QPushButton(this)};
 
   QLabel *groupNameInputLabel{new QLabel(this)};
   QLineEdit *groupNameInput{new QLineEdit(this)};
   QPushButton *addGroupButton{new QPushButton(this)};
   QPushButton *renameGroupButton{new QPushButton(this)};
 
+  QDialogButtonBox *dialogButtons{new QDialogButtonBox(
+      QDialogButtonBox::Save | QDialogButtonBox::Cancel, this)};
+
   QAction *actionCopyPluginNames{new QAction(this)};
   QMenu *menuPluginsList{new QMenu(this)};
+  QAction *actionAutoArrangeFast{new QAction(this)};
+  QAction *actionAutoArrangeOptimal{new QAction(this)};
+  QMenu *menuAutoArrange{new QMenu(this)};
 
   PluginItemModel *pluginItemModel{nullptr};
 
@@ -113,6 +125,8 @@ private:
   std::vector<GroupNodePosition> initialNodePositions;
   std::optional<std::string> selectedGroupName;
   std::unordered_map<std::string, std::string> newPluginGroups;
+  // Includes the changes in newPluginGroups.
+  PluginIndicesByGroup pluginIndicesByGroup;
 
   void setupUi();
   void translateUi();
@@ -123,20 +137,24 @@ private:
   bool hasUnsavedChanges();
 
   void refreshPluginLists();
-  const PluginItem *getPluginItem(const std::string &pluginName) const;
+  std::optional<size_t> findPluginIndex(const std::string &pluginName) const;
   const std::string getPluginGroup(const PluginItem &pluginItem) const;
   bool containsMoreThanOnePlugin(const std::string &groupName) const;
+  void setPluginGroup(size_t pluginIndex, const std::string &groupName);
 
   void handleException(const std::exception &exception);
 
   void setListTitles(const std::string &groupName);
 
-  std::vector<const PluginItem *> getPluginsToAdd() const;
+  std::vector<size_t> getPluginsToAdd() const;
 
 private slots:
   void on_actionCopyPluginNames_triggered();
   void on_graphView_groupRemoved(const QString name);
   void on_graphView_groupSelected(const QString &name);
+  void on_graphView_layoutStarted();
+  void on_graphView_layoutFinished();
+  void on_graphView_layoutFailed(const QString &message);
   void on_groupPluginsList_customContextMenuRequested(const QPoint &position);
   void on_nonGroupPluginsList_itemSelectionChanged();
   void on_defaultPluginsCheckBox_checkStateChanged();
@@ -145,7 +163,9 @@ private slots:
   void on_addPluginButton_clicked();
   void on_addGroupButton_clicked();
   void on_renameGroupButton_clicked();
-  void on_autoArrangeButton_clicked();
+  void on_actionAutoArrangeFast_triggered();
+  void on_actionAutoArrangeOptimal_triggered();
+  void on_cancelLayoutButton_clicked();
   void on_dialogButtons_accepted();
   void on_dialogButtons_rejected();
 };
@@ -26,18 +26,77 @@
 #include "gui/qt/groups_editor/layout.h"
 
 #include <ogdf/basic/GraphAttributes.h>
+#include <ogdf/layered/FastHierarchyLayout.h>
+#include <ogdf/layered/LongestPathRanking.h>
 #include <ogdf/layered/MedianHeuristic.h>
 #include <ogdf/layered/OptimalHierarchyLayout.h>
 #include <ogdf/layered/OptimalRanking.h>
 #include <ogdf/layered/SugiyamaLayout.h>
 
+#include <algorithm>
+
 #include "gui/qt/groups_editor/edge.h"
 
 namespace loot {
-constexpr double LAYER_SPACING = 30.0;
+GraphLayoutInput getGraphLayoutInput(const std::vector<Node *> &nodes) {
+  for (const auto node : nodes) {
+    if (node == nullptr) {
+      throw std::invalid_argument("nodes vector contains a null pointer");
+    }
+  }
+
+  // Sort the nodes so that the input (and so the calculated layout) doesn't
+  // depend on the order in which the nodes are stored in the scene.
+  auto sortedNodes = nodes;
+  std::sort(sortedNodes.begin(),
+            sortedNodes.end(),
+            [](const Node *lhs, const Node *rhs) {
+              return lhs->getName() < rhs->getName();
+            });
+
+  GraphLayoutInput input;
+  std::map<const Node *, size_t> nodeIndices;
+  for (const auto node : sortedNodes) {
+    nodeIndices.emplace(node, input.nodeNames.size());
+
+    input.nodeNames.push_back(node->getName().toStdString());
+    input.nodeSizes.push_back(
+        node->boundingRect().marginsRemoved(Node::MARGINS).size());
+  }
+
+  for (const auto node : sortedNodes) {
+    const auto fromIndex = nodeIndices.at(node);
+
+    for (const auto outEdge : node->getOutEdges()) {
+      if (outEdge == nullptr) {
+        throw std::invalid_argument("nodes vector contains a null pointer");
+      }
+
+      const auto toIndex = nodeIndices.find(outEdge->getDestNode());
+      if (toIndex == nodeIndices.end()) {
+        throw std::logic_error("Node is not in graph");
+      }
+
+      input.edges.emplace_back(fromIndex, toIndex->second);
+    }
+  }
+
+  return input;
+}
+
+std::optional<GraphLayout> calculateGraphLayout(
+    const GraphLayoutInput &input,
+    LayoutMode mode,
+    const std::atomic<bool> &cancelled) {
+  if (input.nodeNames.size() != input.nodeSizes.size()) {
+    throw std::invalid_argument(
+        "Graph layout input has a different number of node names and sizes");
+  }
+
+  if (cancelled) {
+    return std::nullopt;
+  }
 
-std::map<Node *, QPointF> calculateGraphLayout(
-    const std::vector<Node *> &nodes) {
   ogdf::Graph graph;
   ogdf::GraphAttributes graphAttributes(
       graph,
@@ -49,81 +108,71 @@ std::map<Node *, QPointF> calculateGraphLayout(
 
   graphAttributes.directed() = true;
 
-  // Add all nodes to the graph.
-  std::map<Node *, ogdf::node> graphNodes;
-  std::map<ogdf::node, Node *> sceneNodes;
-  for (const auto node : nodes) {
-    if (node == nullptr) {
-      throw std::invalid_argument("nodes vector contains a null pointer");
-    }
-
+  std::vector<ogdf::node> graphNodes;
+  std::map<ogdf::node, size_t> nodeIndices;
+  for (size_t i = 0; i < input.nodeSizes.size(); i += 1) {
     const auto graphNode = graph.newNode();
-    const auto boundingRect =
-        node->boundingRect().marginsRemoved(Node::MARGINS);
 
     // The height and width are transposed because the layout algorithm
     // arranges layers vertically, and the result is then rotated to get a
     // horizontal layout.
-    graphAttributes.width(graphNode) = boundingRect.height();
-    graphAttributes.height(graphNode) = boundingRect.width();
+    graphAttributes.width(graphNode) = input.nodeSizes[i].height();
+    graphAttributes.height(graphNode) = input.nodeSizes[i].width();
 
-    graphNodes.emplace(node, graphNode);
-    sceneNodes.emplace(graphNode, node);
+    graphNodes.push_back(graphNode);
+    nodeIndices.emplace(graphNode, i);
   }
 
-  // Now add all edges to the graph, without having to worry if the nodes
-  // already exist or not.
-  for (const auto node : nodes) {
-    const auto fromGraphNode = graphNodes.find(node);
-    if (fromGraphNode == graphNodes.end()) {
+  for (const auto &[from, to] : input.edges) {
+    if (from >= graphNodes.size() || to >= graphNodes.size()) {
       throw std::logic_error("Node is not in graph");
     }
 
-    if (node == nullptr) {
-      throw std::invalid_argument("nodes vector contains a null pointer");
-    }
-
-    for (const auto outEdge : node->getOutEdges()) {
-      if (outEdge == nullptr) {
-        throw std::invalid_argument("nodes vector contains a null pointer");
-      }
-
-      const auto toGraphNode = graphNodes.find(outEdge->getDestNode());
-      if (toGraphNode == graphNodes.end()) {
-        throw std::logic_error("Node is not in graph");
-      }
-
-      graph.newEdge(fromGraphNode->second, toGraphNode->second);
-    }
+    graph.newEdge(graphNodes[from], graphNodes[to]);
   }
 
   ogdf::SugiyamaLayout SL;
-  SL.setRanking(new ogdf::OptimalRanking);
   SL.setCrossMin(new ogdf::MedianHeuristic);
 
-  ogdf::OptimalHierarchyLayout *ohl = new ogdf::OptimalHierarchyLayout;
-  ohl->layerDistance(LAYER_SPACING);
-  ohl->nodeDistance(NODE_SPACING);
-  SL.setLayout(ohl);
+  if (mode == LayoutMode::Fast) {
+    SL.setRanking(new ogdf::LongestPathRanking);
+    SL.runs(1);
+
+    ogdf::FastHierarchyLayout *fhl = new ogdf::FastHierarchyLayout;
+    fhl->layerDistance(LAYER_SPACING);
+    fhl->nodeDistance(NODE_SPACING);
+    SL.setLayout(fhl);
+  } else {
+    SL.setRanking(new ogdf::OptimalRanking);
+
+    ogdf::OptimalHierarchyLayout *ohl = new ogdf::OptimalHierarchyLayout;
+    ohl->layerDistance(LAYER_SPACING);
+    ohl->nodeDistance(NODE_SPACING);
+    SL.setLayout(ohl);
+  }
 
   SL.call(graphAttributes);
 
+  if (cancelled) {
+    return std::nullopt;
+  }
+
   // Now rotate the layout to get a layers arranged horizontally.
   graphAttributes.rotateLeft90();
 
-  std::map<Node *, QPointF> nodePositions;
+  GraphLayout layout;
 
   for (const auto node : graph.nodes) {
     QPointF position(graphAttributes.x(node), graphAttributes.y(node));
 
-    const auto sceneNode = sceneNodes.find(node);
-    if (sceneNode == sceneNodes.end()) {
+    const auto index = nodeIndices.find(node);
+    if (index == nodeIndices.end()) {
       throw std::logic_error("Node is not in scene");
     }
 
-    nodePositions.emplace(sceneNode->second, position);
+    layout.emplace(input.nodeNames.at(index->second), position);
   }
 
-  return nodePositions;
+  return layout;
 }
 }
@@ -26,16 +26,22 @@
 #ifndef LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT
 #define LOOT_GUI_QT_GROUPS_EDITOR_LAYOUT
 
-#include <QtCore/QPoint>
-#include <map>
+#include <atomic>
+#include <optional>
 #include <vector>
 
+#include "gui/qt/groups_editor/graph_layout.h"
 #include "gui/qt/groups_editor/node.h"
 
 namespace loot {
-constexpr qreal NODE_SPACING = 70;
-
-std::map<Node*, QPointF> calculateGraphLayout(const std::vector<Node*>& nodes);
+GraphLayoutInput getGraphLayoutInput(const std::vector<Node*>& nodes);
+
+// Returns std::nullopt if cancelled is set before the layout is complete. The
+// layout algorithms can't be interrupted, so it is only checked between them.
+std::optional<GraphLayout> calculateGraphLayout(
+    const GraphLayoutInput& input,
+    LayoutMode mode,
+    const std::atomic<bool>& cancelled);
 }
 
 #endif
@@ -42,20 +42,30 @@
 #include <QtGui/QPainter>
 #include <QtWidgets/QToolTip>
 #include <QtWidgets/QWidget>
+#include <cstring>
 #include <fstream>
+#include <sstream>
 
 #ifndef _WIN32
 #include <QtCore/QProcess>
 #endif
 
+#include "gui/helpers.h"
 #include "gui/state/logging.h"
 #include "gui/translate.h"
 
 namespace {
 using loot::getLogger;
+using loot::writeFileAtomically;
 
 static constexpr const char* METADATA_ID_KEY = "blob_sha1";
 static constexpr const char* METADATA_DATE_KEY = "update_timestamp";
+static constexpr const char* METADATA_ETAG_KEY = "etag";
+static constexpr const char* METADATA_LAST_MODIFIED_KEY = "last_modified";
+static constexpr const char* METADATA_SOURCE_URL_KEY = "source_url";
+static constexpr const char* METADATA_FILE_SIZE_KEY = "file_size";
+static constexpr const char* METADATA_FILE_TIME_KEY = "file_modified_time";
+static constexpr const char* METADATA_FILE_ID_KEY = "file_blob_sha1";
 static constexpr int SHORT_HASH_LENGTH = 7;
 
 std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
@@ -65,29 +75,274 @@ std::filesystem::path getFileMetadataPath(std::filesystem::path filePath) {
   return filePath;
 }
 
-void writeFileRevision(const std::filesystem::path& filePath,
-                       const std::string& id,
-                       const std::string& date) {
+int64_t getFileModifiedTime(const std::filesystem::path& filePath) {
+  return static_cast<int64_t>(
+      std::filesystem::last_write_time(filePath).time_since_epoch().count());
+}
+
+int64_t getFileSize(const std::filesystem::path& filePath) {
+  return static_cast<int64_t>(std::filesystem::file_size(filePath));
+}
+
+toml::table readFileMetadata(const std::filesystem::path& filePath) {
   auto metadataPath = getFileMetadataPath(filePath);
 
+  // Don't use toml::parse_file() as it just uses a std stream,
+  // which don't support UTF-8 paths on Windows.
+  std::ifstream in(metadataPath);
+  if (!in.is_open()) {
+    throw std::runtime_error(metadataPath.u8string() +
+                             " could not be opened for parsing");
+  }
+
+  return toml::parse(in, metadataPath.u8string());
+}
+
+void writeFileMetadata(const std::filesystem::path& filePath,
+                       const toml::table& table) {
+  auto metadataPath = getFileMetadataPath(filePath);
+
+  std::ostringstream content;
+  content << table;
+
+  // An interrupted write must not leave truncated metadata behind.
+  writeFileAtomically(metadataPath, content.str());
+}
+
+void writeFileRevision(const std::filesystem::path& filePath,
+                       const std::string& id,
+                       const std::string& date,
+                       const loot::HttpValidators& validators) {
   auto logger = getLogger();
   if (logger) {
     logger->info("Writing file revision info for {} with ID {} and date {}",
-                 metadataPath.u8string(),
+                 getFileMetadataPath(filePath).u8string(),
                  id,
                  date);
   }
 
-  const auto table =
-      toml::table{{METADATA_ID_KEY, id}, {METADATA_DATE_KEY, date}};
+  // The file's current content has the given blob hash, so record that along
+  // with the file's size and modification time, so that the file doesn't need
+  // to be hashed again until it changes.
+  auto table =
+      toml::table{{METADATA_ID_KEY, id},
+                  {METADATA_DATE_KEY, date},
+                  {METADATA_FILE_ID_KEY, id},
+                  {METADATA_FILE_SIZE_KEY, getFileSize(filePath)},
+                  {METADATA_FILE_TIME_KEY, getFileModifiedTime(filePath)}};
+
+  if (!validators.empty()) {
+    table.insert(METADATA_ETAG_KEY, validators.etag);
+    table.insert(METADATA_LAST_MODIFIED_KEY, validators.lastModified);
+    table.insert(METADATA_SOURCE_URL_KEY, validators.url);
+  }
 
-  std::ofstream out(metadataPath);
-  if (!out.is_open()) {
-    throw std::runtime_error(metadataPath.u8string() +
-                             " could not be opened for writing");
+  writeFileMetadata(filePath, table);
+}
+
+void addGitBlobHeader(QCryptographicHash& hasher, qsizetype contentSize) {
+  static constexpr QByteArrayView HEADER_PREFIX = QByteArrayView("blob ");
+
+  const auto sizeString = std::to_string(contentSize);
+
+  hasher.addData(HEADER_PREFIX);
+  // Include the null terminator.
+  hasher.addData(QByteArrayView(sizeString.c_str(),
+                                static_cast<qsizetype>(sizeString.size()) + 1));
+}
+
+// Read the file in fixed-size chunks from its current position, replacing CRLF
+// line endings with LF, and pass each chunk to the given function.
+template <typename F>
+void forEachNormalisedChunk(QFile& file, F consumeChunk) {
+  static constexpr qsizetype CHUNK_SIZE = 64 * 1024;
+  static constexpr QByteArrayView CARRIAGE_RETURN = QByteArrayView("\r");
+
+  QByteArray buffer(CHUNK_SIZE, Qt::Uninitialized);
+
+  // A CR at the end of a chunk can only be replaced once the next chunk has
+  // been read.
+  bool hasPendingCarriageReturn = false;
+
+  while (true) {
+    const auto bytesRead = file.read(buffer.data(), CHUNK_SIZE);
+    if (bytesRead < 0) {
+      throw std::runtime_error("Failed to read from " +
+                               file.fileName().toStdString());
+    }
+    if (bytesRead == 0) {
+      break;
+    }
+
+    const auto data = buffer.data();
+    if (hasPendingCarriageReturn && data[0] != '\n') {
+      consumeChunk(CARRIAGE_RETURN);
+    }
+    hasPendingCarriageReturn = false;
+
+    // Compact the chunk in place, skipping each CR that is followed by a LF.
+    const char* input = data;
+    const char* const inputEnd = data + bytesRead;
+    char* output = data;
+    while (input < inputEnd) {
+      const auto carriageReturn = static_cast<const char*>(
+          std::memchr(input, '\r', static_cast<size_t>(inputEnd - input)));
+      const auto runEnd =
+          carriageReturn == nullptr ? inputEnd : carriageReturn;
+
+      std::memmove(output, input, static_cast<size_t>(runEnd - input));
+      output += runEnd - input;
+
+      if (carriageReturn == nullptr) {
+        break;
+      }
+
+      if (carriageReturn + 1 == inputEnd) {
+        hasPendingCarriageReturn = true;
+      } else if (carriageReturn[1] != '\n') {
+        *output = '\r';
+        output += 1;
+      }
+
+      input = carriageReturn + 1;
+    }
+
+    consumeChunk(QByteArrayView(data, output - data));
   }
 
-  out << table;
+  if (hasPendingCarriageReturn) {
+    consumeChunk(CARRIAGE_RETURN);
+  }
+}
+
+// Get the blob hash recorded for the file's current content, if the file's
+// size and modification time haven't changed since it was recorded.
+std::optional<std::string> getCachedBlobHash(
+    const toml::table& metadata,
+    const std::filesystem::path& filePath) {
+  const auto fileSize = metadata[METADATA_FILE_SIZE_KEY].value<int64_t>();
+  const auto fileTime = metadata[METADATA_FILE_TIME_KEY].value<int64_t>();
+
+  if (!fileSize.has_value() || !fileTime.has_value() ||
+      fileSize.value() != getFileSize(filePath) ||
+      fileTime.value() != getFileModifiedTime(filePath)) {
+    return std::nullopt;
+  }
+
+  return metadata[METADATA_FILE_ID_KEY].value<std::string>();
+}
+
+std::string calculateAndCacheBlobHash(const std::filesystem::path& filePath,
+                                      toml::table metadata) {
+  const auto fileSize = getFileSize(filePath);
+  const auto fileTime = getFileModifiedTime(filePath);
+
+  const auto hash = loot::calculateGitBlobHash(filePath);
+
+  // Don't cache the hash if the file changed while it was being hashed.
+  if (fileSize != getFileSize(filePath) ||
+      fileTime != getFileModifiedTime(filePath)) {
+    return hash;
+  }
+
+  try {
+    metadata.insert_or_assign(METADATA_FILE_ID_KEY, hash);
+    metadata.insert_or_assign(METADATA_FILE_SIZE_KEY, fileSize);
+    metadata.insert_or_assign(METADATA_FILE_TIME_KEY, fileTime);
+
+    writeFileMetadata(filePath, metadata);
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to cache the blob hash of {}: {}",
+                    filePath.u8string(),
+                    e.what());
+    }
+  }
+
+  return hash;
+}
+
+// Returns nullopt if the file's blob hash isn't cached and hashing isn't
+// allowed.
+std::optional<loot::FileRevision> getFileRevision(
+    const std::filesystem::path& filePath,
+    bool allowHashing) {
+  const auto metadata = readFileMetadata(filePath);
+
+  auto hash = metadata[METADATA_ID_KEY].value<std::string>();
+  auto timestamp = metadata[METADATA_DATE_KEY].value<std::string>();
+
+  if (!hash.has_value()) {
+    throw std::runtime_error("blob_sha1 field is missing");
+  }
+
+  if (!timestamp.has_value()) {
+    throw std::runtime_error("update_timestamp field is missing");
+  }
+
+  auto fileHash = getCachedBlobHash(metadata, filePath);
+  if (!fileHash.has_value()) {
+    if (!allowHashing) {
+      return std::nullopt;
+    }
+
+    fileHash = calculateAndCacheBlobHash(filePath, metadata);
+  }
+
+  loot::FileRevision revision;
+  revision.id = fileHash.value();
+  revision.is_modified = revision.id != hash.value();
+  revision.date = timestamp.value();
+
+  return revision;
+}
+
+std::optional<loot::FileRevisionSummary> getFileRevisionSummary(
+    const std::filesystem::path& filePath,
+    loot::FileType fileType,
+    bool allowHashing) {
+  using loot::FileRevisionSummary;
+  using loot::translate;
+
+  auto logger = getLogger();
+
+  try {
+    if (std::filesystem::is_regular_file(filePath)) {
+      const auto revision = getFileRevision(filePath, allowHashing);
+      if (!revision.has_value()) {
+        return std::nullopt;
+      }
+
+      return FileRevisionSummary(revision.value());
+    }
+
+    if (logger) {
+      if (fileType == loot::FileType::Masterlist) {
+        logger->warn("No masterlist present at {}", filePath.u8string());
+      } else {
+        logger->warn("No masterlist prelude present at {}",
+                     filePath.u8string());
+      }
+    }
+
+    auto text = fileType == loot::FileType::Masterlist
+                    ? translate("N/A: No masterlist present")
+                    :
+                    /* translators: N/A is an abbreviation for Not Applicable.
+                       A masterlist is a database that contains information
+                       for various mods. */
+                    translate("N/A: No masterlist prelude present");
+
+    return FileRevisionSummary(text, text);
+  } catch (const std::exception&) {
+    if (logger) {
+      logger->warn("Failed to read metadata for: {}",
+                   filePath.parent_path().u8string());
+    }
+    auto text = translate("Unknown: No revision metadata found");
+    return FileRevisionSummary(text, text);
+  }
 }
 
 bool isFileUpToDate(const std::filesystem::path& filePath,
@@ -99,6 +354,22 @@ bool isFileUpToDate(const std::filesystem::path& filePath,
   auto logger = getLogger();
 
   try {
+    // Use the hash recorded when the file was last updated or hashed if the
+    // file hasn't changed since, to avoid reading the whole file again.
+    if (std::filesystem::exists(getFileMetadataPath(filePath))) {
+      const auto cachedHash =
+          getCachedBlobHash(readFileMetadata(filePath), filePath);
+      if (cachedHash.has_value()) {
+        if (logger) {
+          logger->debug("Using cached blob hash for file at {}: {}",
+                        filePath.u8string(),
+                        cachedHash.value());
+        }
+
+        return expectedHash == cachedHash.value();
+      }
+    }
+
     auto existingFileHash = loot::calculateGitBlobHash(filePath);
 
     if (logger) {
@@ -154,15 +425,9 @@ void scaleCardHeading(QLabel& label) {
 }
 
 std::string calculateGitBlobHash(const QByteArray& data) {
-  auto sizeString = std::to_string(data.size());
   auto hasher = QCryptographicHash(QCryptographicHash::Sha1);
 
-  static constexpr QByteArrayView HEADER_PREFIX = QByteArrayView("blob ");
-
-  hasher.addData(HEADER_PREFIX);
-  hasher.addData(QByteArrayView(sizeString.c_str(),
-                                static_cast<qsizetype>(sizeString.size()) + 1));
-
+  addGitBlobHeader(hasher, data.size());
   hasher.addData(data);
 
   return QString(hasher.result().toHex()).toStdString();
@@ -176,92 +441,55 @@ std::string calculateGitBlobHash(const std::filesystem::path& filePath) {
     throw std::runtime_error(filePath.u8string() + " is not a regular file");
   }
 
-  QByteArray fileContent = file.readAll();
-
   // Files in LOOT's repositories are committed with LF line endings, but if the
   // file being read is from the working directory of a local Git repository
   // that has autocrlf enabled, it will have CRLF line endings, so the
   // hash won't match the value calculated by Git unless the line endings
   // are replaced.
-  fileContent.replace(QByteArray("\r\n"), QByteArray("\n"));
-
-  return calculateGitBlobHash(fileContent);
-}
-
-FileRevision getFileRevision(const std::filesystem::path& filePath) {
-  FileRevision revision;
-
-  revision.id = calculateGitBlobHash(filePath);
-
-  auto metadataPath = getFileMetadataPath(filePath);
-
-  // Don't use toml::parse_file() as it just uses a std stream,
-  // which don't support UTF-8 paths on Windows.
-  std::ifstream in(metadataPath);
-  if (!in.is_open()) {
-    throw std::runtime_error(metadataPath.u8string() +
-                             " could not be opened for parsing");
+  // The blob header includes the size of the content after its line endings
+  // have been replaced, so read the file twice: once to count the size, and
+  // again to hash it. This avoids holding the whole file in memory.
+  qsizetype normalisedSize = 0;
+  forEachNormalisedChunk(file, [&](QByteArrayView chunk) {
+    normalisedSize += chunk.size();
+  });
+
+  if (!file.seek(0)) {
+    throw std::runtime_error(filePath.u8string() + " could not be reread");
   }
 
-  const auto metadata = toml::parse(in, metadataPath.u8string());
+  auto hasher = QCryptographicHash(QCryptographicHash::Sha1);
 
-  auto hash = metadata[METADATA_ID_KEY].value<std::string>();
-  auto timestamp = metadata[METADATA_DATE_KEY].value<std::string>();
+  addGitBlobHeader(hasher, normalisedSize);
+  forEachNormalisedChunk(file,
+                         [&](QByteArrayView chunk) { hasher.addData(chunk); });
 
-  if (!hash.has_value()) {
-    throw std::runtime_error("blob_sha1 field is missing");
-  }
+  return QString(hasher.result().toHex()).toStdString();
+}
 
-  if (!timestamp.has_value()) {
-    throw std::runtime_error("update_timestamp field is missing");
+FileRevision getFileRevision(const std::filesystem::path& filePath) {
+  if (!std::filesystem::is_regular_file(filePath)) {
+    throw std::runtime_error(filePath.u8string() + " is not a regular file");
   }
 
-  revision.is_modified = revision.id != hash.value();
-  revision.date = timestamp.value();
-
-  return revision;
+  return ::getFileRevision(filePath, true).value();
 }
 
 FileRevisionSummary getFileRevisionSummary(
     const std::filesystem::path& filePath,
     FileType fileType) {
-  auto logger = getLogger();
-
-  try {
-    if (std::filesystem::is_regular_file(filePath)) {
-      return FileRevisionSummary(getFileRevision(filePath));
-    }
-
-    if (logger) {
-      if (fileType == FileType::Masterlist) {
-        logger->warn("No masterlist present at {}", filePath.u8string());
-      } else {
-        logger->warn("No masterlist prelude present at {}",
-                     filePath.u8string());
-      }
-    }
-
-    auto text = fileType == FileType::Masterlist
-                    ? translate("N/A: No masterlist present")
-                    :
-                    /* translators: N/A is an abbreviation for Not Applicable.
-                       A masterlist is a database that contains information
-                       for various mods. */
-                    translate("N/A: No masterlist prelude present");
+  return ::getFileRevisionSummary(filePath, fileType, true).value();
+}
 
-    return FileRevisionSummary(text, text);
-  } catch (const std::exception&) {
-    if (logger) {
-      logger->warn("Failed to read metadata for: {}",
-                   filePath.parent_path().u8string());
-    }
-    auto text = translate("Unknown: No revision metadata found");
-    return FileRevisionSummary(text, text);
-  }
+std::optional<FileRevisionSummary> getCachedFileRevisionSummary(
+    const std::filesystem::path& filePath,
+    FileType fileType) {
+  return ::getFileRevisionSummary(filePath, fileType, false);
 }
 
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data) {
+                        const QByteArray& data,
+                        const HttpValidators& validators) {
   auto logger = getLogger();
 
   auto newHash = calculateGitBlobHash(data);
@@ -284,11 +512,92 @@ bool updateFileWithData(const std::filesystem::path& filePath,
   // update timestamp may have changed.
   auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(filePath, newHash, updateTimestamp);
+  writeFileRevision(filePath, newHash, updateTimestamp, validators);
 
   return hasChanged;
 }
 
+std::optional<HttpValidators> readHttpValidators(
+    const std::filesystem::path& filePath) {
+  auto logger = getLogger();
+
+  try {
+    if (!std::filesystem::is_regular_file(filePath) ||
+        !std::filesystem::exists(getFileMetadataPath(filePath))) {
+      return std::nullopt;
+    }
+
+    const auto metadata = readFileMetadata(filePath);
+
+    // Only use the validators if the file still has the content that was
+    // downloaded.
+    const auto fileHash = getCachedBlobHash(metadata, filePath);
+    if (!fileHash.has_value() ||
+        fileHash != metadata[METADATA_ID_KEY].value<std::string>()) {
+      if (logger) {
+        logger->debug(
+            "{} has changed since it was last updated, not using its HTTP "
+            "validators",
+            filePath.u8string());
+      }
+      return std::nullopt;
+    }
+
+    HttpValidators validators;
+    validators.etag =
+        metadata[METADATA_ETAG_KEY].value<std::string>().value_or("");
+    validators.lastModified =
+        metadata[METADATA_LAST_MODIFIED_KEY].value<std::string>().value_or("");
+    validators.url =
+        metadata[METADATA_SOURCE_URL_KEY].value<std::string>().value_or("");
+
+    if (validators.empty()) {
+      return std::nullopt;
+    }
+
+    return validators;
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to read HTTP validators for {}: {}",
+                    filePath.u8string(),
+                    e.what());
+    }
+
+    return std::nullopt;
+  }
+}
+
+void updateFileRevisionTimestamp(const std::filesystem::path& filePath,
+                                 const HttpValidators& validators) {
+  auto metadata = readFileMetadata(filePath);
+
+  const auto updateTimestamp =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->debug("{} is already up to date, updating its timestamp to {}",
+                  filePath.u8string(),
+                  updateTimestamp);
+  }
+
+  metadata.insert_or_assign(METADATA_DATE_KEY, updateTimestamp);
+
+  // A server may send new validators with a Not Modified response.
+  if (!validators.etag.empty()) {
+    metadata.insert_or_assign(METADATA_ETAG_KEY, validators.etag);
+  }
+  if (!validators.lastModified.empty()) {
+    metadata.insert_or_assign(METADATA_LAST_MODIFIED_KEY,
+                              validators.lastModified);
+  }
+  if (!validators.empty() && !validators.url.empty()) {
+    metadata.insert_or_assign(METADATA_SOURCE_URL_KEY, validators.url);
+  }
+
+  writeFileMetadata(filePath, metadata);
+}
+
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination) {
   const auto logger = getLogger();
@@ -321,7 +630,7 @@ bool updateFile(const std::filesystem::path& source,
   // update timestamp may have changed.
   const auto updateTimestamp =
       QDate::currentDate().toString(Qt::ISODate).toStdString();
-  writeFileRevision(destination, newHash, updateTimestamp);
+  writeFileRevision(destination, newHash, updateTimestamp, HttpValidators());
 
   return hasChanged;
 }
@@ -333,6 +642,66 @@ bool isValidUrl(const std::string& location) {
          (scheme == "http" || scheme == "https");
 }
 
+QNetworkRequest createConditionalRequest(
+    const std::string& url,
+    const std::filesystem::path& filePath) {
+  QNetworkRequest request(QUrl(QString::fromStdString(url)));
+
+  const auto requestUrl = request.url().toString().toStdString();
+  auto validators = readHttpValidators(filePath);
+
+  // The validators were given for a particular URL, and sending them in a
+  // request for a different URL (e.g. because the masterlist source has been
+  // changed) could cause the server to wrongly respond that the file is not
+  // modified.
+  if (validators.has_value() && validators.value().url != requestUrl) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug(
+          "The HTTP validators for {} were recorded for a request to \"{}\", "
+          "not sending them in a request to \"{}\"",
+          filePath.u8string(),
+          validators.value().url,
+          requestUrl);
+    }
+
+    validators = std::nullopt;
+  }
+
+  if (validators.has_value()) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->trace(
+          "Sending a conditional request with ETag \"{}\" and last modified "
+          "date \"{}\"",
+          validators.value().etag,
+          validators.value().lastModified);
+    }
+
+    if (!validators.value().etag.empty()) {
+      request.setRawHeader(
+          "If-None-Match",
+          QByteArray::fromStdString(validators.value().etag));
+    }
+    if (!validators.value().lastModified.empty()) {
+      request.setRawHeader(
+          "If-Modified-Since",
+          QByteArray::fromStdString(validators.value().lastModified));
+    }
+  }
+
+  return request;
+}
+
+HttpValidators getHttpValidators(const QNetworkReply& reply) {
+  HttpValidators validators;
+  validators.etag = reply.rawHeader("ETag").toStdString();
+  validators.lastModified = reply.rawHeader("Last-Modified").toStdString();
+  validators.url = reply.request().url().toString().toStdString();
+
+  return validators;
+}
+
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply) {
   auto statusCode =
       reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
@@ -34,6 +34,7 @@
 #include <QtNetwork/QNetworkReply>
 #include <QtWidgets/QLabel>
 #include <filesystem>
+#include <optional>
 #include <vector>
 
 #include "gui/state/game/game_settings.h"
@@ -47,6 +48,18 @@ struct FileRevision {
   bool is_modified{false};
 };
 
+// The validators that a HTTP server gave for a file, which can be used to
+// make conditional requests for it.
+struct HttpValidators {
+  std::string etag;
+  std::string lastModified;
+  // The URL that was requested to get the validators, as they're only
+  // meaningful for that URL.
+  std::string url;
+
+  bool empty() const { return etag.empty() && lastModified.empty(); }
+};
+
 struct FileRevisionSummary {
   FileRevisionSummary() = default;
   explicit FileRevisionSummary(const FileRevision& fileRevision);
@@ -70,14 +83,39 @@ FileRevisionSummary getFileRevisionSummary(
     const std::filesystem::path& filePath,
     FileType fileType);
 
+// Like getFileRevisionSummary(), but returns nullopt instead of hashing the
+// file if its blob hash isn't already cached in its revision metadata.
+std::optional<FileRevisionSummary> getCachedFileRevisionSummary(
+    const std::filesystem::path& filePath,
+    FileType fileType);
+
 bool updateFileWithData(const std::filesystem::path& filePath,
-                        const QByteArray& data);
+                        const QByteArray& data,
+                        const HttpValidators& validators = HttpValidators());
+
+// Get the HTTP validators recorded when the file at the given path was last
+// updated. Returns nullopt if there are none, or if the file has been changed
+// since it was updated. The returned validators' url is empty if no URL was
+// recorded for them.
+std::optional<HttpValidators> readHttpValidators(
+    const std::filesystem::path& filePath);
+
+// Update the file's revision metadata to record that it was found to be up to
+// date without it being downloaded again.
+void updateFileRevisionTimestamp(const std::filesystem::path& filePath,
+                                 const HttpValidators& validators);
 
 bool updateFile(const std::filesystem::path& source,
                 const std::filesystem::path& destination);
 
 bool isValidUrl(const std::string& location);
 
+QNetworkRequest createConditionalRequest(
+    const std::string& url,
+    const std::filesystem::path& filePath);
+
+HttpValidators getHttpValidators(const QNetworkReply& reply);
+
 std::optional<QByteArray> readHttpResponse(QNetworkReply* reply);
 
 void showInvalidRegexTooltip(QWidget& widget, const std::string& details);
@@ -26,22 +26,64 @@
 #include "gui/qt/icon_factory.h"
 
 #include <QtGui/QGuiApplication>
+#include <QtGui/QImageReader>
+#include <QtGui/QPainter>
 #include <QtGui/QPalette>
 #include <QtGui/QScreen>
+#include <QtWidgets/QApplication>
 #include <QtWidgets/QStyle>
+#include <cmath>
+#include <set>
+
+#include "gui/qt/card.h"
 
 namespace {
-QPixmap changeColor(QPixmap pixmap, QColor color) {
-  QImage image = pixmap.toImage();
-
-  for (int y = 0; y < image.height(); y++) {
-    for (int x = 0; x < image.width(); x++) {
-      color.setAlpha(image.pixelColor(x, y).alpha());
-      image.setPixelColor(x, y, color);
-    }
+double getDevicePixelRatio() {
+  return dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
+      ->devicePixelRatio();
+}
+
+// The logical sizes at which icons are drawn by cards, the sidebar, menus and
+// toolbars. Icons are rasterised at these sizes up front so that they don't
+// need to be scaled when drawn.
+std::set<int> getIconExtents() {
+  const auto style = QApplication::style();
+
+  return {loot::Card::ATTRIBUTE_ICON_HEIGHT,
+          style->pixelMetric(QStyle::PM_SmallIconSize),
+          style->pixelMetric(QStyle::PM_ToolBarIconSize),
+          style->pixelMetric(QStyle::PM_TabBarIconSize)};
+}
+
+// Rasterise the image at the given resource path so that it fits in a square
+// with the given side length, or at its natural size if the length is zero.
+QImage renderImage(const QString& resourcePath, int deviceExtent) {
+  QImageReader reader(resourcePath);
+
+  const auto naturalSize = reader.size();
+  if (deviceExtent > 0 && naturalSize.isValid()) {
+    reader.setScaledSize(naturalSize.scaled(
+        deviceExtent, deviceExtent, Qt::KeepAspectRatio));
   }
 
-  return QPixmap::fromImage(image);
+  return reader.read().convertToFormat(QImage::Format_ARGB32_Premultiplied);
+}
+
+// Replace the colour of every pixel with the given colour while keeping its
+// alpha, using a single composition pass instead of a per-pixel loop.
+QPixmap changeColor(const QImage& image, const QColor& color) {
+  if (image.isNull()) {
+    return QPixmap();
+  }
+
+  auto recoloured = image;
+
+  QPainter painter(&recoloured);
+  painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+  painter.fillRect(recoloured.rect(), color);
+  painter.end();
+
+  return QPixmap::fromImage(std::move(recoloured));
 }
 }
 
@@ -181,9 +223,7 @@ QPixmap IconFactory::getPixmap(const QIcon& icon,
                                QIcon::State state) {
   // Take the device pixel ratio into account when reading or writing the cache
   // as it may change while the application is running.
-  const auto pixelRatio =
-      dynamic_cast<QGuiApplication*>(QCoreApplication::instance())
-          ->devicePixelRatio();
+  const auto pixelRatio = getDevicePixelRatio();
   auto scaledSize = extent * pixelRatio;
   auto key = std::make_tuple(icon.cacheKey(), scaledSize, mode, state);
 
@@ -206,6 +246,8 @@ void IconFactory::setColours(QColor normal, QColor disabled, QColor selected) {
   normalColor = normal;
   disabledColor = disabled;
   selectedColor = selected;
+
+  prerenderIcons();
 }
 
 std::map<QString, QIcon> IconFactory::icons;
@@ -213,13 +255,46 @@ std::map<QString, QIcon> IconFactory::icons;
 std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>, QPixmap>
     IconFactory::pixmaps;
 
+double IconFactory::iconsPixelRatio{0};
+
 QColor IconFactory::normalColor;
 
 QColor IconFactory::disabledColor;
 
 QColor IconFactory::selectedColor;
 
+void IconFactory::prerenderIcons() {
+  // Render the icons that are drawn while painting cards and the sidebar now,
+  // so that painting never needs to rasterise an SVG.
+  const std::vector<QIcon> cardIcons{getIsActiveIcon(),
+                                     getMasterFileIcon(),
+                                     getBlueprintMasterIcon(),
+                                     getLightPluginIcon(),
+                                     getSmallPluginIcon(),
+                                     getMediumPluginIcon(),
+                                     getEmptyPluginIcon(),
+                                     getLoadsArchiveIcon(),
+                                     getIsCleanIcon(),
+                                     getHasUserMetadataIcon(),
+                                     getHideMessagesIcon()};
+
+  for (const auto& icon : cardIcons) {
+    getPixmap(icon, Card::ATTRIBUTE_ICON_HEIGHT);
+  }
+
+  getEditIcon();
+}
+
 QIcon IconFactory::getIcon(QString resourcePath) {
+  // The icon's pixmaps are rendered for the current device pixel ratio, so
+  // they need to be re-rendered if it changes.
+  const auto pixelRatio = getDevicePixelRatio();
+  if (pixelRatio != iconsPixelRatio) {
+    icons.clear();
+    pixmaps.clear();
+    iconsPixelRatio = pixelRatio;
+  }
+
   const auto it = icons.find(resourcePath);
   if (it != icons.end()) {
     return it->second;
@@ -240,15 +315,21 @@ QIcon IconFactory::getIcon(QString resourcePath) {
                                                      QPalette::HighlightedText);
   }
 
-  auto rawPixmap = QPixmap(resourcePath);
-  auto normalPixmap = changeColor(rawPixmap, normalColor);
-  auto disabledPixmap = changeColor(rawPixmap, disabledColor);
-  auto selectedPixmap = changeColor(rawPixmap, selectedColor);
-
   QIcon icon;
-  icon.addPixmap(normalPixmap, QIcon::Normal);
-  icon.addPixmap(disabledPixmap, QIcon::Disabled);
-  icon.addPixmap(selectedPixmap, QIcon::Selected);
+
+  const auto addPixmaps = [&](const QImage& image) {
+    icon.addPixmap(changeColor(image, normalColor), QIcon::Normal);
+    icon.addPixmap(changeColor(image, disabledColor), QIcon::Disabled);
+    icon.addPixmap(changeColor(image, selectedColor), QIcon::Selected);
+  };
+
+  for (const auto extent : getIconExtents()) {
+    addPixmaps(renderImage(resourcePath,
+                           static_cast<int>(std::round(extent * pixelRatio))));
+  }
+
+  // Also add the icon at its natural size, to scale from for any other sizes.
+  addPixmaps(renderImage(resourcePath, 0));
 
   icons.emplace(resourcePath, icon);
 
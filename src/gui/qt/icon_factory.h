@@ -87,10 +87,13 @@ private:
   static std::map<std::tuple<qint64, double, QIcon::Mode, QIcon::State>,
                   QPixmap>
       pixmaps;
+  static double iconsPixelRatio;
   static QColor normalColor;
   static QColor disabledColor;
   static QColor selectedColor;
 
+  static void prerenderIcons();
+
   static QIcon getIcon(QString resourcePath);
 };
 }
@@ -36,8 +36,10 @@
 #include "gui/application_mutex.h"
 #include "gui/qt/main_window.h"
 #include "gui/qt/style.h"
+#include "gui/qt/ui_stall_watchdog.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_state.h"
+#include "gui/state/tracing.h"
 #include "gui/version.h"
 
 namespace {
@@ -58,6 +60,20 @@ bool isRunningThroughModOrganiser() {
   return false;
 }
 
+// Logging is asynchronous, so make sure that it's shut down cleanly once
+// everything else that might log has been destroyed.
+class [[maybe_unused]] LoggingGuard {
+public:
+  LoggingGuard() = default;
+  LoggingGuard(const LoggingGuard&) = delete;
+  LoggingGuard(LoggingGuard&&) = delete;
+
+  ~LoggingGuard() { loot::shutDownLogging(); }
+
+  LoggingGuard& operator=(const LoggingGuard&) = delete;
+  LoggingGuard& operator=(LoggingGuard&&) = delete;
+};
+
 void logRuntimeEnvironment() {
   const auto logger = loot::getLogger();
   if (logger) {
@@ -98,6 +114,7 @@ int main(int argc, char* argv[]) {
 #endif
 
   loot::ApplicationMutexGuard mutexGuard;
+  LoggingGuard loggingGuard;
 
 #ifdef _WIN32
   // The default style on Windows 10 is light-only, and while the
@@ -124,7 +141,15 @@ int main(int argc, char* argv[]) {
        {"loot-data-path",
         "Set the directory where LOOT will store its data",
         "path"},
-       {"auto-sort", "Automatically sort the load order on launch"}});
+       {"auto-sort", "Automatically sort the load order on launch"},
+       {"trace-file",
+        "Record how long LOOT's operations take and write the timings to the "
+        "given file as Chrome trace event JSON when LOOT exits",
+        "path"},
+       {"ui-stall-threshold",
+        "Log which operation was running whenever the UI is unresponsive for "
+        "longer than the given number of milliseconds",
+        "milliseconds"}});
   parser.process(app);
 
   auto lootDataPath =
@@ -133,12 +158,37 @@ int main(int argc, char* argv[]) {
   auto gamePath =
       std::filesystem::u8path(parser.value("game-path").toStdString());
   auto autoSort = parser.isSet("auto-sort");
+  auto traceFilePath =
+      std::filesystem::u8path(parser.value("trace-file").toStdString());
+
+  if (!traceFilePath.empty()) {
+    loot::enableTracing();
+  }
+
+  loot::startStartupTimeline();
 
   loot::LootState state(loot::LootPaths("", lootDataPath));
 
   logRuntimeEnvironment();
 
-  state.init(startupGameFolder, gamePath, autoSort);
+  std::optional<loot::UiStallWatchdog> uiStallWatchdog;
+  if (parser.isSet("ui-stall-threshold")) {
+    bool isValid = false;
+    const auto threshold = parser.value("ui-stall-threshold").toInt(&isValid);
+    if (isValid && threshold > 0) {
+      uiStallWatchdog.emplace(std::chrono::milliseconds(threshold));
+    } else {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error("Ignoring invalid UI stall threshold: {}",
+                      parser.value("ui-stall-threshold").toStdString());
+      }
+    }
+  }
+
+  // Only settings are loaded before the window is shown, game detection and
+  // initialisation happen in the background once it's visible.
+  state.initSettings(startupGameFolder, autoSort);
 
   // Load Qt's translations.
   QTranslator translator;
@@ -202,7 +252,8 @@ int main(int argc, char* argv[]) {
           logger->debug(message);
         }
 
-        mainWindow.initialise();
+        loot::markStartupMilestone("Startup: window shown");
+        mainWindow.initialise(startupGameFolder, gamePath);
 
         timer->stop();
         timer->deleteLater();
@@ -214,8 +265,22 @@ int main(int argc, char* argv[]) {
     timer->start(1);
   } else {
     mainWindow.show();
-    mainWindow.initialise();
+    loot::markStartupMilestone("Startup: window shown");
+    mainWindow.initialise(startupGameFolder, gamePath);
+  }
+
+  const auto exitCode = app.exec();
+
+  if (!traceFilePath.empty()) {
+    try {
+      loot::writeTraceFile(traceFilePath);
+    } catch (const std::exception& e) {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error("Failed to write trace file: {}", e.what());
+      }
+    }
   }
 
-  return app.exec();
+  return exitCode;
 }
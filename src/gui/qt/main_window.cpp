@@ -27,6 +27,7 @@
 
 #include <fmt/base.h>
 
+#include <QtConcurrent/QtConcurrentRun>
 #include <QtCore/QTimer>
 #include <QtCore/QUrl>
 #include <QtGui/QCloseEvent>
@@ -48,14 +49,33 @@
 #include "gui/qt/style.h"
 #include "gui/qt/tasks/check_for_update_task.h"
 #include "gui/qt/tasks/update_masterlist_task.h"
+#include "gui/qt/ui_stall_watchdog.h"
+#include "gui/query/types/append_message_query.h"
+#include "gui/query/types/apply_group_changes_query.h"
 #include "gui/query/types/apply_sort_query.h"
+#include "gui/query/types/back_up_load_order_query.h"
 #include "gui/query/types/cancel_sort_query.h"
 #include "gui/query/types/change_game_query.h"
 #include "gui/query/types/clear_all_metadata_query.h"
 #include "gui/query/types/clear_plugin_metadata_query.h"
+#include "gui/query/types/delete_load_order_backup_query.h"
 #include "gui/query/types/get_game_data_query.h"
+#include "gui/query/types/get_general_messages_query.h"
+#include "gui/query/types/get_load_order_backups_query.h"
+#include "gui/query/types/get_load_order_text_query.h"
 #include "gui/query/types/get_overlapping_plugins_query.h"
+#include "gui/query/types/get_plugin_items_query.h"
+#include "gui/query/types/get_plugin_metadata_query.h"
+#include "gui/query/types/get_plugin_metadata_text_query.h"
+#include "gui/query/types/load_metadata_query.h"
+#include "gui/query/types/read_load_order_backup_query.h"
+#include "gui/query/types/redate_plugins_query.h"
+#include "gui/query/types/set_games_settings_query.h"
+#include "gui/query/types/set_load_order_query.h"
+#include "gui/query/types/set_plugin_metadata_query.h"
 #include "gui/query/types/sort_plugins_query.h"
+#include "gui/query/types/update_installed_games_query.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 #include "gui/version.h"
 
@@ -111,15 +131,6 @@ void recordCurrentGameHiddenMessages(
   lootSettings.storeGameSettings(gamesSettings);
 }
 
-std::vector<std::string> GetGroupNames(const loot::gui::Game& game) {
-  std::vector<std::string> groupNames;
-  for (const auto& group : game.getGroups()) {
-    groupNames.push_back(group.GetName());
-  }
-
-  return groupNames;
-}
-
 bool hasLoadOrderChanged(const std::vector<std::string>& oldLoadOrder,
                          const std::vector<loot::PluginItem>& newLoadOrder) {
   if (oldLoadOrder.size() != newLoadOrder.size()) {
@@ -274,6 +285,14 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
   setupUi();
   refreshGamesDropdown();
 
+  // This handler will run from a userlist writer's thread.
+  state.setUserlistWriteErrorHandler([this](const std::string& message) {
+    QMetaObject::invokeMethod(
+        this,
+        [this, message]() { handleUserlistWriteError(message); },
+        Qt::QueuedConnection);
+  });
+
   qApp->connect(qApp,
                 &QGuiApplication::applicationStateChanged,
                 this,
@@ -286,16 +305,67 @@ MainWindow::MainWindow(LootState& state, QWidget* parent) :
                 });
 }
 
-void MainWindow::initialise() {
+MainWindow::~MainWindow() {
+  // The games outlive the window, so stop them reporting errors to it.
+  state->setUserlistWriteErrorHandler(nullptr);
+}
+
+void MainWindow::initialise(const std::string& cmdLineGame,
+                            const std::filesystem::path& cmdLineGamePath) {
   try {
     themes = findThemes(state->getPaths().getThemesPath());
 
-    if (state->getSettings().getLastVersion() != getLootVersion()) {
-      showFirstRunDialog();
+    // Show the last game that was loaded while games are detected, as it's
+    // most likely to be the game that gets loaded.
+    const auto lastGame = state->getSettings().getLastGame();
+    for (const auto& gameSettings : state->getSettings().getGameSettings()) {
+      if (gameSettings.getFolderName() == lastGame) {
+        gameComboBox->addItem(QString::fromStdString(gameSettings.getName()),
+                              QString::fromStdString(lastGame));
+        break;
+      }
     }
 
-    if (state->hasCurrentGame()) {
-      state->initCurrentGame();
+    handleProgressUpdate(qTranslate("Detecting installed games…"));
+
+    // The state must not be accessed from the UI thread until this finishes,
+    // so disable the actions that would do so. Running it on the game worker
+    // means that queries can't start until it has finished.
+    setGamesInitialisingState(true);
+
+    gamesInitialisation = QtConcurrent::run(
+        getGameWorker(), [this, cmdLineGame, cmdLineGamePath]() {
+          state->initGames(cmdLineGame, cmdLineGamePath);
+
+          if (state->hasCurrentGame()) {
+            state->initCurrentGame();
+          }
+        });
+
+    gamesInitialisation
+        .then(this,
+              [this]() {
+                setGamesInitialisingState(false);
+                handleGamesInitialised();
+              })
+        .onFailed(this, [this](const std::exception& e) {
+          setGamesInitialisingState(false);
+          handleException(e);
+        });
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleGamesInitialised() {
+  try {
+    progressDialog->reset();
+
+    refreshGamesDropdown();
+    revalidateInstalledGames();
+
+    if (state->getSettings().getLastVersion() != getLootVersion()) {
+      showFirstRunDialog();
     }
 
     std::vector<SourcedMessage> initMessages = state->getInitMessages();
@@ -308,6 +378,7 @@ void MainWindow::initialise() {
     pluginItemModel->setGeneralMessages(std::move(initMessages));
 
     if (initHasErrored) {
+      markStartupMilestone("Startup: interactive");
       return;
     }
 
@@ -347,6 +418,8 @@ void MainWindow::initialise() {
 }
 
 void MainWindow::applyTheme() {
+  UiOperation operation("MainWindow::applyTheme");
+
   const auto themesPath = state->getPaths().getThemesPath();
   const auto theme = state->getSettings().getTheme();
 
@@ -377,7 +450,7 @@ void MainWindow::applyTheme() {
 #endif
   }
 
-  std::optional<QString> styleSheet;
+  std::vector<std::string> candidateThemes;
 #if QT_VERSION >= QT_VERSION_CHECK(6, 5, 0)
   if (boost::ends_with(theme, "-dark")) {
     if (logger) {
@@ -398,36 +471,145 @@ void MainWindow::applyTheme() {
       logger->debug("The detected color scheme is dark");
     }
     if (!boost::ends_with(theme, "-dark")) {
-      styleSheet = loot::loadStyleSheet(themesPath, theme + "-dark");
+      candidateThemes.push_back(theme + "-dark");
     }
   } else {
     if (logger) {
       logger->debug("The detected color scheme is light");
     }
     if (!boost::ends_with(theme, "-light")) {
-      styleSheet = loot::loadStyleSheet(themesPath, theme + "-light");
+      candidateThemes.push_back(theme + "-light");
     }
   }
 #endif
 
-  if (!styleSheet.has_value()) {
-    styleSheet = loot::loadStyleSheet(themesPath, theme);
+  candidateThemes.push_back(theme);
+  // Fall back to the default light theme.
+  candidateThemes.push_back("default-light");
+
+  for (const auto& candidateTheme : candidateThemes) {
+    // Try both file formats in the filesystem before the built-in resources,
+    // so that a user's theme overrides a built-in theme of the same name.
+    for (const auto source : {ThemeSource::filesystem, ThemeSource::builtIn}) {
+      const auto paletteTheme =
+          loot::loadPaletteTheme(themesPath, candidateTheme, source);
+      if (paletteTheme.has_value()) {
+        applyPaletteTheme(paletteTheme.value());
+        return;
+      }
+
+      const auto styleSheet =
+          loot::loadStyleSheet(themesPath, candidateTheme, source);
+      if (styleSheet.has_value()) {
+        applyStyleSheetTheme(styleSheet.value());
+        return;
+      }
+    }
+  }
+
+  if (logger) {
+    logger->error(
+        "Failed to find the files for the \"{}\" theme in the filesystem or "
+        "built-in resources.",
+        theme);
+  }
+}
+
+void MainWindow::applyPaletteTheme(const PaletteTheme& theme) {
+  // Only touch the application style sheet if it actually changes, as setting
+  // it causes every widget in the application to be re-polished.
+  if (qApp->styleSheet() != theme.applicationStyleSheet) {
+    qApp->setStyleSheet(theme.applicationStyleSheet);
+  }
+
+  // Any roles that the theme doesn't set are resolved against the style's
+  // standard palette.
+  qApp->setPalette(theme.palette);
+
+  const auto palette = qApp->palette();
+  const auto& colors = theme.colors;
+
+  const auto normalIcon = colors.normalIcon.value_or(
+      palette.color(QPalette::Active, QPalette::WindowText));
+  const auto disabledIcon = colors.disabledIcon.value_or(
+      palette.color(QPalette::Disabled, QPalette::WindowText));
+  const auto selectedIcon = colors.selectedIcon.value_or(
+      palette.color(QPalette::Active, QPalette::HighlightedText));
+
+  if (normalIcon != normalIconColor || disabledIcon != disabledIconColor ||
+      selectedIcon != selectedIconColor) {
+    normalIconColor = normalIcon;
+    disabledIconColor = disabledIcon;
+    selectedIconColor = selectedIcon;
+    handleIconColorChanged();
+  }
+
+  const auto selectedSidebarText = colors.selectedSidebarPluginText.value_or(
+      palette.color(QPalette::Active, QPalette::HighlightedText));
+  const auto unselectedSidebarGroup =
+      colors.unselectedSidebarPluginGroup.value_or(
+          palette.color(QPalette::Active, QPalette::PlaceholderText));
+
+  if (selectedSidebarText != selectedSidebarPluginTextColor ||
+      unselectedSidebarGroup != unselectedSidebarPluginGroupColor) {
+    selectedSidebarPluginTextColor = selectedSidebarText;
+    unselectedSidebarPluginGroupColor = unselectedSidebarGroup;
+    handleSidebarTextColorChanged();
   }
 
-  if (!styleSheet.has_value()) {
-    // Fall back to the default light theme.
-    styleSheet = loot::loadStyleSheet(themesPath, "default-light");
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+
+  const auto link = palette.color(QPalette::Active, QPalette::Link);
+  if (link != linkColor) {
+    linkColor = link;
+    if (cardDelegate) {
+      cardDelegate->refreshMessages();
+    }
   }
 
-  if (styleSheet.has_value()) {
-    qApp->setStyleSheet(styleSheet.value());
+  groupsEditor->setGraphColors(
+      colors.graphMasterlistMetadata.value_or(
+          palette.color(QPalette::Disabled, QPalette::Text)),
+      colors.graphUserMetadata.value_or(
+          palette.color(QPalette::Active, QPalette::Text)),
+      colors.graphBackground.value_or(
+          palette.color(QPalette::Active, QPalette::Base)));
 
-    qApp->style()->polish(qApp);
+  if (pluginCardsView->styleSheet() != theme.cardsStyleSheet) {
+    pluginCardsView->setStyleSheet(theme.cardsStyleSheet);
+  }
 
-    const auto cardDelegate =
-        qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+  if (cardDelegate) {
     cardDelegate->refreshStyling();
   }
+
+  usingPaletteTheme = true;
+}
+
+void MainWindow::applyStyleSheetTheme(const QString& styleSheet) {
+  const auto wasUsingPaletteTheme = usingPaletteTheme;
+  if (wasUsingPaletteTheme) {
+    // Undo what the palette theme set so that it doesn't leak into the style
+    // sheet theme.
+    qApp->setPalette(QPalette());
+    pluginCardsView->setStyleSheet(QString());
+  }
+
+  qApp->setStyleSheet(styleSheet);
+
+  qApp->style()->polish(qApp);
+
+  if (wasUsingPaletteTheme) {
+    // The polish only signals colour properties that changed, but resetting
+    // the palette above also discarded the link colour.
+    handleLinkColorChanged();
+    usingPaletteTheme = false;
+  }
+
+  const auto cardDelegate =
+      qobject_cast<CardDelegate*>(pluginCardsView->itemDelegate());
+  cardDelegate->refreshStyling();
 }
 
 void MainWindow::setupUi() {
@@ -459,6 +641,28 @@ void MainWindow::setupUi() {
   setupMenuBar();
   setupToolBar();
 
+  operationConflictingActions->setExclusionPolicy(
+      QActionGroup::ExclusionPolicy::None);
+  for (const auto action : {actionSettings,
+                            actionUpdateMasterlists,
+                            actionBackupData,
+                            actionOpenGroupsEditor,
+                            actionSort,
+                            actionUpdateMasterlist,
+                            actionApplySort,
+                            actionDiscardSort,
+                            actionRefreshContent,
+                            actionBackUpLoadOrder,
+                            actionRestoreLoadOrder,
+                            actionFixAmbiguousLoadOrder,
+                            actionRedatePlugins,
+                            actionClearAllUserMetadata,
+                            actionEditMetadata,
+                            actionClearMetadata,
+                            gameComboBoxAction}) {
+    operationConflictingActions->addAction(action);
+  }
+
   settingsDialog->setObjectName("settingsDialog");
   searchDialog->setObjectName("searchDialog");
   backupDialog->setObjectName("backupDialog");
@@ -496,16 +700,26 @@ void MainWindow::setupUi() {
 
   setCentralWidget(sidebarSplitter);
 
-  const auto progressBar = new QProgressBar();
   progressBar->setTextVisible(false);
   progressBar->setMinimum(0);
   progressBar->setMaximum(0);
 
-  progressDialog->setWindowModality(Qt::WindowModal);
+  progressDialog->setObjectName("progressDialog");
+  // Don't block the whole window while an operation runs, only the actions
+  // that would conflict with it (see eventFilter()).
+  progressDialog->setWindowModality(Qt::NonModal);
+  progressDialog->installEventFilter(this);
   progressDialog->setCancelButton(nullptr);
   progressDialog->setBar(progressBar);
   progressDialog->reset();
 
+  // Keep the dialog open after cancelling until the operation has actually
+  // stopped, as it may need to finish its current unit of work first.
+  disconnect(progressDialog,
+             &QProgressDialog::canceled,
+             progressDialog,
+             &QProgressDialog::cancel);
+
   pluginItemModel->setObjectName("pluginItemModel");
 
   proxyModel->setObjectName("proxyModel");
@@ -692,7 +906,7 @@ void MainWindow::setupToolBar() {
   gameComboBox->setObjectName("gameComboBox");
   gameComboBox->setSizeAdjustPolicy(QComboBox::AdjustToContents);
 
-  toolBar->addWidget(gameComboBox);
+  gameComboBoxAction = toolBar->addWidget(gameComboBox);
 
   toolBar->addAction(actionSort);
   toolBar->addAction(actionUpdateMasterlist);
@@ -947,6 +1161,12 @@ void MainWindow::enablePluginActions() { menuPlugin->setEnabled(true); }
 
 void MainWindow::disablePluginActions() { menuPlugin->setEnabled(false); }
 
+void MainWindow::setGamesInitialisingState(bool isInitialising) {
+  actionSettings->setDisabled(isInitialising);
+  actionUpdateMasterlists->setDisabled(isInitialising);
+  gameComboBoxAction->setDisabled(isInitialising);
+}
+
 void MainWindow::enterEditingState() {
   actionSettings->setDisabled(true);
   actionUpdateMasterlists->setDisabled(true);
@@ -955,7 +1175,7 @@ void MainWindow::enterEditingState() {
   actionClearAllUserMetadata->setDisabled(true);
   actionEditMetadata->setDisabled(true);
   actionClearMetadata->setDisabled(true);
-  gameComboBox->setDisabled(true);
+  gameComboBoxAction->setDisabled(true);
   actionUpdateMasterlist->setDisabled(true);
   actionSort->setDisabled(true);
 
@@ -971,7 +1191,7 @@ void MainWindow::exitEditingState() {
   actionClearAllUserMetadata->setEnabled(true);
   actionEditMetadata->setEnabled(true);
   actionClearMetadata->setEnabled(true);
-  gameComboBox->setEnabled(true);
+  gameComboBoxAction->setEnabled(true);
   actionUpdateMasterlist->setEnabled(true);
   actionSort->setEnabled(true);
 
@@ -988,7 +1208,7 @@ void MainWindow::enterSortingState() {
 
   actionSettings->setDisabled(true);
   actionUpdateMasterlists->setDisabled(true);
-  gameComboBox->setDisabled(true);
+  gameComboBoxAction->setDisabled(true);
   actionRefreshContent->setDisabled(true);
 }
 
@@ -1001,33 +1221,40 @@ void MainWindow::exitSortingState() {
 
   actionSettings->setDisabled(false);
   actionUpdateMasterlists->setDisabled(false);
-  gameComboBox->setDisabled(false);
+  gameComboBoxAction->setDisabled(false);
   actionRefreshContent->setDisabled(false);
 }
 
 void MainWindow::loadGame(bool isOnLOOTStartup) {
   auto progressUpdater = new ProgressUpdater();
 
-  // This lambda will run from the worker thread.
-  auto sendProgressUpdate = [progressUpdater](std::string message) {
-    emit progressUpdater->progressUpdate(QString::fromStdString(message));
-  };
-
-  std::unique_ptr<Query> query =
-      std::make_unique<GetGameDataQuery>(state->getCurrentGame(),
-                                         state->getSettings().getLanguage(),
-                                         sendProgressUpdate);
+  std::unique_ptr<Query> query = std::make_unique<GetGameDataQuery>(
+      state->getCurrentGame(), state->getSettings().getLanguage());
 
-  const auto handler = isOnLOOTStartup
-                           ? &MainWindow::handleStartupGameDataLoaded
-                           : &MainWindow::handleRefreshGameDataLoaded;
-
-  executeBackgroundQuery(std::move(query), handler, progressUpdater);
+  // This lambda will run from the worker thread.
+  query->setProgressCallback([progressUpdater](const QueryProgress& progress) {
+    progressUpdater->sendProgressUpdate(progress);
+  });
+
+  if (isOnLOOTStartup) {
+    // Startup continues once the game data has loaded, so it can't be
+    // cancelled.
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handleStartupGameDataLoaded,
+                           progressUpdater);
+  } else {
+    executeCancellableBackgroundQuery(std::move(query),
+                                      &MainWindow::handleRefreshGameDataLoaded,
+                                      progressUpdater,
+                                      &MainWindow::handleRefreshCancelled);
+  }
 }
 
 void MainWindow::updateCounts(
     const std::vector<SourcedMessage>& generalMessages,
     const std::vector<PluginItem>& plugins) {
+  UiOperation operation("MainWindow::updateCounts");
+
   const auto counters = GeneralInformationCounters(generalMessages, plugins);
   const auto hiddenMessageCount = pluginItemModel->countHiddenMessages();
   const auto hiddenPluginCount =
@@ -1038,42 +1265,105 @@ void MainWindow::updateCounts(
 }
 
 void MainWindow::updateGeneralInformation() {
-  const auto preludeInfo = getFileRevisionSummary(
-      state->getPaths().getPreludePath(), FileType::MasterlistPrelude);
+  UiOperation operation("MainWindow::updateGeneralInformation");
+
+  fileRevisionsUpdateId += 1;
+
+  // Hashing the masterlist and prelude can be slow, so only use their
+  // revision summaries here if they can be read from their cached metadata,
+  // and otherwise calculate them in the background.
+  const auto preludePath = state->getPaths().getPreludePath();
+  const auto preludeInfo =
+      getCachedFileRevisionSummary(preludePath, FileType::MasterlistPrelude);
   std::vector<SourcedMessage> initMessages = state->getInitMessages();
 
   if (!state->hasCurrentGame()) {
     pluginItemModel->setGeneralInformation(
-        false, false, FileRevisionSummary(), preludeInfo, initMessages);
+        false,
+        false,
+        FileRevisionSummary(),
+        preludeInfo.value_or(FileRevisionSummary()),
+        initMessages);
+
+    if (!preludeInfo.has_value()) {
+      calculateFileRevisionSummaries(std::nullopt, preludePath);
+    }
     return;
   }
 
-  const auto masterlistInfo = getFileRevisionSummary(
-      state->getCurrentGame().getMasterlistPath(), FileType::Masterlist);
-
-  const auto gameMessages = state->getCurrentGame().getMessages(
-      state->getSettings().getLanguage(),
-      state->getSettings().isWarnOnCaseSensitiveGamePathsEnabled());
-  initMessages.insert(
-      initMessages.end(), gameMessages.begin(), gameMessages.end());
+  const auto masterlistPath = state->getCurrentGame().getMasterlistPath();
+  const auto masterlistInfo =
+      getCachedFileRevisionSummary(masterlistPath, FileType::Masterlist);
 
+  // The game's messages are read in the background and added once they're
+  // ready.
+  const auto snapshot = state->getCurrentGame().getSnapshot();
   pluginItemModel->setGeneralInformation(
-      state->getCurrentGame().supportsLightPlugins(),
-      state->getCurrentGame().supportsMediumPlugins(),
-      masterlistInfo,
-      preludeInfo,
+      snapshot->supportsLightPlugins,
+      snapshot->supportsMediumPlugins,
+      masterlistInfo.value_or(FileRevisionSummary()),
+      preludeInfo.value_or(FileRevisionSummary()),
       initMessages);
+
+  updateGeneralMessages();
+
+  if (!masterlistInfo.has_value() || !preludeInfo.has_value()) {
+    calculateFileRevisionSummaries(
+        masterlistInfo.has_value() ? std::nullopt
+                                   : std::make_optional(masterlistPath),
+        preludeInfo.has_value() ? std::nullopt
+                                : std::make_optional(preludePath));
+  }
 }
 
-void MainWindow::updateGeneralMessages() {
-  std::vector<SourcedMessage> initMessages = state->getInitMessages();
-  auto gameMessages = state->getCurrentGame().getMessages(
+void MainWindow::calculateFileRevisionSummaries(
+    const std::optional<std::filesystem::path>& masterlistPath,
+    const std::optional<std::filesystem::path>& preludePath) {
+  using Summaries = std::pair<std::optional<FileRevisionSummary>,
+                              std::optional<FileRevisionSummary>>;
+
+  const auto updateId = fileRevisionsUpdateId;
+
+  // Run on the game worker so that the files and their revision metadata
+  // aren't read while a masterlist update is writing them.
+  QtConcurrent::run(getGameWorker(), [masterlistPath, preludePath]() {
+    TraceSpan span("MainWindow::calculateFileRevisionSummaries");
+
+    Summaries summaries;
+    if (masterlistPath.has_value()) {
+      summaries.first = getFileRevisionSummary(masterlistPath.value(),
+                                               FileType::Masterlist);
+    }
+    if (preludePath.has_value()) {
+      summaries.second = getFileRevisionSummary(preludePath.value(),
+                                                FileType::MasterlistPrelude);
+    }
+
+    return summaries;
+  }).then(this, [this, updateId](const Summaries& summaries) {
+    if (updateId != fileRevisionsUpdateId) {
+      // The general information has been updated again since this
+      // calculation started, so its results may be out of date.
+      return;
+    }
+
+    if (summaries.first.has_value()) {
+      pluginItemModel->setMasterlistRevision(summaries.first.value());
+    }
+    if (summaries.second.has_value()) {
+      pluginItemModel->setPreludeRevision(summaries.second.value());
+    }
+  });
+}
+
+void MainWindow::updateGeneralMessages(
+    void (MainWindow::*onComplete)(QueryResult)) {
+  auto query = std::make_unique<GetGeneralMessagesQuery>(
+      state->getCurrentGame(),
       state->getSettings().getLanguage(),
       state->getSettings().isWarnOnCaseSensitiveGamePathsEnabled());
-  initMessages.insert(
-      initMessages.end(), gameMessages.begin(), gameMessages.end());
 
-  pluginItemModel->setGeneralMessages(std::move(initMessages));
+  executeBackgroundQuery(std::move(query), onComplete, nullptr);
 }
 
 void MainWindow::updateSidebarColumnWidths() {
@@ -1090,7 +1380,7 @@ void MainWindow::updateSidebarColumnWidths() {
   const auto positionSectionWidth =
       state->hasCurrentGame() && state->getCurrentGame().isInitialised()
           ? calculateSidebarPositionSectionWidth(
-                state->getCurrentGame().getPlugins().size())
+                state->getCurrentGame().getSnapshot()->loadedPluginCount)
           : calculateSidebarPositionSectionWidth(
                 DEFAULT_LOAD_ORDER_SIZE_ESTIMATE);
 
@@ -1101,8 +1391,9 @@ void MainWindow::updateSidebarColumnWidths() {
   // to calculate the load order section width because that's one of the games
   // that uses the wider width.
   const auto gameSupportsLightPlugins =
-      state->hasCurrentGame() ? state->getCurrentGame().supportsLightPlugins()
-                              : false;
+      state->hasCurrentGame()
+          ? state->getCurrentGame().getSnapshot()->supportsLightPlugins
+          : false;
   const auto indexSectionWidth =
       calculateSidebarIndexSectionWidth(gameSupportsLightPlugins);
 
@@ -1150,23 +1441,14 @@ void MainWindow::refreshSearch() {
   on_searchDialog_textChanged(searchDialog->getSearchText());
 }
 
-void MainWindow::refreshPluginRawData(const std::string& pluginName) {
-  const auto loadOrder = state->getCurrentGame().getLoadOrder();
+void MainWindow::setPluginRawData(const PluginItem& newPluginItem) {
+  UiOperation operation("MainWindow::setPluginRawData");
 
   for (int i = 1; i < pluginItemModel->rowCount(); i += 1) {
     const auto index = pluginItemModel->index(i, 0);
     const auto pluginItem = index.data(RawDataRole).value<PluginItem>();
 
-    if (pluginItem.name == pluginName) {
-      const auto plugin = state->getCurrentGame().getPlugin(pluginName);
-      const auto newPluginItem = PluginItem(
-          state->getCurrentGame().getSettings().getId(),
-          *plugin,
-          state->getCurrentGame(),
-          state->getCurrentGame().getActiveLoadOrderIndex(*plugin, loadOrder),
-          state->getCurrentGame().isPluginActive(plugin->GetName()),
-          state->getSettings().getLanguage());
-
+    if (pluginItem.name == newPluginItem.name) {
       const auto indexData = QVariant::fromValue(newPluginItem);
       pluginItemModel->setData(index, indexData, RawDataRole);
       break;
@@ -1182,57 +1464,65 @@ bool MainWindow::hasErrorMessages() const {
 }
 
 void MainWindow::sortPlugins(bool isAutoSort) {
+  const CancellationToken token;
+  startCancellableOperation(token);
+
   std::vector<Task*> updateTasks;
 
   if (state->getSettings().isMasterlistUpdateBeforeSortEnabled()) {
-    handleProgressUpdate(qTranslate("Updating and parsing masterlist…"));
-
-    const auto preludeTask = new UpdatePreludeTask(*state);
+    const auto networkSession = std::make_shared<NetworkSession>();
+    const auto preludeTask = new UpdatePreludeTask(*state, networkSession);
+    preludeTask->setCancellationToken(token);
 
     updateTasks.push_back(preludeTask);
 
     const auto masterlistTask =
-        new UpdateMasterlistTask(state->getCurrentGame());
+        new UpdateMasterlistTask(state->getCurrentGame(), networkSession);
+    masterlistTask->setCancellationToken(token);
 
     updateTasks.push_back(masterlistTask);
+
+    connectTaskProgress(
+        updateTasks, qTranslate("Updating and parsing masterlist…"), token);
   }
 
   auto progressUpdater = new ProgressUpdater();
-  connect(progressUpdater,
-          &ProgressUpdater::progressUpdate,
-          this,
-          &MainWindow::handleProgressUpdate);
-
-  // This lambda will run from the worker thread.
-  auto sendProgressUpdate = [progressUpdater](std::string message) {
-    emit progressUpdater->progressUpdate(QString::fromStdString(message));
-  };
+  connectProgressUpdater(progressUpdater, token);
 
   std::unique_ptr<Query> sortPluginsQuery =
       std::make_unique<SortPluginsQuery>(state->getCurrentGame(),
                                          state->getUnappliedChangeCount(),
-                                         state->getSettings().getLanguage(),
-                                         sendProgressUpdate);
+                                         state->getSettings().getLanguage());
+  sortPluginsQuery->setCancellationToken(token);
+
+  // This lambda will run from the worker thread.
+  sortPluginsQuery->setProgressCallback(
+      [progressUpdater](const QueryProgress& progress) {
+        progressUpdater->sendProgressUpdate(progress);
+      });
 
   auto sortTask = new QueryTask(std::move(sortPluginsQuery));
 
   const auto sortHandler = isAutoSort ? &MainWindow::handlePluginsAutoSorted
                                       : &MainWindow::handlePluginsManualSorted;
 
-  auto updatesFuture =
-      whenAllTasks(updateTasks)
-          .then(this,
-                [this](const QList<QFuture<QueryResult>> futures) {
-                  std::vector<QueryResult> results;
-                  for (const auto& future : futures) {
-                    results.push_back(future.result());
-                  }
+  whenAllTasks(updateTasks)
+      .then(this,
+            [this](const QList<QFuture<QueryResult>> futures) {
+              std::vector<QueryResult> results;
+              for (const auto& future : futures) {
+                results.push_back(future.result());
+              }
 
-                  handleMasterlistUpdated(results);
+              handleMasterlistUpdated(results);
+            })
+      .onFailed(this,
+                [this, token](const std::exception& e) {
+                  if (!token.isCancelled()) {
+                    handleError(e.what());
+                  }
                 })
-          .onFailed(this,
-                    [this](const std::exception& e) { handleError(e.what()); })
-          .then(this, [sortTask]() { executeBackgroundTask(sortTask); });
+      .then(this, [sortTask]() { executeBackgroundTask(sortTask); });
 
   auto sortFuture =
       taskFuture(sortTask)
@@ -1241,13 +1531,18 @@ void MainWindow::sortPlugins(bool isAutoSort) {
                   (this->*sortHandler)(result);
                 })
           .onFailed(this,
-                    [this](const std::exception& e) { handleError(e.what()); })
-          .then(this, [this, progressUpdater]() {
+                    [this, token](const std::exception& e) {
+                      if (!token.isCancelled()) {
+                        handleError(e.what());
+                      }
+                    })
+          .then(this, [this, token, progressUpdater]() {
             progressDialog->reset();
+            finishCancellableOperation(token);
             progressUpdater->deleteLater();
           });
 
-  executeConcurrentBackgroundTasks(updateTasks, updatesFuture);
+  executeConcurrentBackgroundTasks(updateTasks);
 }
 
 void MainWindow::showFirstRunDialog() {
@@ -1348,7 +1643,39 @@ PluginItem MainWindow::getSelectedPlugin() const {
   return indexData.value<PluginItem>();
 }
 
+bool MainWindow::eventFilter(QObject* watched, QEvent* event) {
+  if (watched == progressDialog) {
+    if (event->type() == QEvent::Show) {
+      operationConflictingActions->setEnabled(false);
+    } else if (event->type() == QEvent::Hide) {
+      updateOperationConflictingActions();
+    }
+  }
+
+  return QMainWindow::eventFilter(watched, event);
+}
+
+void MainWindow::startBackgroundOperation() { runningOperationCount += 1; }
+
+void MainWindow::finishBackgroundOperation() {
+  runningOperationCount -= 1;
+
+  updateOperationConflictingActions();
+}
+
+void MainWindow::updateOperationConflictingActions() {
+  // The progress dialog may be hidden before its operation has stopped (e.g.
+  // if it was cancelled by closing the dialog), so also wait for all running
+  // operations to finish.
+  if (progressDialog->isHidden() && runningOperationCount == 0) {
+    operationConflictingActions->setEnabled(true);
+  }
+}
+
 void MainWindow::closeEvent(QCloseEvent* event) {
+  // Settings are saved below, so wait for startup to stop changing them.
+  gamesInitialisation.waitForFinished();
+
   if (state->getUnappliedChangeCount().isNonZero()) {
     auto changeType = pluginEditorWidget->isVisible()
                           ? translate("metadata edits")
@@ -1416,6 +1743,27 @@ void MainWindow::closeEvent(QCloseEvent* event) {
     }
   }
 
+  try {
+    if (state->hasCurrentGame()) {
+      // Stop any running operation, and flush once the game worker is done
+      // with the game.
+      if (cancellationToken.has_value()) {
+        cancellationToken.value().cancel();
+      }
+
+      auto& game = state->getCurrentGame();
+      QtConcurrent::run(getGameWorker(), [&game]() {
+        game.flushUserMetadata();
+      }).waitForFinished();
+    }
+  } catch (const std::exception& e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to save the current game's userlist: {}",
+                    e.what());
+    }
+  }
+
   try {
     writeOldMessages(state->getCurrentGame().getOldMessagesPath(),
                      pluginItemModel->getCurrentMessages());
@@ -1451,6 +1799,8 @@ void MainWindow::executeBackgroundQuery(
             &MainWindow::handleProgressUpdate);
   }
 
+  startBackgroundOperation();
+
   loot::executeBackgroundQuery(std::move(query))
       .then(this,
             [this, onComplete](QueryResult result) {
@@ -1458,13 +1808,123 @@ void MainWindow::executeBackgroundQuery(
             })
       .onFailed(this,
                 [this](const std::exception& e) { handleError(e.what()); })
-      .then(this, [progressUpdater]() {
+      .then(this, [this, progressUpdater]() {
+        finishBackgroundOperation();
+
+        if (progressUpdater) {
+          progressUpdater->deleteLater();
+        }
+      });
+}
+
+void MainWindow::executeCancellableBackgroundQuery(
+    std::unique_ptr<Query> query,
+    void (MainWindow::*onComplete)(QueryResult),
+    ProgressUpdater* progressUpdater,
+    void (MainWindow::*onCancelled)()) {
+  const CancellationToken token;
+  startCancellableOperation(token);
+  query->setCancellationToken(token);
+
+  if (progressUpdater != nullptr) {
+    connectProgressUpdater(progressUpdater, token);
+  }
+
+  loot::executeBackgroundQuery(std::move(query))
+      .then(this,
+            [this, onComplete](QueryResult result) {
+              (this->*onComplete)(result);
+            })
+      .onFailed(this,
+                [this, token, onCancelled](const std::exception& e) {
+                  if (!token.isCancelled()) {
+                    handleError(e.what());
+                  } else if (onCancelled != nullptr) {
+                    (this->*onCancelled)();
+                  }
+                })
+      .then(this, [this, token, progressUpdater]() {
+        finishCancellableOperation(token);
+
         if (progressUpdater) {
           progressUpdater->deleteLater();
         }
       });
 }
 
+void MainWindow::startCancellableOperation(const CancellationToken& token) {
+  startBackgroundOperation();
+
+  cancellationToken = token;
+
+  // The dialog takes ownership of the button and deletes it when it's
+  // replaced.
+  progressCancelButton = new QPushButton(qTranslate("Cancel"));
+  progressDialog->setCancelButton(progressCancelButton);
+  progressDialog->adjustSize();
+}
+
+void MainWindow::finishCancellableOperation(const CancellationToken& token) {
+  // Count the operation as finished before resetting the dialog, so that
+  // hiding it re-enables the actions that conflict with it.
+  runningOperationCount -= 1;
+
+  // If the operation was cancelled by closing the progress dialog, another
+  // operation may have started before this one stopped.
+  if (!cancellationToken.has_value() || !(cancellationToken.value() == token)) {
+    updateOperationConflictingActions();
+    return;
+  }
+
+  if (token.isCancelled()) {
+    progressDialog->reset();
+  }
+
+  cancellationToken.reset();
+  progressCancelButton = nullptr;
+  progressDialog->setCancelButton(nullptr);
+
+  updateOperationConflictingActions();
+}
+
+void MainWindow::connectProgressUpdater(ProgressUpdater* progressUpdater,
+                                        const CancellationToken& token) {
+  // Once cancelled, ignore the operation's progress so that it doesn't replace
+  // the cancellation message or reopen the dialog.
+  connect(progressUpdater,
+          &ProgressUpdater::progressUpdate,
+          this,
+          [this, token](const QString& message, int completed, int total) {
+            if (!token.isCancelled()) {
+              handleProgressUpdate(message, completed, total);
+            }
+          });
+}
+
+void MainWindow::connectTaskProgress(const std::vector<Task*>& tasks,
+                                     const QString& stage,
+                                     const CancellationToken& token) {
+  const auto total = static_cast<int>(tasks.size());
+  const auto completed = std::make_shared<int>(0);
+
+  for (const auto task : tasks) {
+    connect(task,
+            &Task::finished,
+            this,
+            [this, stage, token, total, completed]() {
+              *completed += 1;
+
+              // The last task to finish ends the stage, and the dialog is then
+              // reset or given a new stage, so don't show its progress.
+              if (*completed < total && !token.isCancelled()) {
+                handleProgressUpdate(stage, *completed, total);
+              }
+            });
+  }
+
+  handleProgressUpdate(stage, 0, total);
+}
+
 void MainWindow::handleError(const std::string& message) {
   progressDialog->reset();
 
@@ -1486,17 +1946,19 @@ void MainWindow::handleException(const std::exception& exception) {
   handleError(message);
 }
 
-void MainWindow::handleQueryException(const Query& query,
-                                      const std::exception& exception) {
-  auto logger = getLogger();
-  if (logger) {
-    logger->error("Caught an exception: {}", exception.what());
-  }
+void MainWindow::handleUserlistWriteError(const std::string& message) {
+  // This doesn't reset the progress dialog, as the write happens in the
+  // background and may fail while another operation is running.
+  const auto text = fmt::format(
+      translate("Your metadata changes could not be saved: {0}"), message);
 
-  handleError(query.getErrorMessage());
+  QMessageBox::critical(
+      this, qTranslate("Error"), QString::fromStdString(text));
 }
 
 void MainWindow::handleGameDataLoaded(QueryResult result) {
+  UiOperation operation("MainWindow::handleGameDataLoaded");
+
   progressDialog->reset();
 
   pluginItemModel->setPluginItems(std::move(std::get<PluginItems>(result)));
@@ -1505,12 +1967,13 @@ void MainWindow::handleGameDataLoaded(QueryResult result) {
 
   updateGeneralInformation();
 
-  filtersWidget->setGroups(GetGroupNames(state->getCurrentGame()));
+  const auto snapshot = state->getCurrentGame().getSnapshot();
+
+  filtersWidget->setGroups(snapshot->groupNames);
   filtersWidget->showCreationClubPluginsFilter(
       hadCreationClub(state->getCurrentGame().getSettings().getId()));
 
-  pluginEditorWidget->setBashTagCompletions(
-      state->getCurrentGame().getKnownBashTags());
+  pluginEditorWidget->setBashTagCompletions(snapshot->knownBashTags);
 
   enableGameActions();
 }
@@ -1535,9 +1998,8 @@ bool MainWindow::handlePluginsSorted(QueryResult result) {
     return false;
   }
 
-  auto currentLoadOrder = state->getCurrentGame().getLoadOrder();
-  const auto loadOrderHasChanged =
-      hasLoadOrderChanged(currentLoadOrder, sortedPlugins);
+  const auto loadOrderHasChanged = hasLoadOrderChanged(
+      state->getCurrentGame().getSnapshot()->loadOrder, sortedPlugins);
 
   if (loadOrderHasChanged) {
     enterSortingState();
@@ -1566,30 +2028,22 @@ QMenu* MainWindow::createPopupMenu() {
   return filteredMenu;
 }
 
-std::optional<std::filesystem::path> MainWindow::createBackup() {
-  auto backupBasename =
+std::filesystem::path MainWindow::getNewBackupPath() const {
+  auto backupFilename =
       "LOOT-backup-" +
-      QDateTime::currentDateTime().toString("yyyyMMddThhmmss").toStdString();
-
-  auto sourceDir = state->getPaths().getLootDataPath();
-  auto destDir =
-      state->getPaths().getLootDataPath() / "backups" / backupBasename;
-
-  loot::createBackup(sourceDir, destDir);
-
-  if (!std::filesystem::exists(destDir)) {
-    return std::nullopt;
-  }
-
-  auto zipPath = compressDirectory(destDir);
+      QDateTime::currentDateTime().toString("yyyyMMddThhmmss").toStdString() +
+      ".zip";
 
-  std::filesystem::remove_all(destDir);
+  return state->getPaths().getLootDataPath() / "backups" / backupFilename;
+}
 
-  return zipPath;
+std::optional<std::filesystem::path> MainWindow::createBackup() {
+  return loot::createBackup(state->getPaths().getLootDataPath(),
+                            getNewBackupPath());
 }
 
 void MainWindow::checkForAmbiguousLoadOrder() {
-  if (!state->getCurrentGame().isLoadOrderAmbiguous()) {
+  if (!state->getCurrentGame().getSnapshot()->isLoadOrderAmbiguous) {
     actionFixAmbiguousLoadOrder->setEnabled(false);
     return;
   }
@@ -1630,6 +2084,50 @@ void MainWindow::refreshGamesDropdown() {
   }
 }
 
+void MainWindow::revalidateInstalledGames() {
+  // Games were detected using cached store scan results, so wait for them to
+  // be revalidated without holding up the game worker, then detect games
+  // again if any stores have changed.
+  QtConcurrent::run([this]() { return state->waitForStoreRevalidation(); })
+      .then(this,
+            [this](std::optional<StoreGameInstalls> storeInstalls) {
+              if (!storeInstalls.has_value()) {
+                return;
+              }
+
+              // Run the update as a query like any other change to the
+              // games, so that it doesn't overlap with them and the UI
+              // doesn't start any while it runs.
+              auto progressUpdater = new ProgressUpdater();
+
+              std::unique_ptr<Query> query =
+                  std::make_unique<UpdateInstalledGamesQuery>(
+                      *state, std::move(storeInstalls.value()));
+
+              // This lambda will run from the worker thread.
+              query->setProgressCallback(
+                  [progressUpdater](const QueryProgress& progress) {
+                    progressUpdater->sendProgressUpdate(progress);
+                  });
+
+              executeBackgroundQuery(std::move(query),
+                                     &MainWindow::handleInstalledGamesUpdated,
+                                     progressUpdater);
+            })
+      .onFailed(this,
+                [this](const std::exception& e) { handleException(e); });
+}
+
+void MainWindow::handleInstalledGamesUpdated(QueryResult) {
+  try {
+    progressDialog->reset();
+
+    refreshGamesDropdown();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::setHiddenMessages(
     const std::vector<HiddenMessage>& hiddenMessages) {
   state->getCurrentGame().getSettings().setHiddenMessages(hiddenMessages);
@@ -1667,9 +2165,16 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
     const auto preludeSource = state->getSettings().getPreludeSource();
     const auto preludePath = state->getPaths().getPreludePath();
 
+    const CancellationToken token;
+
     std::vector<Task*> tasks;
 
-    const auto preludeTask = new UpdatePreludeTask(*state);
+    // Share a network session between all the tasks so that they reuse
+    // connections, and so that games with the same masterlist source only
+    // download it once.
+    const auto networkSession = std::make_shared<NetworkSession>();
+    const auto preludeTask = new UpdatePreludeTask(*state, networkSession);
+    preludeTask->setCancellationToken(token);
 
     tasks.push_back(preludeTask);
 
@@ -1680,28 +2185,35 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
       const auto task = new UpdateMasterlistTask(
           settings.getFolderName(),
           settings.getMasterlistSource(),
-          getMasterlistPath(state->getPaths().getLootDataPath(), settings));
+          getMasterlistPath(state->getPaths().getLootDataPath(), settings),
+          networkSession);
+      task->setCancellationToken(token);
 
       tasks.push_back(task);
     }
 
-    handleProgressUpdate(qTranslate("Updating all masterlists…"));
-
-    auto whenAll = whenAllTasks(tasks)
-                       .then(this,
-                             [this](const QList<QFuture<QueryResult>> futures) {
-                               std::vector<QueryResult> results;
-                               for (const auto& future : futures) {
-                                 results.push_back(future.result());
-                               }
-
-                               handleMasterlistsUpdated(results);
-                             })
-                       .onFailed(this, [this](const std::exception& e) {
-                         handleError(e.what());
-                       });
+    startCancellableOperation(token);
+    connectTaskProgress(tasks, qTranslate("Updating all masterlists…"), token);
+
+    whenAllTasks(tasks)
+        .then(this,
+              [this](const QList<QFuture<QueryResult>> futures) {
+                std::vector<QueryResult> results;
+                for (const auto& future : futures) {
+                  results.push_back(future.result());
+                }
+
+                handleMasterlistsUpdated(results);
+              })
+        .onFailed(this,
+                  [this, token](const std::exception& e) {
+                    if (!token.isCancelled()) {
+                      handleError(e.what());
+                    }
+                  })
+        .then(this, [this, token]() { finishCancellableOperation(token); });
 
-    executeConcurrentBackgroundTasks(tasks, whenAll);
+    executeConcurrentBackgroundTasks(tasks);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1709,23 +2221,72 @@ void MainWindow::on_actionUpdateMasterlists_triggered() {
 
 void MainWindow::on_actionBackupData_triggered() {
   try {
-    auto zipPath = createBackup();
+    const auto sourceDir = state->getPaths().getLootDataPath();
+    const auto archivePath = getNewBackupPath();
 
-    if (zipPath.has_value()) {
-      auto zipPathString = zipPath.value().u8string();
-      auto link = "<pre><a href=\"file:" + zipPathString +
-                  "\" style=\"white-space: nowrap\">" + zipPathString +
-                  "</a></pre>";
-      auto message = fmt::format(
-          translate("Your LOOT data has been backed up to: {0}"), link);
+    const auto game =
+        state->hasCurrentGame() ? &state->getCurrentGame() : nullptr;
 
-      QMessageBox::information(this, "LOOT", QString::fromStdString(message));
-    } else {
-      auto message = qTranslate(
-          "No backup has been created as LOOT has no data to backup.");
+    auto progressUpdater = new ProgressUpdater();
+    connect(progressUpdater,
+            &ProgressUpdater::progressUpdate,
+            this,
+            &MainWindow::handleProgressUpdate);
 
-      QMessageBox::information(this, "LOOT", message);
-    }
+    // This lambda will run from the worker thread.
+    auto sendProgressUpdate = [progressUpdater](size_t filesBackedUp,
+                                                size_t totalFiles) {
+      const auto message =
+          fmt::format(translate("Backing up LOOT data ({0}/{1} files)…"),
+                      filesBackedUp,
+                      totalFiles);
+      emit progressUpdater->progressUpdate(QString::fromStdString(message),
+                                           static_cast<int>(filesBackedUp),
+                                           static_cast<int>(totalFiles));
+    };
+
+    actionBackupData->setDisabled(true);
+
+    // Run on the game worker so that the backup doesn't copy files while
+    // queries are writing them.
+    QtConcurrent::run(
+        getGameWorker(),
+        [game, sourceDir, archivePath, sendProgressUpdate]() {
+          // Make sure the backed-up userlist includes all metadata edits.
+          if (game != nullptr) {
+            game->flushUserMetadata();
+          }
+
+          return loot::createBackup(sourceDir, archivePath, sendProgressUpdate);
+        })
+        .then(this,
+              [this](const std::optional<std::filesystem::path>& zipPath) {
+                progressDialog->reset();
+
+                if (zipPath.has_value()) {
+                  auto zipPathString = zipPath.value().u8string();
+                  auto link = "<pre><a href=\"file:" + zipPathString +
+                              "\" style=\"white-space: nowrap\">" +
+                              zipPathString + "</a></pre>";
+                  auto message = fmt::format(
+                      translate("Your LOOT data has been backed up to: {0}"),
+                      link);
+
+                  QMessageBox::information(
+                      this, "LOOT", QString::fromStdString(message));
+                } else {
+                  auto message = qTranslate(
+                      "No backup has been created as LOOT has no data to "
+                      "backup.");
+
+                  QMessageBox::information(this, "LOOT", message);
+                }
+              })
+        .onFailed(this, [this](const std::exception& e) { handleException(e); })
+        .then(this, [this, progressUpdater]() {
+          actionBackupData->setEnabled(true);
+          progressUpdater->deleteLater();
+        });
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1736,17 +2297,18 @@ void MainWindow::on_actionQuit_triggered() { this->close(); }
 void MainWindow::on_actionOpenGroupsEditor_triggered() {
   try {
     std::set<std::string> installedPluginGroups;
-    for (const auto& plugin : pluginItemModel->getPluginItems()) {
-      if (plugin.group.has_value()) {
-        installedPluginGroups.insert(plugin.group.value());
-      }
+    for (const auto& [group, pluginIndices] :
+         pluginItemModel->getPluginIndicesByGroup()) {
+      installedPluginGroups.insert(group);
     }
 
     const auto groupNodePositions = loadGroupNodePositions(
         state->getCurrentGame().getGroupNodePositionsPath());
 
-    groupsEditor->setGroups(state->getCurrentGame().getMasterlistGroups(),
-                            state->getCurrentGame().getUserGroups(),
+    const auto snapshot = state->getCurrentGame().getSnapshot();
+
+    groupsEditor->setGroups(snapshot->masterlistGroups,
+                            snapshot->userGroups,
                             installedPluginGroups,
                             groupNodePositions);
 
@@ -1759,22 +2321,28 @@ void MainWindow::on_actionOpenGroupsEditor_triggered() {
 void MainWindow::on_actionSearch_triggered() { searchDialog->show(); }
 
 void MainWindow::on_actionCopyLoadOrder_triggered() {
+  UiOperation operation("MainWindow::on_actionCopyLoadOrder_triggered");
+
   try {
-    const auto text = actionApplySort->isVisible()
-                          ? state->getCurrentGame().getLoadOrderAsTextTable(
-                                pluginItemModel->getPluginNames())
-                          : state->getCurrentGame().getLoadOrderAsTextTable();
+    // While sorting, copy the sorted load order instead of the current one.
+    auto loadOrder =
+        actionApplySort->isVisible()
+            ? std::make_optional(pluginItemModel->getPluginNames())
+            : std::nullopt;
 
-    copyToClipboard(text);
+    auto query = std::make_unique<GetLoadOrderTextQuery>(
+        state->getCurrentGame(), std::move(loadOrder));
 
-    showNotification(
-        qTranslate("The load order has been copied to the clipboard."));
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleLoadOrderTextLoaded, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
 void MainWindow::on_actionCopyContent_triggered() {
+  UiOperation operation("MainWindow::on_actionCopyContent_triggered");
+
   try {
     auto content =
         pluginItemModel->getGeneralInfo().getMarkdownContent() + "\n\n";
@@ -1804,12 +2372,11 @@ void MainWindow::on_actionBackUpLoadOrder_triggered() {
 
 void MainWindow::on_actionRestoreLoadOrder_triggered() {
   try {
-    const auto backups = state->getCurrentGame().findLoadOrderBackups();
-    restoreBackupDialog->setCurrentLoadOrder(
-        state->getCurrentGame().getLoadOrder());
-    restoreBackupDialog->setLoadOrderBackups(backups);
-    restoreBackupDialog->open();
+    auto query =
+        std::make_unique<GetLoadOrderBackupsQuery>(state->getCurrentGame());
 
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleLoadOrderBackupsFound, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1817,17 +2384,12 @@ void MainWindow::on_actionRestoreLoadOrder_triggered() {
 
 void MainWindow::on_actionFixAmbiguousLoadOrder_triggered() {
   try {
-    auto loadOrder = state->getCurrentGame().getLoadOrder();
-    state->getCurrentGame().setLoadOrder(loadOrder);
+    auto loadOrder = state->getCurrentGame().getSnapshot()->loadOrder;
+    auto query = std::make_unique<SetLoadOrderQuery>(state->getCurrentGame(),
+                                                     std::move(loadOrder));
 
-    showNotification(
-        qTranslate("The load order displayed by LOOT has been set."));
-
-    if (state->getCurrentGame().isLoadOrderAmbiguous()) {
-      showAmbiguousLoadOrderSetWarning(this, *state);
-    } else {
-      actionFixAmbiguousLoadOrder->setEnabled(false);
-    }
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleAmbiguousLoadOrderSet, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1886,10 +2448,11 @@ void MainWindow::on_actionRedatePlugins_triggered() {
         QMessageBox::StandardButton::No);
 
     if (button == QMessageBox::StandardButton::Yes) {
-      state->getCurrentGame().redatePlugins();
-      showNotification(
-          /* translators: Notification text. */
-          qTranslate("Plugins were successfully redated."));
+      auto query =
+          std::make_unique<RedatePluginsQuery>(state->getCurrentGame());
+
+      executeBackgroundQuery(
+          std::move(query), &MainWindow::handlePluginsRedated, nullptr);
     }
   } catch (const std::exception& e) {
     handleException(e);
@@ -1910,46 +2473,11 @@ void MainWindow::on_actionClearAllUserMetadata_triggered() {
       return;
     }
 
-    ClearAllMetadataQuery query(state->getCurrentGame(),
-                                state->getSettings().getLanguage());
-
-    auto result = query.executeLogic();
-
-    // Clearing all user metadata can clear general messages (though
-    // user-defined general messages aren't editable through the LOOT GUI),
-    // change the known Bash Tags (though again they aren't editable in the GUI)
-    // and change plugin metadata that may be displayed in the sidebar or on
-    // cards. However, only plugins that had user metadata are affected, which
-    // is probably a small fraction of the total number, so doing a full refresh
-    // of the game-related UI would be overkill.
-
-    filtersWidget->setGroups(GetGroupNames(state->getCurrentGame()));
-
-    pluginEditorWidget->setBashTagCompletions(
-        state->getCurrentGame().getKnownBashTags());
-
-    updateGeneralMessages();
-
-    // These plugin items are only those that had their user metadata removed.
-    const auto& pluginItems = std::get<PluginItems>(result);
-
-    // For each item, find its existing index in the model and update its data.
-    // The sidebar item and card will be updated by handling the resulting
-    // dataChanged signal.
-    auto nameToRowMap = pluginItemModel->getPluginNameToRowMap();
-    for (const auto& item : pluginItems) {
-      const auto it = nameToRowMap.find(item.name);
-      if (it == nameToRowMap.end()) {
-        throw std::runtime_error(std::string("Could not find plugin named \"") +
-                                 item.name + "\" in the plugin item model.");
-      }
-
-      // It doesn't matter which index column is used, it's the same data.
-      const auto index = pluginItemModel->index(it->second, 0);
-      pluginItemModel->setData(index, QVariant::fromValue(item), RawDataRole);
-    }
+    auto query = std::make_unique<ClearAllMetadataQuery>(
+        state->getCurrentGame(), state->getSettings().getLanguage());
 
-    showNotification(qTranslate("All user-added metadata has been cleared."));
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleAllUserMetadataCleared, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -1968,41 +2496,12 @@ void MainWindow::on_actionEditMetadata_triggered() {
     }
 
     const std::string selectedPluginName = getSelectedPlugin().name;
-    const auto groups = GetGroupNames(state->getCurrentGame());
-
-    pluginEditorWidget->initialiseInputs(
-        groups,
-        selectedPluginName,
-        state->getCurrentGame().getNonUserMetadata(
-            *state->getCurrentGame().getPlugin(selectedPluginName)),
-        state->getCurrentGame().getUserMetadata(selectedPluginName));
-
-    pluginEditorWidget->show();
-
-    state->getUnappliedChangeCount().increment();
-
-    // Refresh the sidebar items so that all their groups are displayed.
-    pluginItemModel->setEditorPluginName(selectedPluginName);
 
-    enterEditingState();
-
-    // Scroll the sidebar and cards lists to the plugin being edited.
-    const auto sidebarIndex = getSelectedPluginIndex();
-    const auto cardIndex =
-        sidebarIndex.siblingAtColumn(PluginItemModel::CARDS_COLUMN);
+    auto query = std::make_unique<GetPluginMetadataQuery>(
+        state->getCurrentGame(), selectedPluginName);
 
-    // Use a timeout of 1 ms so that scrolling is done after the widget is
-    // actually opened by Qt's event loop. Use 1 instead of 0 because the
-    // ordering between zero timers and other event sources is undefined.
-    QTimer::singleShot(1, [=]() {
-      try {
-        sidebarPluginsView->scrollTo(sidebarIndex,
-                                     QAbstractItemView::PositionAtTop);
-        pluginCardsView->scrollTo(cardIndex, QAbstractItemView::PositionAtTop);
-      } catch (const std::exception& e) {
-        handleException(e);
-      }
-    });
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handlePluginMetadataLoaded, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2012,23 +2511,12 @@ void MainWindow::on_actionCopyMetadata_triggered() {
   try {
     const std::string selectedPluginName = getSelectedPlugin().name;
 
-    const auto text =
-        getMetadataAsBBCodeYaml(state->getCurrentGame(), selectedPluginName);
-
-    copyToClipboard(text);
-
-    const auto logger = getLogger();
-    if (logger) {
-      logger->debug("Exported userlist metadata text for \"{}\": {}",
-                    selectedPluginName,
-                    text);
-    }
-
-    const auto message = fmt::format(
-        translate("The metadata for \"{0}\" has been copied to the clipboard."),
-        selectedPluginName);
+    auto query = std::make_unique<GetPluginMetadataTextQuery>(
+        state->getCurrentGame(), selectedPluginName);
 
-    showNotification(QString::fromStdString(message));
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handlePluginMetadataTextLoaded,
+                           nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2105,33 +2593,13 @@ void MainWindow::on_actionClearMetadata_triggered() {
       return;
     }
 
-    ClearPluginMetadataQuery query(state->getCurrentGame(),
-                                   state->getSettings().getLanguage(),
-                                   selectedPluginName);
-
-    auto result = query.executeLogic();
-
-    // The result is the changed plugin's derived metadata. Update the
-    // model's data and also the message counts.
-
-    const auto& newPluginItem = std::get<PluginItem>(result);
-
-    for (int i = 1; i < pluginItemModel->rowCount(); i += 1) {
-      const auto index = pluginItemModel->index(i, 0);
-      auto pluginItem = index.data(RawDataRole).value<PluginItem>();
-
-      if (pluginItem.name == selectedPluginName) {
-        pluginItemModel->setData(
-            index, QVariant::fromValue(newPluginItem), RawDataRole);
-        break;
-      }
-    }
-
-    auto notificationText = fmt::format(
-        translate("The user-added metadata for \"{0}\" has been cleared."),
+    auto query = std::make_unique<ClearPluginMetadataQuery>(
+        state->getCurrentGame(),
+        state->getSettings().getLanguage(),
         selectedPluginName);
 
-    showNotification(QString::fromStdString(notificationText));
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handlePluginMetadataCleared, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2254,16 +2722,16 @@ void MainWindow::on_gameComboBox_activated(int index) {
 
     auto progressUpdater = new ProgressUpdater();
 
-    // This lambda will run from the worker thread.
-    auto sendProgressUpdate = [progressUpdater](std::string message) {
-      emit progressUpdater->progressUpdate(QString::fromStdString(message));
-    };
-
     std::unique_ptr<Query> query =
         std::make_unique<ChangeGameQuery>(*state,
                                           state->getSettings().getLanguage(),
-                                          std::move(folderName),
-                                          sendProgressUpdate);
+                                          std::move(folderName));
+
+    // This lambda will run from the worker thread.
+    query->setProgressCallback(
+        [progressUpdater](const QueryProgress& progress) {
+          progressUpdater->sendProgressUpdate(progress);
+        });
 
     executeBackgroundQuery(
         std::move(query), &MainWindow::handleGameChanged, progressUpdater);
@@ -2284,23 +2752,13 @@ void MainWindow::on_actionApplySort_triggered() {
   try {
     auto sortedPluginNames = pluginItemModel->getPluginNames();
 
-    auto query = ApplySortQuery(state->getCurrentGame(),
-                                state->getUnappliedChangeCount(),
-                                sortedPluginNames);
-
-    try {
-      query.executeLogic();
-
-      exitSortingState();
-
-      if (state->getCurrentGame().isLoadOrderAmbiguous()) {
-        actionFixAmbiguousLoadOrder->setEnabled(true);
+    auto query = std::make_unique<ApplySortQuery>(
+        state->getCurrentGame(),
+        state->getUnappliedChangeCount(),
+        sortedPluginNames);
 
-        showAmbiguousLoadOrderSetWarning(this, *state);
-      }
-    } catch (const std::exception& e) {
-      handleQueryException(query, e);
-    }
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleSortApplied, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2308,40 +2766,11 @@ void MainWindow::on_actionApplySort_triggered() {
 
 void MainWindow::on_actionDiscardSort_triggered() {
   try {
-    auto query = CancelSortQuery(state->getCurrentGame(),
-                                 state->getUnappliedChangeCount());
-
-    auto result = query.executeLogic();
-
-    const auto& pluginItems = pluginItemModel->getPluginItems();
-
-    std::vector<PluginItem> newPluginItems;
-    newPluginItems.reserve(pluginItems.size());
-    for (const auto& pluginPair : std::get<CancelSortResult>(result)) {
-      const auto& pluginName = pluginPair.first;
-
-      auto it = std::find_if(pluginItems.cbegin(),
-                             pluginItems.cend(),
-                             [&](const auto& pluginItem) {
-                               return pluginItem.name == pluginName;
-                             });
-
-      if (it != pluginItems.end()) {
-        PluginItem newPluginItem = *it;
-        newPluginItem.loadOrderIndex = pluginPair.second;
-        newPluginItems.push_back(newPluginItem);
-      }
-    }
-
-    pluginItemModel->setPluginItems(std::move(newPluginItems));
-
-    updateGeneralMessages();
-
-    exitSortingState();
+    auto query = std::make_unique<CancelSortQuery>(
+        state->getCurrentGame(), state->getUnappliedChangeCount());
 
-    // Perform ambiguous load order check because load order state was refreshed
-    // at start of sorting.
-    checkForAmbiguousLoadOrder();
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleSortDiscarded, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2349,28 +2778,38 @@ void MainWindow::on_actionDiscardSort_triggered() {
 
 void MainWindow::on_actionUpdateMasterlist_triggered() {
   try {
-    handleProgressUpdate(qTranslate("Updating and parsing masterlist…"));
+    const CancellationToken token;
+    startCancellableOperation(token);
 
-    const auto preludeTask = new UpdatePreludeTask(*state);
+    const auto networkSession = std::make_shared<NetworkSession>();
+    const auto preludeTask = new UpdatePreludeTask(*state, networkSession);
+    preludeTask->setCancellationToken(token);
     const auto masterlistTask =
-        new UpdateMasterlistTask(state->getCurrentGame());
+        new UpdateMasterlistTask(state->getCurrentGame(), networkSession);
+    masterlistTask->setCancellationToken(token);
 
     const std::vector<Task*> tasks{preludeTask, masterlistTask};
 
-    auto whenAll =
-        whenAllTasks(tasks)
-            .then(this,
-                  [this](const QList<QFuture<QueryResult>> futures) {
-                    auto preludeResult = futures[0].result();
-                    auto masterlistResult = futures[1].result();
-
-                    handleMasterlistUpdated({preludeResult, masterlistResult});
+    connectTaskProgress(
+        tasks, qTranslate("Updating and parsing masterlist…"), token);
+
+    whenAllTasks(tasks)
+        .then(this,
+              [this](const QList<QFuture<QueryResult>> futures) {
+                auto preludeResult = futures[0].result();
+                auto masterlistResult = futures[1].result();
+
+                handleMasterlistUpdated({preludeResult, masterlistResult});
+              })
+        .onFailed(this,
+                  [this, token](const std::exception& e) {
+                    if (!token.isCancelled()) {
+                      handleError(e.what());
+                    }
                   })
-            .onFailed(this, [this](const std::exception& e) {
-              handleError(e.what());
-            });
+        .then(this, [this, token]() { finishCancellableOperation(token); });
 
-    executeConcurrentBackgroundTasks(tasks, whenAll);
+    executeConcurrentBackgroundTasks(tasks);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2475,11 +2914,16 @@ void MainWindow::on_pluginCardsView_customContextMenuRequested(
 void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
                                                 const QModelIndex& bottomRight,
                                                 const QList<int>& roles) {
+  UiOperation operation("MainWindow::on_pluginItemModel_dataChanged");
+
   if (!topLeft.isValid() || !bottomRight.isValid()) {
     return;
   }
 
-  cardSizingCache.update(topLeft, bottomRight);
+  {
+    UiOperation cardSizingOperation("CardSizingCache::update");
+    cardSizingCache.update(topLeft, bottomRight);
+  }
 
   if (roles.isEmpty() || roles.contains(FilteredContentRole)) {
     proxyModel->invalidate();
@@ -2493,51 +2937,37 @@ void MainWindow::on_pluginItemModel_dataChanged(const QModelIndex& topLeft,
   }
 
   if (roles.isEmpty() || roles.contains(RawDataRole)) {
-    // Also update the plugin name lists in the filters sidebar panel and the
+    // Also update the plugin names used by the filters sidebar panel and the
     // metadata editor's autocompletions in case raw data changed because the
-    // game was changed or content was refreshed.
+    // game was changed or content was refreshed. The overlap filter lists
+    // plugins in load order, while the autocompletions are sorted, and
+    // neither changes unless the plugin names do.
     auto pluginNames = pluginItemModel->getPluginNames();
 
     filtersWidget->setPlugins(pluginNames);
-    pluginEditorWidget->setFilenameCompletions(pluginNames);
+    pluginNameCompletions->setCompletions(pluginNames);
   }
 }
 
 void MainWindow::on_pluginItemModel_rowsInserted(const QModelIndex&,
                                                  int first,
                                                  int last) {
+  UiOperation operation("CardSizingCache::update");
+
   cardSizingCache.update(pluginItemModel, first, last);
 }
 
 void MainWindow::on_pluginEditorWidget_accepted(PluginMetadata userMetadata) {
-  try {
-    auto logger = getLogger();
-    auto pluginName = userMetadata.GetName();
-
-    // Erase any existing userlist entry.
-    if (logger) {
-      logger->trace("Erasing the existing userlist entry.");
-    }
-    state->getCurrentGame().clearUserMetadata(pluginName);
-
-    // Add a new userlist entry if necessary.
-    if (!userMetadata.HasNameOnly()) {
-      if (logger) {
-        logger->trace("Adding new metadata to new userlist entry.");
-      }
-      state->getCurrentGame().addUserMetadata(userMetadata);
-    }
-
-    // Save edited userlist.
-    state->getCurrentGame().saveUserMetadata();
-
-    pluginItemModel->setEditorPluginName(std::nullopt);
-
-    refreshPluginRawData(pluginName);
+  UiOperation operation("MainWindow::on_pluginEditorWidget_accepted");
 
-    state->getUnappliedChangeCount().decrement();
+  try {
+    auto query = std::make_unique<SetPluginMetadataQuery>(
+        state->getCurrentGame(),
+        state->getSettings().getLanguage(),
+        std::move(userMetadata));
 
-    exitEditingState();
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handlePluginMetadataSet, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2570,13 +3000,24 @@ void MainWindow::on_filtersWidget_overlapFilterChanged(
 
     handleProgressUpdate(qTranslate("Identifying overlapping plugins…"));
 
+    auto progressUpdater = new ProgressUpdater();
+
     std::unique_ptr<Query> query = std::make_unique<GetOverlappingPluginsQuery>(
         state->getCurrentGame(),
         state->getSettings().getLanguage(),
         targetPluginName.value());
 
-    executeBackgroundQuery(
-        std::move(query), &MainWindow::handleOverlapFilterChecked, nullptr);
+    // This lambda will run from the worker thread.
+    query->setProgressCallback(
+        [progressUpdater](const QueryProgress& progress) {
+          progressUpdater->sendProgressUpdate(progress);
+        });
+
+    executeCancellableBackgroundQuery(
+        std::move(query),
+        &MainWindow::handleOverlapFilterChecked,
+        progressUpdater,
+        &MainWindow::handleOverlapFilterCancelled);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2590,9 +3031,40 @@ void MainWindow::on_filtersWidget_cardContentFilterChanged(
 void MainWindow::on_settingsDialog_accepted() {
   try {
     const auto currentTheme = state->getSettings().getTheme();
-    settingsDialog->recordInputValues(*state);
+    auto gamesSettings =
+        settingsDialog->recordInputValues(state->getSettings());
 
     pluginEditorWidget->setLanguage(state->getSettings().getLanguage());
+
+    if (state->getSettings().getTheme() != currentTheme) {
+      applyTheme();
+    }
+
+    // Updating the installed games may reinitialise the current game, so do
+    // it on the game worker.
+    auto progressUpdater = new ProgressUpdater();
+
+    std::unique_ptr<Query> query = std::make_unique<SetGamesSettingsQuery>(
+        *state, std::move(gamesSettings));
+
+    // This lambda will run from the worker thread.
+    query->setProgressCallback(
+        [progressUpdater](const QueryProgress& progress) {
+          progressUpdater->sendProgressUpdate(progress);
+        });
+
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handleGamesSettingsSet,
+                           progressUpdater);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleGamesSettingsSet(QueryResult) {
+  try {
+    progressDialog->reset();
+
     if (state->hasCurrentGame()) {
       recordCurrentGameHiddenMessages(state->getSettings(),
                                       state->getCurrentGame().getSettings());
@@ -2602,49 +3074,67 @@ void MainWindow::on_settingsDialog_accepted() {
 
     // Update the games dropdown in case names have changed.
     refreshGamesDropdown();
-
-    if (state->getSettings().getTheme() != currentTheme) {
-      applyTheme();
-    }
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
 void MainWindow::on_groupsEditor_accepted() {
-  try {
-    state->getCurrentGame().setUserGroups(groupsEditor->getUserGroups());
+  UiOperation operation("MainWindow::on_groupsEditor_accepted");
 
-    for (const auto& [pluginName, groupName] :
-         groupsEditor->getNewPluginGroups()) {
-      // Update the plugin's group in user metadata.
-      auto userMetadata = state->getCurrentGame().getUserMetadata(pluginName);
-
-      if (userMetadata.has_value()) {
-        userMetadata.value().SetGroup(groupName);
-        state->getCurrentGame().addUserMetadata(userMetadata.value());
-      } else {
-        PluginMetadata metadata(pluginName);
-        metadata.SetGroup(groupName);
-        state->getCurrentGame().addUserMetadata(metadata);
+  try {
+    // Plugins in groups that are added or removed need to be re-derived too,
+    // so record the groups that plugins are currently in.
+    std::unordered_map<std::string, std::string> currentPluginGroups;
+    for (const auto& pluginItem : pluginItemModel->getPluginItems()) {
+      if (pluginItem.group.has_value()) {
+        currentPluginGroups.emplace(pluginItem.name, pluginItem.group.value());
       }
-
-      // Now update the plugin in the UI's plugin item model.
-      refreshPluginRawData(pluginName);
     }
 
-    state->getCurrentGame().saveUserMetadata();
+    handleProgressUpdate(qTranslate("Applying group changes…"));
+
+    auto query = std::make_unique<ApplyGroupChangesQuery>(
+        state->getCurrentGame(),
+        state->getSettings().getLanguage(),
+        groupsEditor->getUserGroups(),
+        groupsEditor->getNewPluginGroups(),
+        std::move(currentPluginGroups),
+        groupsEditor->getNodePositions());
 
-    saveGroupNodePositions(state->getCurrentGame().getGroupNodePositionsPath(),
-                           groupsEditor->getNodePositions());
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleGroupChangesApplied, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
+void MainWindow::on_progressDialog_canceled() {
+  if (!cancellationToken.has_value()) {
+    return;
+  }
+
+  auto logger = getLogger();
+  if (logger) {
+    logger->info("Cancelling the running operation.");
+  }
+
+  cancellationToken.value().cancel();
+
+  if (progressCancelButton != nullptr) {
+    progressCancelButton->setEnabled(false);
+  }
+
+  progressBar->setRange(0, 0);
+  progressDialog->setLabelText(qTranslate("Cancelling…"));
+  progressDialog->adjustSize();
+}
+
 void MainWindow::on_searchDialog_finished() { searchDialog->reset(); }
 
 void MainWindow::on_searchDialog_textChanged(const QVariant& text) {
+  UiOperation operation("MainWindow::on_searchDialog_textChanged");
+
   const auto isEmpty =
       (text.userType() == QMetaType::QString && text.toString().isEmpty()) ||
       (text.userType() == QMetaType::QRegularExpression &&
@@ -2689,10 +3179,11 @@ void MainWindow::on_backupDialog_accepted() {
       name = QString::fromUtf8("Manual Backup");
     }
 
-    state->getCurrentGame().backUpCurrentLoadOrder(name.toStdString());
+    auto query = std::make_unique<BackUpLoadOrderQuery>(
+        state->getCurrentGame(), name.toStdString());
 
-    showNotification(
-        qTranslate("A backup of the current load order has been created."));
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleLoadOrderBackedUp, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2716,21 +3207,12 @@ void MainWindow::on_restoreBackupDialog_accepted() {
             backup.value().path.u8string());
       }
 
-      // Before restoring the backup first remove any plugins that are no longer
-      // installed.
-      std::vector<std::string> loadOrder = backup.value().loadOrder;
-      for (auto it = loadOrder.begin(); it != loadOrder.end();) {
-        if (!state->getCurrentGame().fileExists(*it)) {
-          it = loadOrder.erase(it);
-        } else {
-          ++it;
-        }
-      }
-
-      state->getCurrentGame().setLoadOrder(loadOrder);
-      loadGame(false);
+      auto loadOrder = backup.value().loadOrder;
+      auto query = std::make_unique<SetLoadOrderQuery>(
+          state->getCurrentGame(), std::move(loadOrder));
 
-      showNotification(qTranslate("Restored load order from backup."));
+      executeBackgroundQuery(
+          std::move(query), &MainWindow::handleLoadOrderRestored, nullptr);
     } else if (logger) {
       logger->debug("No backup selected to restore.");
     }
@@ -2739,6 +3221,31 @@ void MainWindow::on_restoreBackupDialog_accepted() {
   }
 }
 
+void MainWindow::on_restoreBackupDialog_loadOrderBackupReadRequested(
+    const LoadOrderBackup& backup) {
+  try {
+    auto query = std::make_unique<ReadLoadOrderBackupQuery>(backup);
+
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleLoadOrderBackupRead, nullptr);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::on_restoreBackupDialog_loadOrderBackupDeletionRequested(
+    const std::filesystem::path& backupPath) {
+  try {
+    auto query = std::make_unique<DeleteLoadOrderBackupQuery>(
+        state->getCurrentGame(), backupPath);
+
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleLoadOrderBackupDeleted, nullptr);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::handleGameChanged(QueryResult result) {
   try {
     filtersWidget->setGameId(state->getCurrentGame().getSettings().getId());
@@ -2769,49 +3276,106 @@ void MainWindow::handleRefreshGameDataLoaded(QueryResult result) {
   }
 }
 
+void MainWindow::handleRefreshCancelled() {
+  try {
+    // Plugins and metadata can't be unloaded part-way through, so the game may
+    // already hold the refreshed data. Rebuild the plugin items from it so
+    // that the UI matches the game again.
+    auto progressUpdater = new ProgressUpdater();
+
+    std::unique_ptr<Query> query = std::make_unique<GetPluginItemsQuery>(
+        state->getCurrentGame(), state->getSettings().getLanguage());
+
+    // This lambda will run from the worker thread.
+    query->setProgressCallback(
+        [progressUpdater](const QueryProgress& progress) {
+          progressUpdater->sendProgressUpdate(progress);
+        });
+
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handleRefreshGameDataLoaded,
+                           progressUpdater);
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::handleStartupGameDataLoaded(QueryResult result) {
   try {
     handleGameDataLoaded(result);
 
+    markStartupMilestone("Startup: first plugin cards shown");
+
     if (state->getSettings().isAutoSortEnabled()) {
-      if (hasErrorMessages()) {
-        state->getCurrentGame().appendMessage(createPlainTextSourcedMessage(
-            MessageType::error,
-            MessageSource::autoSortCancellation,
-            translate("Auto-sort has been cancelled as there is at "
-                      "least one error message displayed.")));
-
-        updateGeneralMessages();
-      } else {
-        sortPlugins(true);
-      }
+      // Auto-sort depends on the general messages, so wait for them.
+      updateGeneralMessages(&MainWindow::handleStartupGeneralMessagesLoaded);
     }
 
     // Perform ambiguous load order check because load order state was refreshed
     // when loading game data.
     checkForAmbiguousLoadOrder();
+
+    markStartupMilestone("Startup: interactive");
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
-void MainWindow::handlePluginsManualSorted(QueryResult result) {
+void MainWindow::handleStartupGeneralMessagesLoaded(QueryResult result) {
   try {
-    const auto loadOrderChanged = handlePluginsSorted(result);
+    handleGeneralMessagesLoaded(result);
 
-    if (!loadOrderChanged) {
-      // Perform ambiguous load order check because load order state was
-      // refreshed at the start of sorting.
-      checkForAmbiguousLoadOrder();
+    if (hasErrorMessages()) {
+      auto query = std::make_unique<AppendMessageQuery>(
+          state->getCurrentGame(),
+          createPlainTextSourcedMessage(
+              MessageType::error,
+              MessageSource::autoSortCancellation,
+              translate("Auto-sort has been cancelled as there is at "
+                        "least one error message displayed.")));
+
+      executeBackgroundQuery(
+          std::move(query), &MainWindow::handleMessageAppended, nullptr);
+    } else {
+      sortPlugins(true);
     }
   } catch (const std::exception& e) {
     handleException(e);
   }
 }
 
-void MainWindow::handlePluginsAutoSorted(QueryResult result) {
-  try {
-    handlePluginsSorted(result);
+void MainWindow::handleGroupChangesApplied(QueryResult result) {
+  UiOperation operation("MainWindow::handleGroupChangesApplied");
+
+  try {
+    progressDialog->reset();
+
+    // The sidebar items and cards will be updated by handling the resulting
+    // dataChanged signal.
+    pluginItemModel->updatePluginItems(
+        std::move(std::get<PluginItems>(result)));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginsManualSorted(QueryResult result) {
+  try {
+    const auto loadOrderChanged = handlePluginsSorted(result);
+
+    if (!loadOrderChanged) {
+      // Perform ambiguous load order check because load order state was
+      // refreshed at the start of sorting.
+      checkForAmbiguousLoadOrder();
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginsAutoSorted(QueryResult result) {
+  try {
+    handlePluginsSorted(result);
 
     if (actionApplySort->isVisible()) {
       actionApplySort->trigger();
@@ -2848,21 +3412,12 @@ void MainWindow::handleMasterlistUpdated(std::vector<QueryResult> results) {
     writeOldMessages(state->getCurrentGame().getOldMessagesPath(),
                      pluginItemModel->getCurrentMessages());
 
-    state->getCurrentGame().loadMetadata();
-
-    const auto pluginItems =
-        getPluginItems(state->getCurrentGame().getLoadOrder(),
-                       state->getCurrentGame(),
-                       state->getSettings().getLanguage());
-
-    handleGameDataLoaded(pluginItems);
+    auto query = std::make_unique<LoadMetadataQuery>(
+        state->getCurrentGame(), state->getSettings().getLanguage());
 
-    auto masterlistInfo = getFileRevisionSummary(
-        state->getCurrentGame().getMasterlistPath(), FileType::Masterlist);
-    auto infoText = fmt::format(
-        translate("Masterlist updated to revision {0}."), masterlistInfo.id);
-
-    showNotification(QString::fromStdString(infoText));
+    executeBackgroundQuery(std::move(query),
+                           &MainWindow::handleUpdatedMasterlistLoaded,
+                           nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -2936,14 +3491,11 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
                        pluginItemModel->getCurrentMessages());
 
       // Need to reload the current game data.
-      state->getCurrentGame().loadMetadata();
-
-      const auto pluginItems =
-          getPluginItems(state->getCurrentGame().getLoadOrder(),
-                         state->getCurrentGame(),
-                         state->getSettings().getLanguage());
+      auto query = std::make_unique<LoadMetadataQuery>(
+          state->getCurrentGame(), state->getSettings().getLanguage());
 
-      handleGameDataLoaded(pluginItems);
+      executeBackgroundQuery(
+          std::move(query), &MainWindow::handleGameDataLoaded, nullptr);
     } else {
       progressDialog->reset();
     }
@@ -2962,6 +3514,311 @@ void MainWindow::handleMasterlistsUpdated(std::vector<QueryResult> results) {
   }
 }
 
+void MainWindow::handleUpdatedMasterlistLoaded(QueryResult result) {
+  try {
+    handleGameDataLoaded(result);
+
+    auto masterlistInfo = getFileRevisionSummary(
+        state->getCurrentGame().getMasterlistPath(), FileType::Masterlist);
+    auto infoText = fmt::format(
+        translate("Masterlist updated to revision {0}."), masterlistInfo.id);
+
+    showNotification(QString::fromStdString(infoText));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleGeneralMessagesLoaded(QueryResult result) {
+  UiOperation operation("MainWindow::handleGeneralMessagesLoaded");
+
+  std::vector<SourcedMessage> messages = state->getInitMessages();
+  const auto& gameMessages = std::get<SourcedMessages>(result);
+  messages.insert(messages.end(), gameMessages.begin(), gameMessages.end());
+
+  pluginItemModel->setGeneralMessages(std::move(messages));
+}
+
+void MainWindow::handleMessageAppended(QueryResult) {
+  try {
+    updateGeneralMessages();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleSortApplied(QueryResult) {
+  try {
+    exitSortingState();
+
+    if (state->getCurrentGame().getSnapshot()->isLoadOrderAmbiguous) {
+      actionFixAmbiguousLoadOrder->setEnabled(true);
+
+      showAmbiguousLoadOrderSetWarning(this, *state);
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleSortDiscarded(QueryResult result) {
+  try {
+    const auto& pluginItems = pluginItemModel->getPluginItems();
+
+    std::vector<PluginItem> newPluginItems;
+    newPluginItems.reserve(pluginItems.size());
+    for (const auto& pluginPair : std::get<CancelSortResult>(result)) {
+      const auto& pluginName = pluginPair.first;
+
+      auto it = std::find_if(pluginItems.cbegin(),
+                             pluginItems.cend(),
+                             [&](const auto& pluginItem) {
+                               return pluginItem.name == pluginName;
+                             });
+
+      if (it != pluginItems.end()) {
+        PluginItem newPluginItem = *it;
+        newPluginItem.loadOrderIndex = pluginPair.second;
+        newPluginItems.push_back(newPluginItem);
+      }
+    }
+
+    pluginItemModel->setPluginItems(std::move(newPluginItems));
+
+    updateGeneralMessages();
+
+    exitSortingState();
+
+    // Perform ambiguous load order check because load order state was refreshed
+    // at start of sorting.
+    checkForAmbiguousLoadOrder();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginMetadataLoaded(QueryResult result) {
+  try {
+    const auto& metadata = std::get<EditablePluginMetadata>(result);
+    const auto groups = state->getCurrentGame().getSnapshot()->groupNames;
+
+    pluginEditorWidget->initialiseInputs(groups,
+                                         metadata.pluginName,
+                                         metadata.nonUserMetadata,
+                                         metadata.userMetadata);
+
+    pluginEditorWidget->show();
+
+    state->getUnappliedChangeCount().increment();
+
+    // Refresh the sidebar items so that all their groups are displayed.
+    pluginItemModel->setEditorPluginName(metadata.pluginName);
+
+    enterEditingState();
+
+    // Scroll the sidebar and cards lists to the plugin being edited.
+    const auto sidebarIndex = getSelectedPluginIndex();
+    const auto cardIndex =
+        sidebarIndex.siblingAtColumn(PluginItemModel::CARDS_COLUMN);
+
+    // Use a timeout of 1 ms so that scrolling is done after the widget is
+    // actually opened by Qt's event loop. Use 1 instead of 0 because the
+    // ordering between zero timers and other event sources is undefined.
+    QTimer::singleShot(1, [=]() {
+      try {
+        sidebarPluginsView->scrollTo(sidebarIndex,
+                                     QAbstractItemView::PositionAtTop);
+        pluginCardsView->scrollTo(cardIndex, QAbstractItemView::PositionAtTop);
+      } catch (const std::exception& e) {
+        handleException(e);
+      }
+    });
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginMetadataTextLoaded(QueryResult result) {
+  try {
+    const auto& metadataText = std::get<PluginMetadataText>(result);
+
+    copyToClipboard(metadataText.text);
+
+    const auto logger = getLogger();
+    if (logger) {
+      logger->debug("Exported userlist metadata text for \"{}\": {}",
+                    metadataText.pluginName,
+                    metadataText.text);
+    }
+
+    const auto message = fmt::format(
+        translate("The metadata for \"{0}\" has been copied to the clipboard."),
+        metadataText.pluginName);
+
+    showNotification(QString::fromStdString(message));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleLoadOrderTextLoaded(QueryResult result) {
+  try {
+    copyToClipboard(std::get<std::string>(result));
+
+    showNotification(
+        qTranslate("The load order has been copied to the clipboard."));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleLoadOrderBackedUp(QueryResult) {
+  showNotification(
+      qTranslate("A backup of the current load order has been created."));
+}
+
+void MainWindow::handleLoadOrderBackupsFound(QueryResult result) {
+  try {
+    restoreBackupDialog->setCurrentLoadOrder(
+        state->getCurrentGame().getSnapshot()->loadOrder);
+    restoreBackupDialog->setLoadOrderBackups(
+        std::get<LoadOrderBackups>(result));
+    restoreBackupDialog->open();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleLoadOrderBackupRead(QueryResult result) {
+  try {
+    restoreBackupDialog->setLoadOrderBackupLoadOrder(
+        std::get<LoadOrderBackup>(result));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleLoadOrderBackupDeleted(QueryResult result) {
+  try {
+    restoreBackupDialog->setLoadOrderBackups(
+        std::get<LoadOrderBackups>(result));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleLoadOrderRestored(QueryResult) {
+  try {
+    loadGame(false);
+
+    showNotification(qTranslate("Restored load order from backup."));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleAmbiguousLoadOrderSet(QueryResult) {
+  try {
+    showNotification(
+        qTranslate("The load order displayed by LOOT has been set."));
+
+    if (state->getCurrentGame().getSnapshot()->isLoadOrderAmbiguous) {
+      showAmbiguousLoadOrderSetWarning(this, *state);
+    } else {
+      actionFixAmbiguousLoadOrder->setEnabled(false);
+    }
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginsRedated(QueryResult) {
+  showNotification(
+      /* translators: Notification text. */
+      qTranslate("Plugins were successfully redated."));
+}
+
+void MainWindow::handleAllUserMetadataCleared(QueryResult result) {
+  UiOperation operation("MainWindow::handleAllUserMetadataCleared");
+
+  try {
+    // Clearing all user metadata can clear general messages (though
+    // user-defined general messages aren't editable through the LOOT GUI),
+    // change the known Bash Tags (though again they aren't editable in the GUI)
+    // and change plugin metadata that may be displayed in the sidebar or on
+    // cards. However, only plugins that had user metadata are affected, which
+    // is probably a small fraction of the total number, so doing a full refresh
+    // of the game-related UI would be overkill.
+
+    const auto snapshot = state->getCurrentGame().getSnapshot();
+
+    filtersWidget->setGroups(snapshot->groupNames);
+
+    pluginEditorWidget->setBashTagCompletions(snapshot->knownBashTags);
+
+    updateGeneralMessages();
+
+    // These plugin items are only those that had their user metadata removed.
+    const auto& pluginItems = std::get<PluginItems>(result);
+
+    // For each item, find its existing index in the model and update its data.
+    // The sidebar item and card will be updated by handling the resulting
+    // dataChanged signal.
+    auto nameToRowMap = pluginItemModel->getPluginNameToRowMap();
+    for (const auto& item : pluginItems) {
+      const auto it = nameToRowMap.find(item.name);
+      if (it == nameToRowMap.end()) {
+        throw std::runtime_error(std::string("Could not find plugin named \"") +
+                                 item.name + "\" in the plugin item model.");
+      }
+
+      // It doesn't matter which index column is used, it's the same data.
+      const auto index = pluginItemModel->index(it->second, 0);
+      pluginItemModel->setData(index, QVariant::fromValue(item), RawDataRole);
+    }
+
+    showNotification(qTranslate("All user-added metadata has been cleared."));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginMetadataCleared(QueryResult result) {
+  try {
+    // The result is the changed plugin's derived metadata. Update the
+    // model's data and also the message counts.
+    const auto& newPluginItem = std::get<PluginItem>(result);
+
+    setPluginRawData(newPluginItem);
+
+    auto notificationText = fmt::format(
+        translate("The user-added metadata for \"{0}\" has been cleared."),
+        newPluginItem.name);
+
+    showNotification(QString::fromStdString(notificationText));
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handlePluginMetadataSet(QueryResult result) {
+  UiOperation operation("MainWindow::handlePluginMetadataSet");
+
+  try {
+    pluginItemModel->setEditorPluginName(std::nullopt);
+
+    if (std::holds_alternative<PluginItem>(result)) {
+      setPluginRawData(std::get<PluginItem>(result));
+    }
+
+    state->getUnappliedChangeCount().decrement();
+
+    exitEditingState();
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
 void MainWindow::handleOverlapFilterChecked(QueryResult result) {
   try {
     progressDialog->reset();
@@ -2995,10 +3852,32 @@ void MainWindow::handleOverlapFilterChecked(QueryResult result) {
   }
 }
 
-void MainWindow::handleProgressUpdate(const QString& message) {
-  progressDialog->open();
-  progressDialog->setLabelText(message);
-  progressDialog->adjustSize();
+void MainWindow::handleOverlapFilterCancelled() {
+  try {
+    // The overlap wasn't calculated, so show all plugins again.
+    filtersWidget->resetOverlapFilter();
+
+    setFiltersState(filtersWidget->getPluginFiltersState(), {});
+  } catch (const std::exception& e) {
+    handleException(e);
+  }
+}
+
+void MainWindow::handleProgressUpdate(const QString& message,
+                                      int completed,
+                                      int total) {
+  progressDialog->show();
+
+  // A maximum of zero shows a busy indicator.
+  progressBar->setRange(0, total);
+  progressBar->setValue(completed);
+
+  // Resizing for every plugin processed is wasteful, and only the label
+  // affects the size.
+  if (progressDialog->labelText() != message) {
+    progressDialog->setLabelText(message);
+    progressDialog->adjustSize();
+  }
 }
 
 void MainWindow::handleUpdateCheckFinished(QueryResult result) {
@@ -3014,9 +3893,12 @@ void MainWindow::handleUpdateCheckFinished(QueryResult result) {
           fmt::format(translate("A [new release]({0}) of LOOT is available."),
                       "https://github.com/loot/loot/releases/latest");
 
-      state->getCurrentGame().appendMessage(
+      auto query = std::make_unique<AppendMessageQuery>(
+          state->getCurrentGame(),
           SourcedMessage{MessageType::error, MessageSource::updateCheck, text});
-      updateGeneralMessages();
+
+      executeBackgroundQuery(
+          std::move(query), &MainWindow::handleMessageAppended, nullptr);
     }
   } catch (const std::exception& e) {
     handleException(e);
@@ -3037,9 +3919,12 @@ void MainWindow::handleUpdateCheckError(const std::string&) {
       }
     }
 
-    state->getCurrentGame().appendMessage(
+    auto query = std::make_unique<AppendMessageQuery>(
+        state->getCurrentGame(),
         SourcedMessage{MessageType::error, MessageSource::updateCheck, text});
-    updateGeneralMessages();
+
+    executeBackgroundQuery(
+        std::move(query), &MainWindow::handleMessageAppended, nullptr);
   } catch (const std::exception& e) {
     handleException(e);
   }
@@ -26,8 +26,10 @@
 #ifndef LOOT_GUI_QT_MAIN_WINDOW
 #define LOOT_GUI_QT_MAIN_WINDOW
 
+#include <QtCore/QFuture>
 #include <QtCore/QVariant>
 #include <QtGui/QAction>
+#include <QtGui/QActionGroup>
 #include <QtWidgets/QCheckBox>
 #include <QtWidgets/QComboBox>
 #include <QtWidgets/QFrame>
@@ -38,6 +40,7 @@
 #include <QtWidgets/QMainWindow>
 #include <QtWidgets/QMenu>
 #include <QtWidgets/QMenuBar>
+#include <QtWidgets/QProgressBar>
 #include <QtWidgets/QProgressDialog>
 #include <QtWidgets/QPushButton>
 #include <QtWidgets/QScrollArea>
@@ -54,6 +57,7 @@
 
 #include "gui/qt/back_up_load_order_dialog.h"
 #include "gui/qt/card_delegate.h"
+#include "gui/qt/completion_model.h"
 #include "gui/qt/filters_widget.h"
 #include "gui/qt/groups_editor/groups_editor_dialog.h"
 #include "gui/qt/plugin_editor/plugin_editor_widget.h"
@@ -62,8 +66,10 @@
 #include "gui/qt/restore_load_order_dialog.h"
 #include "gui/qt/search_dialog.h"
 #include "gui/qt/settings/settings_dialog.h"
+#include "gui/qt/style.h"
 #include "gui/qt/tasks/tasks.h"
 #include "gui/query/query.h"
+#include "gui/state/cancellation_token.h"
 #include "gui/state/loot_state.h"
 
 namespace loot {
@@ -85,8 +91,10 @@ class MainWindow : public QMainWindow {
 
 public:
   explicit MainWindow(LootState &state, QWidget *parent = nullptr);
+  ~MainWindow() override;
 
-  void initialise();
+  void initialise(const std::string &cmdLineGame,
+                  const std::filesystem::path &cmdLineGamePath);
   void applyTheme();
 
 signals:
@@ -133,6 +141,14 @@ private:
   QAction *actionSettings{new QAction(this)};
   QAction *actionUpdateMasterlists{new QAction(this)};
   QAction *actionBackupData{new QAction(this)};
+  // The toolbar's action for gameComboBox, set in setupToolBar().
+  QAction *gameComboBoxAction{nullptr};
+  // Actions that start game work conflicting with a running operation, which
+  // are disabled while the progress dialog is shown and until its operation
+  // has finished.
+  QActionGroup *operationConflictingActions{new QActionGroup(this)};
+  // The number of background operations that have started but not finished.
+  unsigned int runningOperationCount{0};
 
   QMenuBar *menubar{new QMenuBar(this)};
   QMenu *menuFile{new QMenu(menubar)};
@@ -144,6 +160,12 @@ private:
   QToolBar *toolBar{new QToolBar(this)};
   QComboBox *gameComboBox{new QComboBox(toolBar)};
   QProgressDialog *progressDialog{new QProgressDialog(this)};
+  QProgressBar *progressBar{new QProgressBar(progressDialog)};
+  // Owned by progressDialog, and only set while a cancellable operation runs.
+  QPushButton *progressCancelButton{nullptr};
+
+  // Shared by the metadata editor's autocompletions.
+  CompletionModel *pluginNameCompletions{new CompletionModel(this)};
 
   QSplitter *sidebarSplitter{new QSplitter(this)};
   QToolBox *toolBox{new QToolBox(sidebarSplitter)};
@@ -156,7 +178,8 @@ private:
   PluginEditorWidget *pluginEditorWidget{
       new PluginEditorWidget(editorSplitter,
                              state->getSettings().getLanguages(),
-                             state->getSettings().getLanguage())};
+                             state->getSettings().getLanguage(),
+                             *pluginNameCompletions)};
 
   SettingsDialog *settingsDialog{
       new SettingsDialog(this, state->getPaths().getLootDataPath())};
@@ -182,8 +205,22 @@ private:
 
   QColor linkColor;
 
+  bool usingPaletteTheme{false};
+
   std::vector<std::string> themes;
 
+  // Incremented each time general information is updated, so that revision
+  // summaries that finish calculating after a newer update can be discarded.
+  size_t fileRevisionsUpdateId{0};
+
+  // Game detection and initialisation run on the game worker during startup,
+  // and anything that uses the state from another thread must wait for this
+  // to finish first.
+  QFuture<void> gamesInitialisation;
+
+  // Set while a background operation that can be cancelled is running.
+  std::optional<CancellationToken> cancellationToken;
+
   void setupUi();
   void setupMenuBar();
   void setupToolBar();
@@ -196,6 +233,7 @@ private:
   void disableGameActions();
   void enablePluginActions();
   void disablePluginActions();
+  void setGamesInitialisingState(bool isInitialising);
 
   void enterEditingState();
   void exitEditingState();
@@ -207,13 +245,17 @@ private:
   void updateCounts(const std::vector<SourcedMessage> &generalMessages,
                     const std::vector<PluginItem> &plugins);
   void updateGeneralInformation();
-  void updateGeneralMessages();
+  void calculateFileRevisionSummaries(
+      const std::optional<std::filesystem::path> &masterlistPath,
+      const std::optional<std::filesystem::path> &preludePath);
+  void updateGeneralMessages(void (MainWindow::*onComplete)(QueryResult) =
+                                 &MainWindow::handleGeneralMessagesLoaded);
   void updateSidebarColumnWidths();
   void setFiltersState(PluginFiltersState &&state);
   void setFiltersState(PluginFiltersState &&state,
                        std::vector<std::string> &&overlappingPluginNames);
   void refreshSearch();
-  void refreshPluginRawData(const std::string &pluginName);
+  void setPluginRawData(const PluginItem &newPluginItem);
 
   bool hasErrorMessages() const;
 
@@ -226,26 +268,44 @@ private:
   PluginItem getSelectedPlugin() const;
 
   void closeEvent(QCloseEvent *event) override;
+  bool eventFilter(QObject *watched, QEvent *event) override;
+  void startBackgroundOperation();
+  void finishBackgroundOperation();
+  void updateOperationConflictingActions();
 
   void executeBackgroundQuery(std::unique_ptr<Query> query,
                               void (MainWindow::*onComplete)(QueryResult),
                               ProgressUpdater *progressUpdater);
+  void executeCancellableBackgroundQuery(
+      std::unique_ptr<Query> query,
+      void (MainWindow::*onComplete)(QueryResult),
+      ProgressUpdater *progressUpdater,
+      void (MainWindow::*onCancelled)() = nullptr);
+
+  void startCancellableOperation(const CancellationToken &token);
+  void finishCancellableOperation(const CancellationToken &token);
+  void connectProgressUpdater(ProgressUpdater *progressUpdater,
+                              const CancellationToken &token);
+  void connectTaskProgress(const std::vector<Task *> &tasks,
+                           const QString &stage,
+                           const CancellationToken &token);
 
   void handleError(const std::string &message);
   void handleException(const std::exception &exception);
-  void handleQueryException(const Query &query,
-                            const std::exception &exception);
+  void handleUserlistWriteError(const std::string &message);
 
   void handleGameDataLoaded(QueryResult result);
   bool handlePluginsSorted(QueryResult result);
 
   QMenu *createPopupMenu() override;
 
+  std::filesystem::path getNewBackupPath() const;
   std::optional<std::filesystem::path> createBackup();
 
   void checkForAmbiguousLoadOrder();
 
   void refreshGamesDropdown();
+  void revalidateInstalledGames();
 
   void setHiddenMessages(const std::vector<HiddenMessage> &hiddenMessages);
 
@@ -261,6 +321,10 @@ private slots:
   void on_actionBackUpLoadOrder_triggered();
   void on_actionRestoreLoadOrder_triggered();
   void on_restoreBackupDialog_accepted();
+  void on_restoreBackupDialog_loadOrderBackupReadRequested(
+      const LoadOrderBackup &backup);
+  void on_restoreBackupDialog_loadOrderBackupDeletionRequested(
+      const std::filesystem::path &backupPath);
   void on_actionFixAmbiguousLoadOrder_triggered();
   void on_actionRefreshContent_triggered();
   void on_actionUnhideMessages_triggered();
@@ -313,6 +377,8 @@ private slots:
 
   void on_groupsEditor_accepted();
 
+  void on_progressDialog_canceled();
+
   void on_searchDialog_finished();
   void on_searchDialog_textChanged(const QVariant &text);
   void on_searchDialog_currentResultChanged(size_t resultIndex);
@@ -321,16 +387,46 @@ private slots:
 
   void handleGameChanged(QueryResult result);
   void handleRefreshGameDataLoaded(QueryResult result);
+  void handleRefreshCancelled();
+  void handleGamesInitialised();
+  void handleInstalledGamesUpdated(QueryResult result);
+  void handleGamesSettingsSet(QueryResult result);
   void handleStartupGameDataLoaded(QueryResult result);
+  void handleStartupGeneralMessagesLoaded(QueryResult result);
+  void handleGroupChangesApplied(QueryResult result);
   void handlePluginsManualSorted(QueryResult result);
   void handlePluginsAutoSorted(QueryResult result);
   void handleMasterlistUpdated(std::vector<QueryResult> results);
   void handleMasterlistsUpdated(std::vector<QueryResult> results);
+  void handleUpdatedMasterlistLoaded(QueryResult result);
+  void handleGeneralMessagesLoaded(QueryResult result);
+  void handleMessageAppended(QueryResult result);
+  void handleSortApplied(QueryResult result);
+  void handleSortDiscarded(QueryResult result);
+  void handleLoadOrderTextLoaded(QueryResult result);
+  void handlePluginMetadataLoaded(QueryResult result);
+  void handlePluginMetadataTextLoaded(QueryResult result);
+  void handleLoadOrderBackedUp(QueryResult result);
+  void handleLoadOrderBackupsFound(QueryResult result);
+  void handleLoadOrderBackupRead(QueryResult result);
+  void handleLoadOrderBackupDeleted(QueryResult result);
+  void handleLoadOrderRestored(QueryResult result);
+  void handleAmbiguousLoadOrderSet(QueryResult result);
+  void handlePluginsRedated(QueryResult result);
+  void handleAllUserMetadataCleared(QueryResult result);
+  void handlePluginMetadataCleared(QueryResult result);
+  void handlePluginMetadataSet(QueryResult result);
   void handleOverlapFilterChecked(QueryResult result);
-  void handleProgressUpdate(const QString &message);
+  void handleOverlapFilterCancelled();
+  void handleProgressUpdate(const QString &message,
+                            int completed = 0,
+                            int total = 0);
   void handleUpdateCheckFinished(QueryResult result);
   void handleUpdateCheckError(const std::string &);
 
+  void applyPaletteTheme(const PaletteTheme &theme);
+  void applyStyleSheetTheme(const QString &styleSheet);
+
   void handleIconColorChanged();
   void handleSidebarTextColorChanged();
   void handleLinkColorChanged();
@@ -28,7 +28,6 @@
 #include <QtGui/QGuiApplication>
 #include <QtGui/QScreen>
 #include <QtWidgets/QComboBox>
-#include <QtWidgets/QCompleter>
 #include <QtWidgets/QLineEdit>
 
 #include "gui/qt/helpers.h"
@@ -163,18 +162,15 @@ bool MessageContentDelegate::eventFilter(QObject* editor, QEvent* event) {
 
 AutocompletingLineEditDelegate::AutocompletingLineEditDelegate(
     QObject* parent,
-    const QStringList& completions) :
+    CompletionModel& completions) :
     QStyledItemDelegate(parent), completions(&completions) {}
 
 QWidget* AutocompletingLineEditDelegate::createEditor(
     QWidget* parent,
     const QStyleOptionViewItem&,
     const QModelIndex&) const {
-  auto completer = new QCompleter(*completions, parent);
-  completer->setCaseSensitivity(Qt::CaseInsensitive);
-
   QLineEdit* lineEdit = new QLineEdit(parent);
-  lineEdit->setCompleter(completer);
+  lineEdit->setCompleter(completions->createCompleter(lineEdit));
 
   return lineEdit;
 }
@@ -28,6 +28,7 @@
 
 #include <QtWidgets/QStyledItemDelegate>
 
+#include "gui/qt/completion_model.h"
 #include "gui/state/loot_settings.h"
 
 namespace loot {
@@ -93,8 +94,7 @@ private:
 
 class AutocompletingLineEditDelegate : public QStyledItemDelegate {
 public:
-  AutocompletingLineEditDelegate(QObject* parent,
-                                 const QStringList& completions);
+  AutocompletingLineEditDelegate(QObject* parent, CompletionModel& completions);
 
   QWidget* createEditor(QWidget* parent,
                         const QStyleOptionViewItem& option,
@@ -107,7 +107,7 @@ public:
                     const QModelIndex& index) const override;
 
 private:
-  const QStringList* completions;
+  CompletionModel* completions;
 };
 }
 
@@ -38,8 +38,12 @@ namespace loot {
 PluginEditorWidget::PluginEditorWidget(
     QWidget *parent,
     const std::vector<LootSettings::Language> &languages,
-    const std::string &language) :
-    QWidget(parent), languages(&languages), language(language) {
+    const std::string &language,
+    CompletionModel &filenameCompletions) :
+    QWidget(parent),
+    languages(&languages),
+    language(language),
+    filenameCompletions(&filenameCompletions) {
   setupUi();
 }
 
@@ -49,20 +53,7 @@ void PluginEditorWidget::setLanguage(std::string &&newLanguage) {
 
 void PluginEditorWidget::setBashTagCompletions(
     const std::vector<std::string> &knownBashTags) {
-  bashTagCompletions.clear();
-
-  for (const auto &bashTag : knownBashTags) {
-    bashTagCompletions.append(QString::fromStdString(bashTag));
-  }
-}
-
-void PluginEditorWidget::setFilenameCompletions(
-    const std::vector<std::string> &knownFilenames) {
-  filenameCompletions.clear();
-
-  for (const auto &filename : knownFilenames) {
-    filenameCompletions.append(QString::fromStdString(filename));
-  }
+  bashTagCompletions->setCompletions(knownBashTags);
 }
 
 void PluginEditorWidget::initialiseInputs(
@@ -32,6 +32,7 @@
 #include <QtWidgets/QTabWidget>
 #include <QtWidgets/QWidget>
 
+#include "gui/qt/completion_model.h"
 #include "gui/qt/plugin_editor/group_tab.h"
 #include "gui/qt/plugin_editor/table_tabs.h"
 #include "gui/state/loot_settings.h"
@@ -42,11 +43,11 @@ class PluginEditorWidget : public QWidget {
 public:
   PluginEditorWidget(QWidget *parent,
                      const std::vector<LootSettings::Language> &languages,
-                     const std::string &language);
+                     const std::string &language,
+                     CompletionModel &filenameCompletions);
 
   void setLanguage(std::string&& language);
   void setBashTagCompletions(const std::vector<std::string> &knownBashTags);
-  void setFilenameCompletions(const std::vector<std::string> &knownFilenames);
 
   void initialiseInputs(const std::vector<std::string> &groups,
                         const std::string &pluginName,
@@ -63,8 +64,8 @@ private:
   const std::vector<LootSettings::Language> *languages;
   std::string language;
 
-  QStringList bashTagCompletions;
-  QStringList filenameCompletions;
+  CompletionModel *bashTagCompletions{new CompletionModel(this)};
+  CompletionModel *filenameCompletions;
 
   QLabel *pluginLabel{new QLabel(this)};
   QTabWidget *tabs{new QTabWidget(this)};
@@ -73,13 +74,13 @@ private:
       new LoadAfterFileTableTab(this,
                                 *languages,
                                 language,
-                                filenameCompletions)};
+                                *filenameCompletions)};
   FileTableTab *requirementsTab{
-      new FileTableTab(this, *languages, language, filenameCompletions)};
+      new FileTableTab(this, *languages, language, *filenameCompletions)};
   FileTableTab *incompatibilitiesTab{
-      new FileTableTab(this, *languages, language, filenameCompletions)};
+      new FileTableTab(this, *languages, language, *filenameCompletions)};
   MessageTableTab *messagesTab{new MessageTableTab(this, *languages, language)};
-  TagTableTab *tagsTab{new TagTableTab(this, bashTagCompletions)};
+  TagTableTab *tagsTab{new TagTableTab(this, *bashTagCompletions)};
   CleaningDataTableTab *dirtyTab{
       new CleaningDataTableTab(this, *languages, language)};
   CleaningDataTableTab *cleanTab{
@@ -337,7 +337,7 @@ void BaseTableTab::onModelRowsRemoved() {
 FileTableTab::FileTableTab(QWidget* parent,
                            const std::vector<LootSettings::Language>& languages,
                            const std::string& language,
-                           const QStringList& completions) :
+                           CompletionModel& completions) :
     MetadataTableTab(parent),
     languages(&languages),
     language(&language),
@@ -521,7 +521,7 @@ bool CleaningDataTableTab::hasUserMetadata() const {
   return !getUserMetadata().empty();
 }
 
-TagTableTab::TagTableTab(QWidget* parent, const QStringList& completions) :
+TagTableTab::TagTableTab(QWidget* parent, CompletionModel& completions) :
     MetadataTableTab(parent), completions(&completions) {}
 
 void TagTableTab::initialiseInputs(std::vector<Tag>&& nonUserMetadata,
@@ -39,6 +39,7 @@
 #include <QtWidgets/QTableView>
 #include <QtWidgets/QWidget>
 
+#include "gui/qt/completion_model.h"
 #include "gui/state/loot_settings.h"
 
 namespace loot {
@@ -97,7 +98,7 @@ public:
   FileTableTab(QWidget* parent,
                const std::vector<LootSettings::Language>& languages,
                const std::string& language,
-               const QStringList& completions);
+               CompletionModel& completions);
 
   void initialiseInputs(std::vector<File>&& nonUserMetadata,
                         std::vector<File>&& userMetadata) override;
@@ -109,7 +110,7 @@ public:
 private:
   const std::vector<LootSettings::Language>* languages;
   const std::string* language;
-  const QStringList* completions;
+  CompletionModel* completions;
 };
 
 class LoadAfterFileTableTab : public FileTableTab {
@@ -196,7 +197,7 @@ private:
 class TagTableTab : public MetadataTableTab<Tag> {
   Q_OBJECT
 public:
-  TagTableTab(QWidget* parent, const QStringList& completions);
+  TagTableTab(QWidget* parent, CompletionModel& completions);
 
   void initialiseInputs(std::vector<Tag>&& nonUserMetadata,
                         std::vector<Tag>&& userMetadata) override;
@@ -206,7 +207,7 @@ public:
   bool hasUserMetadata() const override;
 
 private:
-  const QStringList* completions;
+  CompletionModel* completions;
 };
 }
 
@@ -26,6 +26,9 @@
 #include "gui/qt/plugin_item_model.h"
 
 #include <QtCore/QMimeData>
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
 
 #include "gui/qt/helpers.h"
 #include "gui/qt/icon_factory.h"
@@ -180,6 +183,10 @@ bool hasHiddenMessages(
             message, filters, hiddenGeneralMessages, oldGeneralMessages);
       });
 }
+
+std::string getGroupName(const PluginItem& item) {
+  return item.group.value_or(std::string(loot::Group::DEFAULT_NAME));
+}
 }
 
 namespace loot {
@@ -469,7 +476,7 @@ bool PluginItemModel::setData(const QModelIndex& index,
   } else {
     const size_t itemsIndex = static_cast<size_t>(index.row()) - 1;
 
-    items.at(itemsIndex) = value.value<PluginItem>();
+    setItem(itemsIndex, value.value<PluginItem>());
   }
 
   // The RawDataRole data changed, emit dataChanged for all columns.
@@ -511,11 +518,16 @@ std::unordered_map<std::string, int> PluginItemModel::getPluginNameToRowMap()
   return nameToRowMap;
 }
 
+const PluginIndicesByGroup& PluginItemModel::getPluginIndicesByGroup() const {
+  return pluginIndicesByGroup;
+}
+
 void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
   if (!items.empty()) {
     beginRemoveRows(QModelIndex(), 1, static_cast<int>(items.size()));
 
     items.clear();
+    pluginIndicesByGroup.clear();
     searchResults.clear();
     currentSearchResultIndex = std::nullopt;
 
@@ -527,9 +539,48 @@ void PluginItemModel::setPluginItems(std::vector<PluginItem>&& newItems) {
   std::swap(items, newItems);
   searchResults.resize(items.size(), false);
 
+  for (size_t i = 0; i < items.size(); i += 1) {
+    pluginIndicesByGroup[getGroupName(items[i])].insert(i);
+  }
+
   endInsertRows();
 }
 
+void PluginItemModel::updatePluginItems(
+    std::vector<PluginItem>&& updatedItems) {
+  if (updatedItems.empty()) {
+    return;
+  }
+
+  std::unordered_map<std::string, size_t> nameToItemsIndexMap;
+  nameToItemsIndexMap.reserve(items.size());
+  for (size_t i = 0; i < items.size(); i += 1) {
+    nameToItemsIndexMap.emplace(items[i].name, i);
+  }
+
+  auto firstIndex = items.size();
+  size_t lastIndex = 0;
+  for (auto& item : updatedItems) {
+    const auto it = nameToItemsIndexMap.find(item.name);
+    if (it == nameToItemsIndexMap.end()) {
+      throw std::runtime_error(std::string("Could not find plugin named \"") +
+                               item.name + "\" in the plugin item model.");
+    }
+
+    setItem(it->second, std::move(item));
+    firstIndex = std::min(firstIndex, it->second);
+    lastIndex = std::max(lastIndex, it->second);
+  }
+
+  // Row 0 is the general information card, so the row for each item is one
+  // more than its index. The RawDataRole data changed for all columns.
+  const auto topLeft = index(static_cast<int>(firstIndex) + 1, 0);
+  const auto bottomRight =
+      index(static_cast<int>(lastIndex) + 1, columnCount() - 1);
+
+  emit dataChanged(topLeft, bottomRight, {RawDataRole});
+}
+
 void PluginItemModel::setEditorPluginName(
     const std::optional<std::string>& editorPluginName) {
   currentEditorPluginName = editorPluginName;
@@ -558,6 +609,14 @@ void PluginItemModel::setGeneralInformation(
   emit dataChanged(infoIndex, infoIndex, {RawDataRole});
 }
 
+void PluginItemModel::setMasterlistRevision(
+    const FileRevisionSummary& masterlistRevision) {
+  const auto infoIndex = index(0, CARDS_COLUMN);
+  generalInformation.masterlistRevision = masterlistRevision;
+
+  emit dataChanged(infoIndex, infoIndex, {RawDataRole});
+}
+
 void PluginItemModel::setPreludeRevision(
     const FileRevisionSummary& preludeRevision) {
   const auto infoIndex = index(0, CARDS_COLUMN);
@@ -727,6 +786,26 @@ size_t PluginItemModel::countHiddenMessages() {
 
   return hidden;
 }
+void PluginItemModel::setItem(size_t itemsIndex, PluginItem&& item) {
+  auto& existingItem = items.at(itemsIndex);
+
+  const auto oldGroupName = getGroupName(existingItem);
+  const auto newGroupName = getGroupName(item);
+  if (newGroupName != oldGroupName) {
+    const auto it = pluginIndicesByGroup.find(oldGroupName);
+    if (it != pluginIndicesByGroup.end()) {
+      it->second.erase(itemsIndex);
+      if (it->second.empty()) {
+        pluginIndicesByGroup.erase(it);
+      }
+    }
+
+    pluginIndicesByGroup[newGroupName].insert(itemsIndex);
+  }
+
+  existingItem = std::move(item);
+}
+
 void PluginItemModel::hideGeneralMessage(const std::string& text) {
   hiddenGeneralMessages.insert(text);
 }
@@ -27,6 +27,8 @@
 #define LOOT_GUI_QT_PLUGIN_ITEM_MODEL
 
 #include <QtCore/QAbstractListModel>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "gui/plugin_item.h"
@@ -48,6 +50,11 @@ static constexpr int SearchResultRole = Qt::UserRole + 8;
 static constexpr int FilteredContentRole = Qt::UserRole + 9;
 static constexpr int HasHiddenMessagesRole = Qt::UserRole + 10;
 
+// Maps group names to the indices of the plugin items that are in each group,
+// in load order. Plugins with no group are in the default group.
+typedef std::unordered_map<std::string, std::set<size_t>>
+    PluginIndicesByGroup;
+
 struct SearchResultData {
   SearchResultData() = default;
   SearchResultData(bool isResult, bool isCurrentResult);
@@ -94,8 +101,14 @@ public:
 
   std::unordered_map<std::string, int> getPluginNameToRowMap() const;
 
+  const PluginIndicesByGroup& getPluginIndicesByGroup() const;
+
   void setPluginItems(std::vector<PluginItem>&& items);
 
+  // Replace the existing items that have the same names as the given items,
+  // emitting dataChanged once for all of them.
+  void updatePluginItems(std::vector<PluginItem>&& updatedItems);
+
   void setEditorPluginName(const std::optional<std::string>& editorPluginName);
 
   void setGeneralInformation(bool gameSupportsLightPlugins,
@@ -104,6 +117,8 @@ public:
                              const FileRevisionSummary& preludeRevision,
                              const std::vector<SourcedMessage>& messages);
 
+  void setMasterlistRevision(const FileRevisionSummary& masterlistRevision);
+
   void setPreludeRevision(const FileRevisionSummary& preludeRevision);
 
   void setGeneralMessages(std::vector<SourcedMessage>&& messages);
@@ -130,6 +145,7 @@ public:
 private:
   GeneralInformation generalInformation;
   std::vector<PluginItem> items;
+  PluginIndicesByGroup pluginIndicesByGroup;
   std::vector<bool> searchResults;
   std::optional<size_t> currentSearchResultIndex;
 
@@ -143,6 +159,8 @@ private:
       oldMessagesByPluginName;
   std::unordered_set<std::string> oldGeneralMessages;
 
+  void setItem(size_t itemsIndex, PluginItem&& item);
+
   void hideGeneralMessage(const std::string& text);
   void hideMessage(const std::string& pluginName, const std::string& text);
 };
@@ -26,13 +26,13 @@
 #include "gui/qt/restore_load_order_dialog.h"
 
 #include <QtCore/QDateTime>
-#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QFormLayout>
 #include <QtWidgets/QHBoxLayout>
 #include <QtWidgets/QHeaderView>
 #include <QtWidgets/QMessageBox>
 #include <QtWidgets/QTableWidgetItem>
 #include <QtWidgets/QVBoxLayout>
+#include <algorithm>
 
 #include "gui/qt/helpers.h"
 #include "gui/state/logging.h"
@@ -78,20 +78,39 @@ void RestoreLoadOrderDialog::setLoadOrderBackups(
 
   deleteButton->setEnabled(false);
   identicalLabel->setHidden(true);
+  buttonBox->button(QDialogButtonBox::StandardButton::Ok)->setEnabled(true);
 
   backups = loadOrderBackups;
 }
 
+void RestoreLoadOrderDialog::setLoadOrderBackupLoadOrder(
+    const LoadOrderBackup& backup) {
+  const auto it = std::find_if(
+      backups.begin(), backups.end(), [&](const LoadOrderBackup& listed) {
+        return listed.path == backup.path;
+      });
+
+  // The backup may have been deleted while it was being read.
+  if (it == backups.end()) {
+    return;
+  }
+
+  it->loadOrder = backup.loadOrder;
+
+  const auto row = static_cast<size_t>(std::distance(backups.begin(), it));
+  if (getSelectedRow() == row) {
+    showLoadOrderBackup(*it);
+  }
+}
+
 std::optional<LoadOrderBackup>
 RestoreLoadOrderDialog::getSelectedLoadOrderBackup() const {
-  const auto selectedItems = backupsTable->selectedItems();
-  if (selectedItems.empty()) {
+  const auto row = getSelectedRow();
+  if (!row.has_value()) {
     return std::nullopt;
   }
 
-  const auto row = static_cast<size_t>(selectedItems.at(0)->row());
-
-  return backups.at(row);
+  return backups.at(row.value());
 }
 
 void RestoreLoadOrderDialog::setupUi() {
@@ -109,10 +128,8 @@ void RestoreLoadOrderDialog::setupUi() {
 
   identicalLabel->setHidden(true);
 
-  const auto buttonBox =
-      new QDialogButtonBox(QDialogButtonBox::StandardButton::Ok |
-                               QDialogButtonBox::StandardButton::Cancel,
-                           this);
+  buttonBox->setStandardButtons(QDialogButtonBox::StandardButton::Ok |
+                                QDialogButtonBox::StandardButton::Cancel);
 
   auto dialogLayout = new QVBoxLayout();
   auto viewsLayout = new QHBoxLayout();
@@ -176,6 +193,33 @@ void RestoreLoadOrderDialog::translateUi() {
       qTranslate("The current and selected backup load orders are identical."));
 }
 
+std::optional<size_t> RestoreLoadOrderDialog::getSelectedRow() const {
+  const auto selectedItems = backupsTable->selectedItems();
+  if (selectedItems.empty()) {
+    return std::nullopt;
+  }
+
+  return static_cast<size_t>(selectedItems.at(0)->row());
+}
+
+void RestoreLoadOrderDialog::showLoadOrderBackup(
+    const LoadOrderBackup& backup) {
+  backupLoadOrderList->clear();
+
+  for (const auto& plugin : backup.loadOrder) {
+    backupLoadOrderList->addItem(QString::fromStdString(plugin));
+  }
+
+  std::vector<std::string> currentLoadOrder;
+  for (int i = 0; i < currentLoadOrderList->count(); i += 1) {
+    currentLoadOrder.push_back(
+        currentLoadOrderList->item(i)->text().toStdString());
+  }
+
+  identicalLabel->setHidden(backup.loadOrder != currentLoadOrder);
+  buttonBox->button(QDialogButtonBox::StandardButton::Ok)->setEnabled(true);
+}
+
 void RestoreLoadOrderDialog::handleBackupSelectionChanged(
     const QItemSelection& selected,
     const QItemSelection&) {
@@ -183,45 +227,36 @@ void RestoreLoadOrderDialog::handleBackupSelectionChanged(
 
   const auto indexes = selected.indexes();
   if (!indexes.empty()) {
-    const auto& backup = backups.at(static_cast<size_t>(indexes.front().row()));
-    for (const auto& plugin : backup.loadOrder) {
-      backupLoadOrderList->addItem(QString::fromStdString(plugin));
-    }
-
-    std::vector<std::string> currentLoadOrder;
-    for (int i = 0; i < currentLoadOrderList->count(); i += 1) {
-      currentLoadOrder.push_back(
-          currentLoadOrderList->item(i)->text().toStdString());
-    }
+    const auto& backup =
+        backups.at(static_cast<size_t>(indexes.front().row()));
 
-    identicalLabel->setHidden(backup.loadOrder != currentLoadOrder);
     deleteButton->setEnabled(true);
-  }
-}
 
-void RestoreLoadOrderDialog::handleDeleteButtonClicked() {
-  try {
-    const auto selected = backupsTable->selectedItems();
-    if (selected.empty()) {
+    // Backups are listed without their load orders, so read the load order
+    // when its backup is first selected, and don't allow it to be restored
+    // until it has been read.
+    if (backup.loadOrder.empty() && backup.pluginCount > 0) {
+      identicalLabel->setHidden(true);
+      buttonBox->button(QDialogButtonBox::StandardButton::Ok)
+          ->setEnabled(false);
+
+      emit loadOrderBackupReadRequested(backup);
       return;
     }
 
-    const auto row = selected.front()->row();
-
-    std::filesystem::remove(backups.at(static_cast<size_t>(row)).path);
+    showLoadOrderBackup(backup);
+  }
+}
 
-    backups.erase(backups.begin() + row);
+void RestoreLoadOrderDialog::handleDeleteButtonClicked() {
+  const auto row = getSelectedRow();
+  if (!row.has_value()) {
+    return;
+  }
 
-    setLoadOrderBackups(backups);
-  } catch (const std::exception& e) {
-    const auto logger = getLogger();
-    if (logger) {
-      logger->error("Caught an exception while trying to delete backup: {}",
-                    e.what());
-    }
+  // The backups are listed again once the backup has been deleted.
+  deleteButton->setEnabled(false);
 
-    QMessageBox::critical(
-        this, qTranslate("Error"), qTranslate("Failed to delete backup."));
-  }
+  emit loadOrderBackupDeletionRequested(backups.at(row.value()).path);
 }
 }
@@ -27,6 +27,7 @@
 #define LOOT_GUI_QT_RESTORE_LOAD_ORDER_DIALOG
 
 #include <QtWidgets/QDialog>
+#include <QtWidgets/QDialogButtonBox>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QListWidget>
 #include <QtWidgets/QPushButton>
@@ -45,8 +46,19 @@ public:
   void setLoadOrderBackups(
       const std::vector<LoadOrderBackup> &loadOrderBackups);
 
+  // Sets the load order of a listed backup once it has been read.
+  void setLoadOrderBackupLoadOrder(const LoadOrderBackup &backup);
+
   std::optional<LoadOrderBackup> getSelectedLoadOrderBackup() const;
 
+signals:
+  // Backups are listed without their load orders, and reading or deleting a
+  // backup involves file I/O that must happen on the game worker, so the
+  // dialog asks for it to be done.
+  void loadOrderBackupReadRequested(const LoadOrderBackup &backup);
+  void loadOrderBackupDeletionRequested(
+      const std::filesystem::path &backupPath);
+
 private:
   QLabel *selectLabel{new QLabel(this)};
   QLabel *currentLoadOrderLabel{new QLabel(this)};
@@ -56,12 +68,16 @@ private:
   QListWidget *currentLoadOrderList{new QListWidget(this)};
   QListWidget *backupLoadOrderList{new QListWidget(this)};
   QPushButton *deleteButton{new QPushButton(this)};
+  QDialogButtonBox *buttonBox{new QDialogButtonBox(this)};
 
   std::vector<LoadOrderBackup> backups;
 
   void setupUi();
   void translateUi();
 
+  std::optional<size_t> getSelectedRow() const;
+  void showLoadOrderBackup(const LoadOrderBackup &backup);
+
 private slots:
   void handleBackupSelectionChanged(const QItemSelection &selected,
                                     const QItemSelection &);
@@ -107,8 +107,9 @@ void SettingsDialog::initialiseInputs(
   }
 }
 
-void SettingsDialog::recordInputValues(LootState& state) {
-  generalTab->recordInputValues(state.getSettings());
+std::vector<GameSettings> SettingsDialog::recordInputValues(
+    LootSettings& settings) {
+  generalTab->recordInputValues(settings);
 
   std::vector<GameSettings> gameSettings;
   // First tab is for general settings.
@@ -117,9 +118,7 @@ void SettingsDialog::recordInputValues(LootState& state) {
     gameSettings.push_back(gameTab->getGameSettings());
   }
 
-  gameSettings = state.loadInstalledGames(gameSettings);
-
-  state.getSettings().storeGameSettings(gameSettings);
+  return gameSettings;
 }
 
 void SettingsDialog::setupUi() {
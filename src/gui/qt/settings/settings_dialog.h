@@ -47,7 +47,9 @@ public:
                         const std::vector<std::string> &themes,
                         const std::optional<std::string> &currentGameFolder);
 
-  void recordInputValues(LootState &state);
+  // Records the general settings, and returns the games' settings so that the
+  // installed games can be updated using them.
+  std::vector<GameSettings> recordInputValues(LootSettings &settings);
 
 private:
   QListWidget *listWidget{new QListWidget(this)};
@@ -29,16 +29,55 @@
 #include <QtCore/QTextStream>
 #include <QtWidgets/QApplication>
 #include <QtWidgets/QStyle>
+#include <algorithm>
+#include <array>
 #include <boost/algorithm/string/predicate.hpp>
 #include <set>
+#include <toml++/toml.h>
 
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
 
 namespace {
+using loot::getLogger;
+
 static constexpr std::string_view QSS_SUFFIX = ".theme.qss";
+static constexpr std::string_view TOML_SUFFIX = ".theme.toml";
+
+static constexpr std::array<std::pair<std::string_view, QPalette::ColorRole>,
+                            20>
+    PALETTE_ROLES{{
+        {"window", QPalette::Window},
+        {"window-text", QPalette::WindowText},
+        {"base", QPalette::Base},
+        {"alternate-base", QPalette::AlternateBase},
+        {"tool-tip-base", QPalette::ToolTipBase},
+        {"tool-tip-text", QPalette::ToolTipText},
+        {"placeholder-text", QPalette::PlaceholderText},
+        {"text", QPalette::Text},
+        {"button", QPalette::Button},
+        {"button-text", QPalette::ButtonText},
+        {"bright-text", QPalette::BrightText},
+        {"light", QPalette::Light},
+        {"midlight", QPalette::Midlight},
+        {"mid", QPalette::Mid},
+        {"dark", QPalette::Dark},
+        {"shadow", QPalette::Shadow},
+        {"highlight", QPalette::Highlight},
+        {"highlighted-text", QPalette::HighlightedText},
+        {"link", QPalette::Link},
+        {"link-visited", QPalette::LinkVisited},
+    }};
 
-std::optional<QString> loadStyleSheet(const QString& resourcePath) {
+static constexpr std::array<std::pair<std::string_view, QPalette::ColorGroup>,
+                            3>
+    PALETTE_GROUPS{{
+        {"active", QPalette::Active},
+        {"inactive", QPalette::Inactive},
+        {"disabled", QPalette::Disabled},
+    }};
+
+std::optional<QString> readFile(const QString& resourcePath) {
   QFile file(resourcePath);
   if (!file.exists()) {
     return std::nullopt;
@@ -48,73 +87,184 @@ std::optional<QString> loadStyleSheet(const QString& resourcePath) {
   QTextStream ts(&file);
   return ts.readAll();
 }
-}
-
-namespace loot {
-std::optional<QString> loadStyleSheet(const std::filesystem::path& themesPath,
-                                      const std::string& themeName) {
-  // First try loading the theme from the filesystem, then try loading from
-  // built-in resources, then fall back to the default theme (which itself
-  // will load from filesystem then built-in resources).
 
+std::optional<QString> readThemeFile(const std::filesystem::path& themesPath,
+                                     const std::string& themeName,
+                                     std::string_view suffix,
+                                     loot::ThemeSource source) {
 #ifdef _WIN32
   if (QApplication::style()->name() == "fusion") {
     // Try loading a fusion-and-windows-specific version of the theme.
     if (!boost::ends_with(themeName, "-fusion-windows")) {
-      auto stylesheet =
-          loadStyleSheet(themesPath, themeName + "-fusion-windows");
-      if (stylesheet.has_value()) {
-        return stylesheet;
+      auto content = readThemeFile(
+          themesPath, themeName + "-fusion-windows", suffix, source);
+      if (content.has_value()) {
+        return content;
       }
     }
   } else if (QApplication::style()->name() == "windows11") {
     // Try loading a windows11-specific version of the theme.
     if (!boost::ends_with(themeName, "-windows11")) {
-      auto stylesheet = loadStyleSheet(themesPath, themeName + "-windows11");
-      if (stylesheet.has_value()) {
-        return stylesheet;
+      auto content = readThemeFile(
+          themesPath, themeName + "-windows11", suffix, source);
+      if (content.has_value()) {
+        return content;
       }
     }
   }
 #endif
 
+  const auto filename = themeName + std::string(suffix);
+
   const auto logger = getLogger();
   if (logger) {
-    logger->debug("Loading style sheet for the \"{}\" theme...", themeName);
+    logger->debug("Loading theme file \"{}\"...", filename);
   }
 
-  const auto filesystemPath =
-      (themesPath / (themeName + std::string(QSS_SUFFIX)));
-  auto styleSheet =
-      ::loadStyleSheet(QString::fromStdString(filesystemPath.u8string()));
-  if (styleSheet.has_value()) {
-    return styleSheet.value();
-  }
+  if (source == loot::ThemeSource::filesystem) {
+    const auto filesystemPath = themesPath / filename;
+    auto content = readFile(QString::fromStdString(filesystemPath.u8string()));
+    if (content.has_value()) {
+      return content.value();
+    }
 
-  if (logger) {
-    logger->debug(
-        "Failed to find the style sheet for the \"{}\" theme in the "
-        "filesystem, attempting to load from built-in resources...",
-        themeName);
+    if (logger) {
+      logger->debug("Failed to find the theme file \"{}\" in the filesystem.",
+                    filename);
+    }
+
+    return std::nullopt;
   }
 
   const auto builtInPath =
-      QString(":/themes/%1.theme.qss").arg(QString::fromStdString(themeName));
-  styleSheet = ::loadStyleSheet(builtInPath);
-  if (styleSheet.has_value()) {
-    return styleSheet.value();
+      QString(":/themes/%1").arg(QString::fromStdString(filename));
+  auto content = readFile(builtInPath);
+  if (content.has_value()) {
+    return content.value();
   }
 
   if (logger) {
-    logger->error(
-        "Failed to find the style sheet for the \"{}\" theme in the filesystem "
-        "or built-in resources.",
-        themeName);
+    logger->debug(
+        "Failed to find the theme file \"{}\" in the built-in resources.",
+        filename);
   }
 
   return std::nullopt;
 }
 
+QColor parseColor(const toml::node& node, std::string_view key) {
+  const auto value = node.value<std::string>();
+  if (!value.has_value()) {
+    throw std::runtime_error("The value of \"" + std::string(key) +
+                             "\" is not a string");
+  }
+
+  const auto color = QColor::fromString(QString::fromStdString(*value));
+  if (!color.isValid()) {
+    throw std::runtime_error("\"" + *value + "\" is not a valid colour");
+  }
+
+  return color;
+}
+
+std::optional<QColor> getColor(const toml::table& table, std::string_view key) {
+  const auto node = table.get(key);
+  if (node == nullptr) {
+    return std::nullopt;
+  }
+
+  return parseColor(*node, key);
+}
+
+void setPaletteColors(QPalette& palette,
+                      const toml::table& table,
+                      QPalette::ColorGroup group) {
+  for (const auto& [key, node] : table) {
+    if (node.is_table()) {
+      // Colour group tables are handled separately.
+      continue;
+    }
+
+    const auto role = std::find_if(
+        PALETTE_ROLES.begin(), PALETTE_ROLES.end(), [&](const auto& entry) {
+          return entry.first == key.str();
+        });
+    if (role == PALETTE_ROLES.end()) {
+      throw std::runtime_error("\"" + std::string(key.str()) +
+                               "\" is not a recognised palette colour role");
+    }
+
+    palette.setColor(group, role->second, parseColor(node, key.str()));
+  }
+}
+}
+
+namespace loot {
+std::optional<QString> loadStyleSheet(const std::filesystem::path& themesPath,
+                                      const std::string& themeName,
+                                      ThemeSource source) {
+  return readThemeFile(themesPath, themeName, QSS_SUFFIX, source);
+}
+
+std::optional<PaletteTheme> loadPaletteTheme(
+    const std::filesystem::path& themesPath,
+    const std::string& themeName,
+    ThemeSource source) {
+  const auto content =
+      readThemeFile(themesPath, themeName, TOML_SUFFIX, source);
+  if (!content.has_value()) {
+    return std::nullopt;
+  }
+
+  try {
+    const auto source = content.value().toStdString();
+    const auto table =
+        toml::parse(source, themeName + std::string(TOML_SUFFIX));
+
+    PaletteTheme theme;
+
+    if (const auto palette = table["palette"].as_table()) {
+      setPaletteColors(theme.palette, *palette, QPalette::All);
+
+      for (const auto& [name, group] : PALETTE_GROUPS) {
+        if (const auto groupTable = (*palette)[name].as_table()) {
+          setPaletteColors(theme.palette, *groupTable, group);
+        }
+      }
+    }
+
+    if (const auto colors = table["colors"].as_table()) {
+      theme.colors.normalIcon = getColor(*colors, "icon-normal");
+      theme.colors.disabledIcon = getColor(*colors, "icon-disabled");
+      theme.colors.selectedIcon = getColor(*colors, "icon-selected");
+      theme.colors.selectedSidebarPluginText =
+          getColor(*colors, "sidebar-selected-plugin-text");
+      theme.colors.unselectedSidebarPluginGroup =
+          getColor(*colors, "sidebar-unselected-plugin-group");
+      theme.colors.graphMasterlistMetadata =
+          getColor(*colors, "graph-masterlist-metadata");
+      theme.colors.graphUserMetadata = getColor(*colors, "graph-user-metadata");
+      theme.colors.graphBackground = getColor(*colors, "graph-background");
+    }
+
+    if (const auto styleSheets = table["style-sheets"].as_table()) {
+      theme.cardsStyleSheet = QString::fromStdString(
+          (*styleSheets)["cards"].value_or(std::string()));
+      theme.applicationStyleSheet = QString::fromStdString(
+          (*styleSheets)["application"].value_or(std::string()));
+    }
+
+    return theme;
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to load the \"{}\" theme: {}", themeName, e.what());
+    }
+
+    return std::nullopt;
+  }
+}
+
 std::vector<std::string> findThemes(const std::filesystem::path& themesPath) {
   std::set<std::string> themes(
       {"default", "default-light", "default-dark", "dark"});
@@ -130,16 +280,22 @@ std::vector<std::string> findThemes(const std::filesystem::path& themesPath) {
     }
 
     const auto filename = entry.path().filename().u8string();
-    if (!boost::iends_with(filename, QSS_SUFFIX)) {
+
+    std::string_view suffix;
+    if (boost::iends_with(filename, QSS_SUFFIX)) {
+      suffix = QSS_SUFFIX;
+    } else if (boost::iends_with(filename, TOML_SUFFIX)) {
+      suffix = TOML_SUFFIX;
+    } else {
       continue;
     }
 
     if (logger) {
-      logger->debug("Found theme QSS file: {}", filename);
+      logger->debug("Found theme file: {}", filename);
     }
 
     const auto themeFullName =
-        filename.substr(0, filename.size() - QSS_SUFFIX.size());
+        filename.substr(0, filename.size() - suffix.size());
 
     std::string themeName;
     if (boost::ends_with(themeFullName, LIGHT_THEME_SUFFIX)) {
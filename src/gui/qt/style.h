@@ -27,6 +27,8 @@
 #define LOOT_GUI_QT_STYLE
 
 #include <QtCore/QString>
+#include <QtGui/QColor>
+#include <QtGui/QPalette>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -36,8 +38,51 @@ namespace loot {
 constexpr std::string_view DARK_THEME_SUFFIX = "-dark";
 constexpr std::string_view LIGHT_THEME_SUFFIX = "-light";
 
+// Colours that don't correspond to palette roles. They're used directly by the
+// widgets that need them, and any that a theme doesn't set are derived from
+// the application palette.
+struct ThemeColors {
+  std::optional<QColor> normalIcon;
+  std::optional<QColor> disabledIcon;
+  std::optional<QColor> selectedIcon;
+  std::optional<QColor> selectedSidebarPluginText;
+  std::optional<QColor> unselectedSidebarPluginGroup;
+  std::optional<QColor> graphMasterlistMetadata;
+  std::optional<QColor> graphUserMetadata;
+  std::optional<QColor> graphBackground;
+};
+
+// A theme defined by a <theme name>.theme.toml file. Applying it changes the
+// application palette instead of the application style sheet, which is much
+// cheaper than re-polishing every widget.
+struct PaletteTheme {
+  // Only the roles that the theme sets are resolved, so the rest are taken
+  // from the system palette.
+  QPalette palette;
+  ThemeColors colors;
+  // Rules for the plugin cards view and its cards, for selectors that depend
+  // on widget properties and names.
+  QString cardsStyleSheet;
+  // Rules for the whole application. Themes should only use this for styling
+  // that can't be done any other way.
+  QString applicationStyleSheet;
+};
+
+// Where to load a theme's files from. Themes in the filesystem take precedence
+// over built-in themes, whichever format their files are in, so that they can
+// override built-in themes.
+enum struct ThemeSource { filesystem, builtIn };
+
 std::optional<QString> loadStyleSheet(const std::filesystem::path& themesPath,
-                                      const std::string& themeName);
+                                      const std::string& themeName,
+                                      ThemeSource source);
+
+// Returns std::nullopt if the theme has no .theme.toml file or if the file is
+// invalid.
+std::optional<PaletteTheme> loadPaletteTheme(
+    const std::filesystem::path& themesPath,
+    const std::string& themeName,
+    ThemeSource source);
 
 std::vector<std::string> findThemes(const std::filesystem::path& themesPath);
 }
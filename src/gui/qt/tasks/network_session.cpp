@@ -0,0 +1,202 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui/qt/tasks/network_session.h"
+
+#include <QtCore/QThread>
+
+#include "gui/state/logging.h"
+
+namespace loot {
+SharedReply::SharedReply(QNetworkReply* reply, QObject* parent) :
+    QObject(parent), reply(reply) {
+  connect(reply, &QNetworkReply::finished, this, &SharedReply::onFinished);
+  connect(reply, &QNetworkReply::sslErrors, this, &SharedReply::onSslErrors);
+}
+
+bool SharedReply::hasError() const { return errorString.has_value(); }
+
+const std::string& SharedReply::getErrorString() const {
+  static const std::string EMPTY_STRING;
+
+  return errorString.has_value() ? errorString.value() : EMPTY_STRING;
+}
+
+bool SharedReply::isNotModified() const {
+  static constexpr int HTTP_STATUS_NOT_MODIFIED = 304;
+
+  return statusCode == HTTP_STATUS_NOT_MODIFIED;
+}
+
+HttpValidators SharedReply::getValidators() const { return validators; }
+
+std::optional<QByteArray> SharedReply::getData() const {
+  static constexpr int HTTP_STATUS_OK = 200;
+  static constexpr int HTTP_STATUS_BAD_REQUEST = 400;
+
+  if (statusCode < HTTP_STATUS_OK || statusCode >= HTTP_STATUS_BAD_REQUEST) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->error(
+          "Unexpected HTTP response status code: {}. Response body is: {}",
+          statusCode,
+          QString::fromUtf8(data).toStdString());
+    }
+
+    return std::nullopt;
+  }
+
+  return data;
+}
+
+void SharedReply::cancel() {
+  if (requestCount > 0) {
+    requestCount -= 1;
+  }
+
+  if (requestCount > 0 || reply == nullptr || !reply->isRunning()) {
+    return;
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->debug("Aborting the cancelled request to GET {}",
+                  reply->url().toString().toStdString());
+  }
+
+  reply->abort();
+}
+
+void SharedReply::onFinished() {
+  const auto reply = qobject_cast<QNetworkReply*>(sender());
+
+  statusCode =
+      reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+  validators = getHttpValidators(*reply);
+  data = reply->readAll();
+
+  if (reply->error() != QNetworkReply::NoError) {
+    errorString = reply->errorString().toStdString();
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->error("Network error code {}, description is: {}",
+                    static_cast<int>(reply->error()),
+                    errorString.value());
+    }
+  }
+
+  reply->deleteLater();
+
+  emit finished();
+}
+
+void SharedReply::onSslErrors(const QList<QSslError>& errors) {
+  const auto logger = getLogger();
+  if (logger) {
+    for (const auto& error : errors) {
+      logger->error("SSL error: {}", error.errorString().toStdString());
+    }
+  }
+}
+
+NetworkSession::~NetworkSession() {
+  if (networkAccessManager == nullptr) {
+    return;
+  }
+
+  // Replies that are still in flight must not call back into this session
+  // once it has been destroyed.
+  for (const auto& [key, reply] : pendingReplies) {
+    QObject::disconnect(
+        reply, &SharedReply::finished, networkAccessManager, nullptr);
+  }
+
+  // Deleting the manager also deletes its replies. If it belongs to another
+  // thread that's still running it must be deleted by that thread, but if
+  // that thread has finished it won't process a deferred delete, so it's
+  // safe and necessary to delete the manager now.
+  const auto managerThread = networkAccessManager->thread();
+  if (managerThread == nullptr || managerThread == QThread::currentThread() ||
+      managerThread->isFinished()) {
+    delete networkAccessManager;
+  } else {
+    networkAccessManager->deleteLater();
+  }
+}
+
+SharedReply* NetworkSession::get(QNetworkRequest request) {
+  // Delay construction of the manager so that it's created in the thread that
+  // the session is used from.
+  if (networkAccessManager == nullptr) {
+    networkAccessManager = new QNetworkAccessManager();
+  }
+
+  auto key = std::make_tuple(request.url().toString(),
+                             request.rawHeader("If-None-Match"),
+                             request.rawHeader("If-Modified-Since"));
+
+  const auto it = pendingReplies.find(key);
+  if (it != pendingReplies.end()) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug("Sharing the in-flight response for a request to GET {}",
+                    request.url().toString().toStdString());
+    }
+
+    it->second->requestCount += 1;
+
+    return it->second;
+  }
+
+  // Qt negotiates compression and keeps connections alive by default, but
+  // HTTP/2 is enabled explicitly so that concurrent requests to the same
+  // host can be multiplexed over one connection.
+  request.setAttribute(QNetworkRequest::Http2AllowedAttribute, true);
+
+  const auto reply = networkAccessManager->get(request);
+  const auto sharedReply = new SharedReply(reply, networkAccessManager);
+  sharedReply->requestCount = 1;
+
+  pendingReplies.emplace(key, sharedReply);
+
+  // Once the reply has finished, later requests should be sent again, and
+  // the reply can be deleted once the tasks that are waiting for it have
+  // handled its finished signal. The manager is the context so that the
+  // connection is broken when the session deletes it.
+  QObject::connect(sharedReply,
+                   &SharedReply::finished,
+                   networkAccessManager,
+                   [this, key = std::move(key)]() {
+                     const auto it = pendingReplies.find(key);
+                     if (it != pendingReplies.end()) {
+                       it->second->deleteLater();
+                       pendingReplies.erase(it);
+                     }
+                   });
+
+  return sharedReply;
+}
+}
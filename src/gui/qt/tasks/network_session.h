@@ -0,0 +1,107 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QT_TASKS_NETWORK_SESSION
+#define LOOT_GUI_QT_TASKS_NETWORK_SESSION
+
+#include <QtCore/QPointer>
+#include <QtNetwork/QNetworkAccessManager>
+#include <QtNetwork/QNetworkReply>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+
+#include "gui/qt/helpers.h"
+
+namespace loot {
+// The response to a request made through a NetworkSession, which may be
+// shared by several tasks. Unlike a QNetworkReply, its data can be read any
+// number of times once it has finished.
+class SharedReply : public QObject {
+  Q_OBJECT
+public:
+  SharedReply(QNetworkReply* reply, QObject* parent);
+
+  bool hasError() const;
+  const std::string& getErrorString() const;
+
+  bool isNotModified() const;
+  HttpValidators getValidators() const;
+
+  // Returns nullopt if the response's status code isn't a success code.
+  std::optional<QByteArray> getData() const;
+
+  // Stops waiting for the response on behalf of one of the requests that
+  // share it. Once all of them have done so, the request is aborted and the
+  // reply finishes with an error.
+  void cancel();
+
+signals:
+  void finished();
+
+private:
+  friend class NetworkSession;
+
+  QPointer<QNetworkReply> reply;
+  unsigned int requestCount{0};
+  int statusCode{0};
+  QByteArray data;
+  HttpValidators validators;
+  std::optional<std::string> errorString;
+
+private slots:
+  void onFinished();
+  void onSslErrors(const QList<QSslError>& errors);
+};
+
+// Shares one QNetworkAccessManager between a batch of network tasks so that
+// they can reuse connections, and shares the responses to identical requests
+// that are in flight at the same time, so that each URL is only downloaded
+// once. A session must only be used from one thread, which is the thread that
+// first calls get().
+class NetworkSession {
+public:
+  NetworkSession() = default;
+  NetworkSession(const NetworkSession&) = delete;
+  NetworkSession(NetworkSession&&) = delete;
+  ~NetworkSession();
+
+  NetworkSession& operator=(const NetworkSession&) = delete;
+  NetworkSession& operator=(NetworkSession&&) = delete;
+
+  SharedReply* get(QNetworkRequest request);
+
+private:
+  // The URL and the conditional request headers, as requests with different
+  // validators may get different responses.
+  using RequestKey = std::tuple<QString, QByteArray, QByteArray>;
+
+  QNetworkAccessManager* networkAccessManager{nullptr};
+  std::map<RequestKey, SharedReply*> pendingReplies;
+};
+}
+
+#endif
@@ -28,6 +28,16 @@
 #include "gui/translate.h"
 
 namespace loot {
+NetworkTask::~NetworkTask() {
+  if (cancellationCallbackId.has_value()) {
+    cancellationToken.removeCallback(cancellationCallbackId.value());
+  }
+}
+
+void NetworkTask::setCancellationToken(CancellationToken token) {
+  cancellationToken = std::move(token);
+}
+
 void NetworkTask::handleException(const std::exception &exception) {
   const auto logger = getLogger();
   if (logger) {
@@ -42,6 +52,43 @@ void NetworkTask::handleException(const std::exception &exception) {
   emit this->error(message);
 }
 
+bool NetworkTask::stopIfCancelled() {
+  if (!cancellationToken.isCancelled()) {
+    return false;
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info("Network task was cancelled.");
+  }
+
+  emit error(OperationCancelledError().what());
+
+  return true;
+}
+
+void NetworkTask::cancelReplyOnCancellation(SharedReply *reply) {
+  if (cancellationCallbackId.has_value()) {
+    cancellationToken.removeCallback(cancellationCallbackId.value());
+  }
+
+  pendingReply = reply;
+
+  // The token may be cancelled from any thread, but the reply must be
+  // cancelled from this task's thread.
+  cancellationCallbackId = cancellationToken.addCallback([this]() {
+    QMetaObject::invokeMethod(
+        this, [this]() { cancelPendingReply(); }, Qt::QueuedConnection);
+  });
+}
+
+void NetworkTask::cancelPendingReply() {
+  if (pendingReply != nullptr) {
+    pendingReply->cancel();
+    pendingReply = nullptr;
+  }
+}
+
 void NetworkTask::onNetworkError(QNetworkReply::NetworkError networkError) {
   try {
     const auto reply = qobject_cast<QIODevice *>(sender());
@@ -26,21 +26,59 @@
 #ifndef LOOT_GUI_QT_TASKS_NETWORK_TASK
 #define LOOT_GUI_QT_TASKS_NETWORK_TASK
 
+#include <QtConcurrent/QtConcurrent>
+#include <QtCore/QPointer>
 #include <QtNetwork/QNetworkReply>
+#include <optional>
 
+#include "gui/qt/tasks/network_session.h"
 #include "gui/qt/tasks/tasks.h"
+#include "gui/state/cancellation_token.h"
 
 namespace loot {
 class NetworkTask : public Task {
   Q_OBJECT
+public:
+  ~NetworkTask() override;
+
+  void setCancellationToken(CancellationToken token);
+
 protected:
   static constexpr int TRANSFER_TIMEOUT_MS{30000};
 
   void handleException(const std::exception &exception);
 
+  // Emits error() and returns true if the task has been cancelled, so that
+  // a cancelled update stops before it writes anything.
+  bool stopIfCancelled();
+
+  // Cancels the given reply if the task is cancelled while waiting for it, so
+  // that the request is aborted instead of running until it times out.
+  void cancelReplyOnCancellation(SharedReply *reply);
+
+  // Network tasks run on the UI thread so that they don't hold up queries
+  // while waiting for replies, but the files that they write are read by
+  // queries, so writing them is done on the game worker. This runs the given
+  // function there and then emits finished() with its result, or error() if
+  // it throws.
+  template<typename F>
+  void finishOnGameWorker(F function) {
+    QtConcurrent::run(getGameWorker(), std::move(function))
+        .then(this, [this](const auto &result) { emit finished(result); })
+        .onFailed(this,
+                  [this](const std::exception &e) { handleException(e); });
+  }
+
 protected slots:
   void onNetworkError(QNetworkReply::NetworkError error);
   void onSSLError(const QList<QSslError> &errors);
+
+private:
+  void cancelPendingReply();
+
+  CancellationToken cancellationToken;
+  QPointer<SharedReply> pendingReply;
+  std::optional<CancellationToken::CallbackId> cancellationCallbackId;
 };
 }
 
@@ -26,8 +26,27 @@
 #include "gui/qt/tasks/tasks.h"
 
 #include <QtConcurrent/QtConcurrent>
+#include <QtCore/QCoreApplication>
+#include <QtCore/QThread>
+#include <QtCore/QThreadPool>
 
 namespace loot {
+QThreadPool *getGameWorker() {
+  static const auto pool = []() {
+    const auto threadPool = new QThreadPool(QCoreApplication::instance());
+    threadPool->setMaxThreadCount(1);
+    return threadPool;
+  }();
+
+  return pool;
+}
+
+void ProgressUpdater::sendProgressUpdate(const QueryProgress &progress) {
+  emit progressUpdate(QString::fromStdString(progress.stage),
+                      static_cast<int>(progress.completed),
+                      static_cast<int>(progress.total));
+}
+
 QueryTask::QueryTask(std::unique_ptr<Query> query) : query(std::move(query)) {}
 
 void QueryTask::execute() {
@@ -38,6 +57,13 @@ void QueryTask::execute() {
     }
 
     emit finished(query->executeLogic());
+  } catch (const OperationCancelledError &e) {
+    auto logger = getLogger();
+    if (logger) {
+      logger->info("Query was cancelled.");
+    }
+
+    emit error(e.what());
   } catch (const std::exception &e) {
     auto logger = getLogger();
     if (logger) {
@@ -55,7 +81,7 @@ void QueryTask::execute() {
 QFuture<QueryResult> executeBackgroundQuery(std::unique_ptr<Query> query) {
   const auto sharedQuery = std::shared_ptr<Query>(std::move(query));
 
-  return QtConcurrent::run([sharedQuery]() {
+  return QtConcurrent::run(getGameWorker(), [sharedQuery]() {
     if (sharedQuery == nullptr) {
       throw std::runtime_error(
           "Attempted to execute a query with no query set!");
@@ -63,6 +89,13 @@ QFuture<QueryResult> executeBackgroundQuery(std::unique_ptr<Query> query) {
 
     try {
       return sharedQuery->executeLogic();
+    } catch (const OperationCancelledError &) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->info("Query was cancelled.");
+      }
+
+      throw;
     } catch (const std::exception &e) {
       const auto logger = getLogger();
       if (logger) {
@@ -105,40 +138,28 @@ QFuture<QList<QFuture<QueryResult>>> whenAllTasks(
   return QtFuture::whenAll(futures.begin(), futures.end());
 }
 
-void executeConcurrentBackgroundTasks(const std::vector<Task *> &tasks,
-                                      QFuture<void> whenAll) {
-  QThread *workerThread = new QThread();
-
-  QObject::connect(
-      workerThread, &QThread::finished, workerThread, &QObject::deleteLater);
-
-  whenAll.then(workerThread, [workerThread]() { workerThread->quit(); });
-
-  workerThread->start();
-
-  for (auto task : tasks) {
-    task->moveToThread(workerThread);
+void executeConcurrentBackgroundTasks(const std::vector<Task *> &tasks) {
+  for (const auto task : tasks) {
+    QObject::connect(task, &Task::finished, task, &QObject::deleteLater);
+    QObject::connect(task, &Task::error, task, &QObject::deleteLater);
 
     QMetaObject::invokeMethod(task, "execute", Qt::QueuedConnection);
   }
 }
 
 QFuture<QueryResult> executeBackgroundTask(Task *task) {
-  QThread *workerThread = new QThread();
+  auto future = taskFuture(task);
 
-  QObject::connect(
-      workerThread, &QThread::finished, workerThread, &QObject::deleteLater);
+  // Release the task from the current thread so that the worker can take it.
+  task->moveToThread(nullptr);
 
-  workerThread->start();
+  QtConcurrent::run(getGameWorker(), [task]() {
+    task->moveToThread(QThread::currentThread());
+    task->execute();
 
-  task->moveToThread(workerThread);
-
-  QMetaObject::invokeMethod(task, "execute", Qt::QueuedConnection);
+    delete task;
+  });
 
-  return taskFuture(task).then(workerThread,
-                               [workerThread](QueryResult result) {
-                                 workerThread->quit();
-                                 return result;
-                               });
+  return future;
 }
 }
@@ -29,6 +29,7 @@
 #include <QtCore/QFuture>
 #include <QtCore/QMetaType>
 #include <QtCore/QString>
+#include <QtCore/QThreadPool>
 
 #include "gui/query/query.h"
 
@@ -37,8 +38,13 @@ Q_DECLARE_METATYPE(loot::QueryResult);
 namespace loot {
 class ProgressUpdater : public QObject {
   Q_OBJECT
+public:
+  // Can be called from any thread.
+  void sendProgressUpdate(const QueryProgress &progress);
+
 signals:
-  void progressUpdate(const QString &message);
+  // A total of zero means that the amount of work isn't known.
+  void progressUpdate(const QString &message, int completed, int total);
 };
 
 class Task : public QObject {
@@ -63,6 +69,13 @@ private:
   std::unique_ptr<Query> query;
 };
 
+// Queries read and change the current game, and the game isn't safe to use
+// from more than one thread at a time, so all queries run one after another on
+// a single worker thread. Other background work that writes the game's files
+// (e.g. writing updated masterlists) also runs on it so that it can't race
+// with queries. The UI reads the game's published snapshots instead.
+QThreadPool *getGameWorker();
+
 QFuture<QueryResult> executeBackgroundQuery(std::unique_ptr<Query> query);
 
 QFuture<QueryResult> taskFuture(Task *task);
@@ -70,9 +83,14 @@ QFuture<QueryResult> taskFuture(Task *task);
 QFuture<QList<QFuture<QueryResult>>> whenAllTasks(
     const std::vector<Task *> &tasks);
 
-void executeConcurrentBackgroundTasks(const std::vector<Task *> &tasks,
-                                      QFuture<void> whenAll);
+// Starts the tasks on the current thread once control returns to its event
+// loop, and deletes each task once it has finished or errored. The tasks must
+// not block, so that they can run concurrently: this is intended for network
+// tasks, which spend most of their time waiting for replies.
+void executeConcurrentBackgroundTasks(const std::vector<Task *> &tasks);
 
+// Runs the task on the game worker, which takes ownership of it and deletes
+// it once it has finished or errored. The task must not need an event loop.
 QFuture<QueryResult> executeBackgroundTask(Task *task);
 }
 
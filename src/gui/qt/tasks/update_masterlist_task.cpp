@@ -28,25 +28,27 @@
 #include "gui/qt/helpers.h"
 
 namespace loot {
-UpdatePreludeTask::UpdatePreludeTask(const LootState &state) :
+UpdatePreludeTask::UpdatePreludeTask(
+    const LootState &state,
+    std::shared_ptr<NetworkSession> networkSession) :
     preludeSource(state.getSettings().getPreludeSource()),
-    preludePath(state.getPaths().getPreludePath()) {}
+    preludePath(state.getPaths().getPreludePath()),
+    networkSession(std::move(networkSession)) {}
 
 void UpdatePreludeTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
+    if (stopIfCancelled()) {
+      return;
     }
 
     if (!isValidUrl(preludeSource)) {
       // Treat the source as a local path, and copy the file from there.
       auto sourcePath = std::filesystem::u8path(preludeSource);
 
-      const auto preludeUpdated = updateFile(sourcePath, preludePath);
-
-      emit finished(preludeUpdated);
+      finishOnGameWorker([sourcePath, preludePath = preludePath]() {
+        TraceSpan span("UpdatePreludeTask::updateFile");
+        return updateFile(sourcePath, preludePath);
+      });
       return;
     }
 
@@ -56,79 +58,108 @@ void UpdatePreludeTask::execute() {
                     preludeSource);
     }
 
-    QNetworkRequest request(QUrl(QString::fromStdString(preludeSource)));
+    auto request = createConditionalRequest(preludeSource, preludePath);
     request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
 
-    const auto reply = networkAccessManager->get(request);
+    // The span ends when the reply finishes, whether or not it succeeded.
+    requestSpan.emplace("UpdatePreludeTask request");
+    const auto reply = networkSession->get(request);
+    cancelReplyOnCancellation(reply);
 
     connect(reply,
-            &QNetworkReply::finished,
+            &SharedReply::finished,
             this,
             &UpdatePreludeTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdatePreludeTask::onNetworkError);
-    connect(
-        reply, &QNetworkReply::sslErrors, this, &UpdatePreludeTask::onSSLError);
   } catch (const std::exception &e) {
     handleException(e);
   }
 }
 
 void UpdatePreludeTask::onReplyFinished() {
+  requestSpan.reset();
+
   try {
+    TraceSpan span("UpdatePreludeTask::onReplyFinished");
+
+    if (stopIfCancelled()) {
+      return;
+    }
+
     auto logger = getLogger();
     if (logger) {
       logger->trace("Finished receiving a response for prelude update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto reply = qobject_cast<SharedReply *>(sender());
+    if (reply->hasError()) {
+      emit error(reply->getErrorString());
+      return;
+    }
+
+    const auto validators = reply->getValidators();
+
+    if (reply->isNotModified()) {
+      // The file hasn't changed since it was last downloaded, so there's
+      // nothing to read or hash.
+      finishOnGameWorker([preludePath = preludePath, validators]() {
+        updateFileRevisionTimestamp(preludePath, validators);
+        return false;
+      });
+      return;
+    }
+
+    auto responseData = reply->getData();
 
     if (!responseData.has_value()) {
       emit error("Prelude update response errored");
       return;
     }
 
-    const auto preludeUpdated =
-        updateFileWithData(preludePath, responseData.value());
-
-    emit finished(preludeUpdated);
+    finishOnGameWorker([preludePath = preludePath,
+                        data = std::move(responseData.value()),
+                        validators]() {
+      return updateFileWithData(preludePath, data, validators);
+    });
   } catch (const std::exception &e) {
     handleException(e);
   }
 }
 
-UpdateMasterlistTask::UpdateMasterlistTask(const gui::Game &game) :
+UpdateMasterlistTask::UpdateMasterlistTask(
+    const gui::Game &game,
+    std::shared_ptr<NetworkSession> networkSession) :
     UpdateMasterlistTask(game.getSettings().getFolderName(),
                          game.getSettings().getMasterlistSource(),
-                         game.getMasterlistPath()) {}
+                         game.getMasterlistPath(),
+                         std::move(networkSession)) {}
 
 UpdateMasterlistTask::UpdateMasterlistTask(
     const std::string &gameFolderName,
     const std::string &masterlistSource,
-    const std::filesystem::path &masterlistPath) :
+    const std::filesystem::path &masterlistPath,
+    std::shared_ptr<NetworkSession> networkSession) :
     gameFolderName(gameFolderName),
     masterlistSource(masterlistSource),
-    masterlistPath(masterlistPath) {}
+    masterlistPath(masterlistPath),
+    networkSession(std::move(networkSession)) {}
 
 void UpdateMasterlistTask::execute() {
   try {
-    // Delay construction of the manager so that it's created in the correct
-    // thread.
-    if (networkAccessManager == nullptr) {
-      networkAccessManager = new QNetworkAccessManager(this);
+    if (stopIfCancelled()) {
+      return;
     }
 
     if (!isValidUrl(masterlistSource)) {
       // Treat the source as a local path, and copy the file from there.
       const auto sourcePath = std::filesystem::u8path(masterlistSource);
 
-      const auto masterlistUpdated = updateFile(sourcePath, masterlistPath);
-
-      emit finished(std::make_pair(gameFolderName, masterlistUpdated));
+      finishOnGameWorker([gameFolderName = gameFolderName,
+                          sourcePath,
+                          masterlistPath = masterlistPath]() {
+        TraceSpan span("UpdateMasterlistTask::updateFile");
+        return std::make_pair(gameFolderName,
+                              updateFile(sourcePath, masterlistPath));
+      });
       return;
     }
 
@@ -138,48 +169,73 @@ void UpdateMasterlistTask::execute() {
                     masterlistSource);
     }
 
-    QNetworkRequest request(QUrl(QString::fromStdString(masterlistSource)));
+    auto request = createConditionalRequest(masterlistSource, masterlistPath);
     request.setTransferTimeout(TRANSFER_TIMEOUT_MS);
 
-    const auto reply = networkAccessManager->get(request);
+    // The span ends when the reply finishes, whether or not it succeeded.
+    requestSpan.emplace("UpdateMasterlistTask request");
+    const auto reply = networkSession->get(request);
+    cancelReplyOnCancellation(reply);
 
     connect(reply,
-            &QNetworkReply::finished,
+            &SharedReply::finished,
             this,
             &UpdateMasterlistTask::onReplyFinished);
-
-    connect(reply,
-            &QNetworkReply::errorOccurred,
-            this,
-            &UpdateMasterlistTask::onNetworkError);
-    connect(reply,
-            &QNetworkReply::sslErrors,
-            this,
-            &UpdateMasterlistTask::onSSLError);
   } catch (const std::exception &e) {
     handleException(e);
   }
 }
 
 void UpdateMasterlistTask::onReplyFinished() {
+  requestSpan.reset();
+
   try {
+    TraceSpan span("UpdateMasterlistTask::onReplyFinished");
+
+    if (stopIfCancelled()) {
+      return;
+    }
+
     auto logger = getLogger();
     if (logger) {
       logger->trace("Finished receiving a response for masterlist update");
     }
 
-    auto responseData =
-        readHttpResponse(qobject_cast<QNetworkReply *>(sender()));
+    const auto reply = qobject_cast<SharedReply *>(sender());
+    if (reply->hasError()) {
+      emit error(reply->getErrorString());
+      return;
+    }
+
+    const auto validators = reply->getValidators();
+
+    if (reply->isNotModified()) {
+      // The file hasn't changed since it was last downloaded, so there's
+      // nothing to read or hash.
+      finishOnGameWorker([gameFolderName = gameFolderName,
+                          masterlistPath = masterlistPath,
+                          validators]() {
+        updateFileRevisionTimestamp(masterlistPath, validators);
+        return std::make_pair(gameFolderName, false);
+      });
+      return;
+    }
+
+    auto responseData = reply->getData();
 
     if (!responseData.has_value()) {
       emit error("Masterlist update response errored");
       return;
     }
 
-    const auto masterlistUpdated =
-        updateFileWithData(masterlistPath, responseData.value());
-
-    emit finished(std::make_pair(gameFolderName, masterlistUpdated));
+    finishOnGameWorker([gameFolderName = gameFolderName,
+                        masterlistPath = masterlistPath,
+                        data = std::move(responseData.value()),
+                        validators]() {
+      return std::make_pair(
+          gameFolderName,
+          updateFileWithData(masterlistPath, data, validators));
+    });
   } catch (const std::exception &e) {
     handleException(e);
   }
@@ -26,15 +26,18 @@
 #ifndef LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 #define LOOT_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK
 
-#include <QtNetwork/QNetworkAccessManager>
+#include <memory>
 
+#include "gui/qt/tasks/network_session.h"
 #include "gui/qt/tasks/network_task.h"
+#include "gui/state/tracing.h"
 
 namespace loot {
 class UpdatePreludeTask : public NetworkTask {
   Q_OBJECT
 public:
-  explicit UpdatePreludeTask(const LootState& state);
+  UpdatePreludeTask(const LootState& state,
+                    std::shared_ptr<NetworkSession> networkSession);
 
 public slots:
   void execute() override;
@@ -43,7 +46,8 @@ private:
   std::string preludeSource;
   std::filesystem::path preludePath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
+  std::shared_ptr<NetworkSession> networkSession;
+  std::optional<TraceSpan> requestSpan;
 
 private slots:
   void onReplyFinished();
@@ -52,10 +56,12 @@ private slots:
 class UpdateMasterlistTask : public NetworkTask {
   Q_OBJECT
 public:
-  explicit UpdateMasterlistTask(const gui::Game& game);
+  UpdateMasterlistTask(const gui::Game& game,
+                       std::shared_ptr<NetworkSession> networkSession);
   UpdateMasterlistTask(const std::string& gameFolderName,
                        const std::string& masterlistSource,
-                       const std::filesystem::path& masterlistPath);
+                       const std::filesystem::path& masterlistPath,
+                       std::shared_ptr<NetworkSession> networkSession);
 
 public slots:
   void execute() override;
@@ -65,7 +71,8 @@ private:
   std::string masterlistSource;
   std::filesystem::path masterlistPath;
 
-  QNetworkAccessManager* networkAccessManager{nullptr};
+  std::shared_ptr<NetworkSession> networkSession;
+  std::optional<TraceSpan> requestSpan;
 
 private slots:
   void onReplyFinished();
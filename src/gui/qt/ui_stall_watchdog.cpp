@@ -0,0 +1,194 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui/qt/ui_stall_watchdog.h"
+
+#include <QtCore/QMetaObject>
+#include <algorithm>
+#include <atomic>
+
+#include "gui/state/logging.h"
+
+namespace {
+using std::chrono::milliseconds;
+using std::chrono::steady_clock;
+
+static constexpr size_t MAX_REPORTED_STALLS = 10;
+static constexpr milliseconds MIN_POLL_INTERVAL{10};
+static constexpr milliseconds MAX_POLL_INTERVAL{250};
+
+// Written only by the UI thread, read by the watchdog thread.
+std::atomic<const char*> currentUiOperation{nullptr};
+
+const char* describeOperation(const char* operation) {
+  return operation == nullptr ? "an unmarked operation" : operation;
+}
+}
+
+namespace loot {
+UiOperation::UiOperation(const char* name) noexcept :
+    previous_(currentUiOperation.exchange(name)), span_(name) {}
+
+UiOperation::~UiOperation() { currentUiOperation.store(previous_); }
+
+UiStallWatchdog::UiStallWatchdog(milliseconds threshold) :
+    threshold_(threshold),
+    pollInterval_(
+        std::clamp(threshold / 4, MIN_POLL_INTERVAL, MAX_POLL_INTERVAL)),
+    receiver_(std::make_unique<QObject>()) {
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info("Watching for UI stalls longer than {} ms",
+                 threshold_.count());
+  }
+
+  thread_ = std::thread([this]() { run(); });
+}
+
+UiStallWatchdog::~UiStallWatchdog() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopRequested_ = true;
+  }
+  stopCondition_.notify_one();
+  thread_.join();
+
+  // Discard any heartbeat that is still queued.
+  receiver_.reset();
+
+  logSummary();
+}
+
+void UiStallWatchdog::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (!stopRequested_) {
+    const auto now = steady_clock::now();
+
+    if (!heartbeatSentAt_.has_value()) {
+      heartbeatSentAt_ = now;
+      stalledOperation_ = nullptr;
+      stallLogged_ = false;
+
+      QMetaObject::invokeMethod(
+          receiver_.get(), [this]() { onHeartbeat(); }, Qt::QueuedConnection);
+    } else {
+      // Remember the most recent operation seen while waiting for the
+      // heartbeat, as by the time it's handled the operation has finished.
+      const auto operation = currentUiOperation.load();
+      if (operation != nullptr) {
+        stalledOperation_ = operation;
+      }
+
+      const auto elapsed =
+          std::chrono::duration_cast<milliseconds>(now - *heartbeatSentAt_);
+      if (!stallLogged_ && elapsed >= threshold_) {
+        stallLogged_ = true;
+
+        const auto logger = getLogger();
+        if (logger) {
+          logger->warn(
+              "The UI has been unresponsive for {} ms while running {}",
+              elapsed.count(),
+              describeOperation(stalledOperation_));
+        }
+      }
+    }
+
+    stopCondition_.wait_for(
+        lock, pollInterval_, [this]() { return stopRequested_; });
+  }
+}
+
+void UiStallWatchdog::onHeartbeat() {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (!heartbeatSentAt_.has_value()) {
+    return;
+  }
+
+  const auto latency = std::chrono::duration_cast<milliseconds>(
+      steady_clock::now() - *heartbeatSentAt_);
+  heartbeatSentAt_.reset();
+
+  if (latency < threshold_) {
+    return;
+  }
+
+  recordStall(Stall{latency, stalledOperation_});
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->warn("The UI was unresponsive for {} ms while running {}",
+                 latency.count(),
+                 describeOperation(stalledOperation_));
+  }
+}
+
+void UiStallWatchdog::recordStall(Stall stall) {
+  stallCount_ += 1;
+  totalStallDuration_ += stall.duration;
+
+  // Keep the worst stalls sorted longest first.
+  const auto position = std::upper_bound(
+      worstStalls_.begin(),
+      worstStalls_.end(),
+      stall,
+      [](const Stall& a, const Stall& b) { return a.duration > b.duration; });
+  worstStalls_.insert(position, stall);
+
+  if (worstStalls_.size() > MAX_REPORTED_STALLS) {
+    worstStalls_.pop_back();
+  }
+}
+
+void UiStallWatchdog::logSummary() const {
+  const auto logger = getLogger();
+  if (!logger) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (stallCount_ == 0) {
+    logger->info("The UI did not stall for longer than {} ms",
+                 threshold_.count());
+    return;
+  }
+
+  logger->info(
+      "The UI stalled for longer than {} ms {} times, for a total of {} ms. "
+      "The longest stalls were:",
+      threshold_.count(),
+      stallCount_,
+      totalStallDuration_.count());
+
+  for (const auto& stall : worstStalls_) {
+    logger->info("  {} ms while running {}",
+                 stall.duration.count(),
+                 describeOperation(stall.operation));
+  }
+}
+}
@@ -0,0 +1,112 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QT_UI_STALL_WATCHDOG
+#define LOOT_GUI_QT_UI_STALL_WATCHDOG
+
+#include <QtCore/QObject>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "gui/state/tracing.h"
+
+namespace loot {
+// Marks the UI thread as running the named operation for the lifetime of the
+// object, so that the UI stall watchdog can report what was running when the
+// UI stopped responding. The operation is also recorded as a trace span. The
+// name must be a string literal. Markers may be nested, and must only be
+// created on the UI thread.
+class UiOperation {
+public:
+  explicit UiOperation(const char* name) noexcept;
+  UiOperation(const UiOperation&) = delete;
+  UiOperation(UiOperation&&) = delete;
+  ~UiOperation();
+
+  UiOperation& operator=(const UiOperation&) = delete;
+  UiOperation& operator=(UiOperation&&) = delete;
+
+private:
+  const char* previous_;
+  TraceSpan span_;
+};
+
+// Measures the UI thread's event loop latency from a helper thread by
+// periodically posting an event to the UI thread and timing how long it takes
+// to be handled. Stalls longer than the threshold are logged along with the
+// name of the UiOperation that was running, and a summary of the worst stalls
+// is logged when the watchdog is destroyed.
+//
+// The watchdog must be constructed and destroyed on the UI thread.
+class UiStallWatchdog {
+public:
+  explicit UiStallWatchdog(std::chrono::milliseconds threshold);
+  UiStallWatchdog(const UiStallWatchdog&) = delete;
+  UiStallWatchdog(UiStallWatchdog&&) = delete;
+  ~UiStallWatchdog();
+
+  UiStallWatchdog& operator=(const UiStallWatchdog&) = delete;
+  UiStallWatchdog& operator=(UiStallWatchdog&&) = delete;
+
+private:
+  struct Stall {
+    std::chrono::milliseconds duration;
+    const char* operation;
+  };
+
+  void run();
+  void onHeartbeat();
+  void recordStall(Stall stall);
+  void logSummary() const;
+
+  std::chrono::milliseconds threshold_;
+  std::chrono::milliseconds pollInterval_;
+
+  // Heartbeats are posted to this object, so that any that are still queued
+  // when the watchdog is destroyed are discarded along with it.
+  std::unique_ptr<QObject> receiver_;
+
+  mutable std::mutex mutex_;
+  std::condition_variable stopCondition_;
+  bool stopRequested_{false};
+
+  std::optional<std::chrono::steady_clock::time_point> heartbeatSentAt_;
+  const char* stalledOperation_{nullptr};
+  bool stallLogged_{false};
+
+  std::vector<Stall> worstStalls_;
+  size_t stallCount_{0};
+  std::chrono::milliseconds totalStallDuration_{0};
+
+  std::thread thread_;
+};
+}
+
+#endif
@@ -26,15 +26,20 @@ along with LOOT.  If not, see
 #ifndef LOOT_GUI_QUERY_QUERY
 #define LOOT_GUI_QUERY_QUERY
 
+#include <functional>
 #include <optional>
 #include <string>
 #include <variant>
 
 #include "gui/helpers.h"
 #include "gui/plugin_item.h"
+#include "gui/sourced_message.h"
+#include "gui/state/cancellation_token.h"
+#include "gui/state/game/load_order_backup.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
 #include "gui/state/loot_state.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 
 namespace loot {
@@ -43,16 +48,45 @@ typedef std::vector<std::pair<std::string, std::optional<short>>>
 typedef std::pair<std::string, bool> MasterlistUpdateResult;
 typedef std::vector<PluginItem> PluginItems;
 typedef std::vector<std::pair<PluginItem, bool>> GetOverlappingPluginsResult;
+typedef std::vector<LoadOrderBackup> LoadOrderBackups;
+typedef std::vector<SourcedMessage> SourcedMessages;
+
+// The metadata that the plugin metadata editor is initialised with.
+struct EditablePluginMetadata {
+  std::string pluginName;
+  std::optional<PluginMetadata> nonUserMetadata;
+  std::optional<PluginMetadata> userMetadata;
+};
+
+// A plugin's merged metadata, formatted for sharing.
+struct PluginMetadataText {
+  std::string pluginName;
+  std::string text;
+};
 
 typedef std::variant<std::monostate,
                      bool,
+                     std::string,
                      CancelSortResult,
                      MasterlistUpdateResult,
                      PluginItems,
                      PluginItem,
-                     GetOverlappingPluginsResult>
+                     GetOverlappingPluginsResult,
+                     LoadOrderBackups,
+                     LoadOrderBackup,
+                     SourcedMessages,
+                     EditablePluginMetadata,
+                     PluginMetadataText>
     QueryResult;
 
+// Progress through the stage of a query that is currently running. A total of
+// zero means that the amount of work in the stage isn't known.
+struct QueryProgress {
+  std::string stage;
+  size_t completed{0};
+  size_t total{0};
+};
+
 class Query {
 public:
   Query() = default;
@@ -70,6 +104,54 @@ public:
         "LOOTDebugLog.txt (you can get to it through the "
         "main menu) for more information.");
   };
+
+  // Queries that can be cancelled check the token between units of work, and
+  // throw OperationCancelledError once it has been cancelled.
+  void setCancellationToken(CancellationToken cancellationToken) {
+    cancellationToken_ = std::move(cancellationToken);
+  }
+
+  // The callback is called from the thread that runs the query.
+  void setProgressCallback(
+      std::function<void(const QueryProgress&)> sendProgressUpdate) {
+    sendProgressUpdate_ = std::move(sendProgressUpdate);
+  }
+
+protected:
+  const CancellationToken& getCancellationToken() const {
+    return cancellationToken_;
+  }
+
+  const std::function<void(const QueryProgress&)>& getProgressCallback()
+      const {
+    return sendProgressUpdate_;
+  }
+
+  void sendProgressUpdate(const std::string& stage,
+                          size_t completed = 0,
+                          size_t total = 0) const {
+    if (sendProgressUpdate_) {
+      sendProgressUpdate_(QueryProgress{stage, completed, total});
+    }
+  }
+
+  // Returns a callback that reports the number of plugins processed so far
+  // by getPluginItems() or mapFromLoadOrderData() as progress through the
+  // given stage.
+  std::function<void(size_t, size_t)> getPluginProgressCallback(
+      const std::string& stage) const {
+    if (!sendProgressUpdate_) {
+      return nullptr;
+    }
+
+    return [this, stage](size_t completed, size_t total) {
+      sendProgressUpdate(stage, completed, total);
+    };
+  }
+
+private:
+  CancellationToken cancellationToken_;
+  std::function<void(const QueryProgress&)> sendProgressUpdate_;
 };
 }
 
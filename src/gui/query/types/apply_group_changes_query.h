@@ -0,0 +1,140 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_QUERY_APPLY_GROUP_CHANGES_QUERY
+#define LOOT_GUI_QUERY_APPLY_GROUP_CHANGES_QUERY
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+#include "gui/state/game/group_node_positions.h"
+
+namespace loot {
+class ApplyGroupChangesQuery : public Query {
+public:
+  // currentPluginGroups maps plugin names to the groups that they're currently
+  // displayed as being in, and is used to find the plugins in groups that
+  // have been added or removed.
+  ApplyGroupChangesQuery(
+      gui::Game& game,
+      std::string&& language,
+      std::vector<Group>&& userGroups,
+      std::unordered_map<std::string, std::string>&& newPluginGroups,
+      std::unordered_map<std::string, std::string>&& currentPluginGroups,
+      std::vector<GroupNodePosition>&& nodePositions) :
+      game_(&game),
+      language_(std::move(language)),
+      userGroups_(std::move(userGroups)),
+      newPluginGroups_(std::move(newPluginGroups)),
+      currentPluginGroups_(std::move(currentPluginGroups)),
+      nodePositions_(std::move(nodePositions)) {}
+
+  QueryResult executeLogic() override {
+    TraceSpan span("ApplyGroupChangesQuery");
+
+    auto logger = getLogger();
+    if (logger) {
+      logger->debug("Applying group changes, including new groups for {} "
+                    "plugins.",
+                    newPluginGroups_.size());
+    }
+
+    const auto oldGroupNames = getGroupNames();
+
+    game_->setUserGroups(userGroups_);
+
+    for (const auto& [pluginName, groupName] : newPluginGroups_) {
+      auto userMetadata = game_->getUserMetadata(pluginName);
+
+      if (userMetadata.has_value()) {
+        userMetadata.value().SetGroup(groupName);
+        game_->addUserMetadata(userMetadata.value());
+      } else {
+        PluginMetadata metadata(pluginName);
+        metadata.SetGroup(groupName);
+        game_->addUserMetadata(metadata);
+      }
+    }
+
+    game_->saveUserMetadata();
+
+    saveGroupNodePositions(game_->getGroupNodePositionsPath(), nodePositions_);
+
+    const auto affectedPlugins =
+        getAffectedPluginNames(oldGroupNames, getGroupNames());
+
+    if (logger) {
+      logger->trace("Rederiving display metadata for {} plugins.",
+                    affectedPlugins.size());
+    }
+
+    return getPluginItems(affectedPlugins, *game_, language_);
+  }
+
+private:
+  gui::Game* game_;
+  std::string language_;
+  std::vector<Group> userGroups_;
+  std::unordered_map<std::string, std::string> newPluginGroups_;
+  std::unordered_map<std::string, std::string> currentPluginGroups_;
+  std::vector<GroupNodePosition> nodePositions_;
+
+  std::unordered_set<std::string> getGroupNames() const {
+    std::unordered_set<std::string> groupNames;
+    for (const auto& group : game_->getGroups()) {
+      groupNames.insert(group.GetName());
+    }
+
+    return groupNames;
+  }
+
+  // Get the plugins that have been moved to a different group, and those in
+  // groups that have become defined or undefined, in load order.
+  std::vector<std::string> getAffectedPluginNames(
+      const std::unordered_set<std::string>& oldGroupNames,
+      const std::unordered_set<std::string>& newGroupNames) const {
+    std::vector<std::string> pluginNames;
+
+    for (const auto& pluginName : game_->getLoadOrder()) {
+      if (newPluginGroups_.count(pluginName) != 0) {
+        pluginNames.push_back(pluginName);
+        continue;
+      }
+
+      const auto it = currentPluginGroups_.find(pluginName);
+      if (it != currentPluginGroups_.end() &&
+          oldGroupNames.count(it->second) != newGroupNames.count(it->second)) {
+        pluginNames.push_back(pluginName);
+      }
+    }
+
+    return pluginNames;
+  }
+};
+}
+
+#endif
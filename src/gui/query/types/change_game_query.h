@@ -33,20 +33,20 @@ class ChangeGameQuery : public Query {
 public:
   ChangeGameQuery(GamesManager& gamesManager,
                   std::string&& language,
-                  std::string&& gameFolder,
-                  std::function<void(std::string)>&& sendProgressUpdate) :
+                  std::string&& gameFolder) :
       gamesManager_(&gamesManager),
       gameFolder_(std::move(gameFolder)),
-      language_(std::move(language)),
-      sendProgressUpdate_(std::move(sendProgressUpdate)) {}
+      language_(std::move(language)) {}
 
   QueryResult executeLogic() override {
     gamesManager_->setCurrentGame(gameFolder_);
     gamesManager_->getCurrentGame().init();
 
+    // The current game has already changed, so the sub-query isn't given the
+    // cancellation token: stopping now would leave the old game's data shown.
     GetGameDataQuery subQuery(gamesManager_->getCurrentGame(),
-                              std::move(language_),
-                              std::move(sendProgressUpdate_));
+                              std::move(language_));
+    subQuery.setProgressCallback(getProgressCallback());
 
     return subQuery.executeLogic();
   }
@@ -55,7 +55,6 @@ private:
   GamesManager* gamesManager_;
   std::string gameFolder_;
   std::string language_;
-  std::function<void(std::string)> sendProgressUpdate_;
 };
 }
 
@@ -34,15 +34,14 @@ along with LOOT.  If not, see
 namespace loot {
 class GetGameDataQuery : public Query {
 public:
-  GetGameDataQuery(gui::Game& game,
-                   std::string&& language,
-                   std::function<void(std::string)>&& sendProgressUpdate) :
-      game_(&game),
-      language_(std::move(language)),
-      sendProgressUpdate_(std::move(sendProgressUpdate)) {}
+  GetGameDataQuery(gui::Game& game, std::string&& language) :
+      game_(&game), language_(std::move(language)) {}
 
   QueryResult executeLogic() override {
-    sendProgressUpdate_(translate("Parsing, merging and evaluating metadata…"));
+    TraceSpan span("GetGameDataQuery");
+
+    const auto stage = translate("Parsing, merging and evaluating metadata…");
+    sendProgressUpdate(stage);
 
     /* If the game's plugins object is empty, this is the first time loading
        the game data, so also load the metadata lists. */
@@ -75,6 +74,7 @@ public:
 
     threads.push_back(std::thread([&]() {
       try {
+        TraceSpan span("CreationClubPlugins::load");
         game_->getCreationClubPlugins().load(
             game_->getSettings().getId(), game_->getSettings().getGamePath());
       } catch (...) {
@@ -93,14 +93,21 @@ public:
       }
     }
 
+    // Loading can't be interrupted, but evaluating each plugin's metadata
+    // can.
+    getCancellationToken().throwIfCancelled();
+
     // Sort plugins into their load order.
-    return getPluginItems(game_->getLoadOrder(), *game_, language_);
+    return getPluginItems(game_->getLoadOrder(),
+                          *game_,
+                          language_,
+                          getCancellationToken(),
+                          getPluginProgressCallback(stage));
   }
 
 private:
   gui::Game* game_;
   std::string language_;
-  std::function<void(std::string)> sendProgressUpdate_;
 };
 }
 
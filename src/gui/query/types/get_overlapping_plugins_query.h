@@ -49,6 +49,8 @@ public:
     if (!game_->arePluginsFullyLoaded())
       game_->loadAllInstalledPlugins(false);
 
+    getCancellationToken().throwIfCancelled();
+
     return getResult();
   }
 
@@ -78,7 +80,13 @@ private:
           return std::make_pair(pluginItem, overlap);
         };
 
-    return mapFromLoadOrderData(*game_, game_->getLoadOrder(), mapper);
+    return mapFromLoadOrderData(
+        *game_,
+        game_->getLoadOrder(),
+        mapper,
+        getCancellationToken(),
+        getPluginProgressCallback(
+            translate("Identifying overlapping plugins…")));
   }
 
   gui::Game* game_;
@@ -0,0 +1,61 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_GET_PLUGIN_ITEMS_QUERY
+#define LOOT_GUI_QUERY_GET_PLUGIN_ITEMS_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+#include "gui/translate.h"
+
+namespace loot {
+// Gets plugin items for the game's current load order without loading
+// anything, e.g. to bring the UI back in line with the game after a refresh
+// was cancelled part-way through.
+class GetPluginItemsQuery : public Query {
+public:
+  GetPluginItemsQuery(gui::Game& game, std::string&& language) :
+      game_(&game), language_(std::move(language)) {}
+
+  QueryResult executeLogic() override {
+    TraceSpan span("GetPluginItemsQuery");
+
+    const auto stage = translate("Parsing, merging and evaluating metadata…");
+    sendProgressUpdate(stage);
+
+    return getPluginItems(game_->getLoadOrder(),
+                          *game_,
+                          language_,
+                          getCancellationToken(),
+                          getPluginProgressCallback(stage));
+  }
+
+private:
+  gui::Game* game_;
+  std::string language_;
+};
+}
+
+#endif
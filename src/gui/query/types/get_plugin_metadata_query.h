@@ -0,0 +1,56 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_GET_PLUGIN_METADATA_QUERY
+#define LOOT_GUI_QUERY_GET_PLUGIN_METADATA_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+
+namespace loot {
+class GetPluginMetadataQuery : public Query {
+public:
+  GetPluginMetadataQuery(const gui::Game& game, std::string_view pluginName) :
+      game_(&game), pluginName_(pluginName) {}
+
+  QueryResult executeLogic() override {
+    const auto plugin = game_->getPlugin(pluginName_);
+    if (!plugin) {
+      throw std::runtime_error("The plugin \"" + pluginName_ +
+                               "\" is not loaded.");
+    }
+
+    return EditablePluginMetadata{pluginName_,
+                                  game_->getNonUserMetadata(*plugin),
+                                  game_->getUserMetadata(pluginName_)};
+  }
+
+private:
+  const gui::Game* game_;
+  std::string pluginName_;
+};
+}
+
+#endif
@@ -0,0 +1,50 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_GET_PLUGIN_METADATA_TEXT_QUERY
+#define LOOT_GUI_QUERY_GET_PLUGIN_METADATA_TEXT_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+
+namespace loot {
+class GetPluginMetadataTextQuery : public Query {
+public:
+  GetPluginMetadataTextQuery(const gui::Game& game,
+                             std::string_view pluginName) :
+      game_(&game), pluginName_(pluginName) {}
+
+  QueryResult executeLogic() override {
+    return PluginMetadataText{pluginName_,
+                              getMetadataAsBBCodeYaml(*game_, pluginName_)};
+  }
+
+private:
+  const gui::Game* game_;
+  std::string pluginName_;
+};
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_READ_LOAD_ORDER_BACKUP_QUERY
+#define LOOT_GUI_QUERY_READ_LOAD_ORDER_BACKUP_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/helpers.h"
+
+namespace loot {
+// Backups are found without their load orders, so this reads the load order
+// of one of them.
+class ReadLoadOrderBackupQuery : public Query {
+public:
+  explicit ReadLoadOrderBackupQuery(const LoadOrderBackup& backup) :
+      backup_(backup) {}
+
+  QueryResult executeLogic() override {
+    backup_.loadOrder = readLoadOrderBackup(backup_.path);
+
+    return backup_;
+  }
+
+private:
+  LoadOrderBackup backup_;
+};
+}
+
+#endif
@@ -0,0 +1,58 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_SET_GAMES_SETTINGS_QUERY
+#define LOOT_GUI_QUERY_SET_GAMES_SETTINGS_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/loot_state.h"
+
+namespace loot {
+class SetGamesSettingsQuery : public Query {
+public:
+  SetGamesSettingsQuery(LootState& state,
+                        std::vector<GameSettings>&& gamesSettings) :
+      state_(&state), gamesSettings_(std::move(gamesSettings)) {}
+
+  QueryResult executeLogic() override {
+    TraceSpan span("SetGamesSettingsQuery");
+
+    sendProgressUpdate(translate("Detecting installed games…"));
+
+    const auto installedGamesSettings =
+        state_->loadInstalledGames(gamesSettings_);
+
+    state_->getSettings().storeGameSettings(installedGamesSettings);
+
+    return std::monostate();
+  }
+
+private:
+  LootState* state_;
+  std::vector<GameSettings> gamesSettings_;
+};
+}
+
+#endif
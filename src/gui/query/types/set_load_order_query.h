@@ -0,0 +1,60 @@
+/*  LOOT
+
+A load order optimisation tool for
+Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_QUERY_SET_LOAD_ORDER_QUERY
+#define LOOT_GUI_QUERY_SET_LOAD_ORDER_QUERY
+
+#include "gui/query/query.h"
+#include "gui/state/game/game.h"
+
+namespace loot {
+class SetLoadOrderQuery : public Query {
+public:
+  SetLoadOrderQuery(gui::Game& game, std::vector<std::string>&& loadOrder) :
+      game_(&game), loadOrder_(std::move(loadOrder)) {}
+
+  QueryResult executeLogic() override {
+    // The load order may come from a backup, so first remove any plugins that
+    // are no longer installed.
+    for (auto it = loadOrder_.begin(); it != loadOrder_.end();) {
+      if (!game_->fileExists(*it)) {
+        it = loadOrder_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    game_->setLoadOrder(loadOrder_);
+
+    return std::monostate();
+  }
+
+private:
+  gui::Game* game_;
+  std::vector<std::string> loadOrder_;
+};
+}
+
+#endif
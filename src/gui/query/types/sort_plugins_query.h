@@ -36,24 +36,36 @@ class SortPluginsQuery : public Query {
 public:
   SortPluginsQuery(gui::Game& game,
                    ChangeCount& unappliedChangeCount,
-                   std::string&& language,
-                   std::function<void(std::string)>&& sendProgressUpdate) :
+                   std::string&& language) :
       game_(&game),
       language_(std::move(language)),
-      unappliedChangeCount_(&unappliedChangeCount),
-      sendProgressUpdate_(std::move(sendProgressUpdate)) {}
+      unappliedChangeCount_(&unappliedChangeCount) {}
 
   QueryResult executeLogic() override {
+    TraceSpan span("SortPluginsQuery");
+
     auto logger = getLogger();
     if (logger) {
       logger->info("Beginning sorting operation.");
     }
 
+    // Sorting itself can't be interrupted, so check for cancellation before
+    // and after it. The change counts are only incremented once the result
+    // has been built, so a cancelled sort leaves them untouched.
+    getCancellationToken().throwIfCancelled();
+
     // Sort plugins into their load order.
-    sendProgressUpdate_(translate("Sorting load order…"));
+    const auto stage = translate("Sorting load order…");
+    sendProgressUpdate(stage);
     std::vector<std::string> plugins = game_->sortPlugins();
 
-    auto result = getResult(plugins);
+    getCancellationToken().throwIfCancelled();
+
+    auto result = getPluginItems(plugins,
+                                 *game_,
+                                 language_,
+                                 getCancellationToken(),
+                                 getPluginProgressCallback(stage));
 
     // plugins will be empty if there was a sorting error.
     if (!plugins.empty()) {
@@ -69,14 +81,9 @@ public:
   }
 
 private:
-  std::vector<PluginItem> getResult(const std::vector<std::string>& plugins) {
-    return getPluginItems(plugins, *game_, language_);
-  }
-
   gui::Game* game_;
   std::string language_;
   ChangeCount* unappliedChangeCount_;
-  std::function<void(std::string)> sendProgressUpdate_;
 };
 }
 
@@ -0,0 +1,115 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_CANCELLATION_TOKEN
+#define LOOT_GUI_STATE_CANCELLATION_TOKEN
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+
+namespace loot {
+class OperationCancelledError : public std::runtime_error {
+public:
+  OperationCancelledError() :
+      std::runtime_error("The operation was cancelled") {}
+};
+
+// Lets one thread ask work running on another thread to stop. Copies share
+// the same state, so the UI can keep a copy and cancel the copy that a query
+// checks between units of work.
+class CancellationToken {
+public:
+  typedef uint64_t CallbackId;
+
+  void cancel() {
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    if (state->cancelled.exchange(true, std::memory_order_relaxed)) {
+      return;
+    }
+
+    for (const auto& [id, callback] : state->callbacks) {
+      callback();
+    }
+
+    state->callbacks.clear();
+  }
+
+  bool isCancelled() const {
+    return state->cancelled.load(std::memory_order_relaxed);
+  }
+
+  bool operator==(const CancellationToken& other) const {
+    return state == other.state;
+  }
+
+  void throwIfCancelled() const {
+    if (isCancelled()) {
+      throw OperationCancelledError();
+    }
+  }
+
+  // Registers a callback for work that can't check the token itself, e.g.
+  // because it's waiting on I/O. The callback is called on the thread that
+  // cancels the token, or immediately if the token has already been
+  // cancelled, so it should only signal the work to stop. Once
+  // removeCallback() returns, the callback won't be called.
+  CallbackId addCallback(std::function<void()> callback) const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+
+    if (state->cancelled.load(std::memory_order_relaxed)) {
+      callback();
+      return 0;
+    }
+
+    state->nextCallbackId += 1;
+    state->callbacks.emplace(state->nextCallbackId, std::move(callback));
+
+    return state->nextCallbackId;
+  }
+
+  void removeCallback(CallbackId id) const {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    state->callbacks.erase(id);
+  }
+
+private:
+  struct State {
+    std::atomic<bool> cancelled{false};
+    std::mutex mutex;
+    CallbackId nextCallbackId{0};
+    std::map<CallbackId, std::function<void()>> callbacks;
+  };
+
+  std::shared_ptr<State> state{std::make_shared<State>()};
+};
+}
+
+#endif
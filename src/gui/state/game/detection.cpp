@@ -35,6 +35,34 @@
 
 using std::filesystem::u8path;
 
+namespace {
+// Rescans the stores that have changed since the cache was last updated, and
+// writes the cache if any were rescanned. Returns true if any were rescanned.
+bool updateCachedGameStores(
+    loot::GameStoreCache& cache,
+    const std::filesystem::path& cachePath,
+    const std::vector<std::string>& preferredUILanguages) {
+  const auto heroicConfigPaths =
+      loot::heroic::getHeroicGamesLauncherConfigPaths();
+
+  const auto changed = loot::updateGameStoreCache(
+      cache, loot::Registry(), heroicConfigPaths, preferredUILanguages);
+
+  if (changed) {
+    try {
+      loot::writeGameStoreCache(cachePath, cache);
+    } catch (const std::exception& e) {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error("Failed to update game detection cache: {}", e.what());
+      }
+    }
+  }
+
+  return changed;
+}
+}
+
 namespace loot {
 bool isInstalled(const GameSettings& settings) {
   const auto logger = getLogger();
@@ -45,18 +73,48 @@ bool isInstalled(const GameSettings& settings) {
   return isValidGamePath(settings.getId(), settings.getMasterFilename(), settings.getGamePath());
 }
 
+StoreGameInstalls scanGameStores(
+    const std::filesystem::path& cachePath,
+    const std::vector<std::string>& preferredUILanguages) {
+  auto cache = readGameStoreCache(cachePath).value_or(GameStoreCache());
+
+  updateCachedGameStores(cache, cachePath, preferredUILanguages);
+
+  return cache.installs;
+}
+
+std::optional<StoreGameInstalls> readCachedGameStores(
+    const std::filesystem::path& cachePath) {
+  const auto cache = readGameStoreCache(cachePath);
+  if (!cache.has_value()) {
+    return std::nullopt;
+  }
+
+  return cache.value().installs;
+}
+
+std::optional<StoreGameInstalls> rescanChangedGameStores(
+    const std::filesystem::path& cachePath,
+    const std::vector<std::string>& preferredUILanguages) {
+  auto cache = readGameStoreCache(cachePath).value_or(GameStoreCache());
+
+  if (!updateCachedGameStores(cache, cachePath, preferredUILanguages)) {
+    return std::nullopt;
+  }
+
+  return cache.installs;
+}
+
 std::vector<GameSettings> findInstalledGames(
     const std::vector<GameSettings>& gamesSettings,
+    const StoreGameInstalls& storeInstalls,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths_,
     const std::vector<std::string>& preferredUILanguages_) {
-  const auto heroicConfigPaths = heroic::getHeroicGamesLauncherConfigPaths();
+  const auto gameInstalls = resolveGameInstalls(
+      Registry(), storeInstalls, xboxGamingRootPaths_, preferredUILanguages_);
 
   std::vector<GameSettings> gamesSettingsToUpdate = gamesSettings;
-  updateInstalledGamesSettings(gamesSettingsToUpdate,
-                               Registry(),
-                               heroicConfigPaths,
-                               xboxGamingRootPaths_,
-                               preferredUILanguages_);
+  updateGamesSettings(gamesSettingsToUpdate, gameInstalls);
 
   std::sort(gamesSettingsToUpdate.begin(),
             gamesSettingsToUpdate.end(),
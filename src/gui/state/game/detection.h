@@ -27,9 +27,11 @@
 #define LOOT_GUI_STATE_GAME_DETECTION
 
 #include <filesystem>
+#include <optional>
 #include <stdexcept>
 #include <vector>
 
+#include "gui/state/game/detection/store_cache.h"
 #include "gui/state/game/game_settings.h"
 
 namespace loot {
@@ -44,11 +46,31 @@ public:
 
 bool isInstalled(const GameSettings& settings);
 
+// Get the games installed by stores that keep their own records of installed
+// games, reusing the results cached at the given path for stores that haven't
+// changed since they were cached. The cache is updated if any stores are
+// rescanned.
+StoreGameInstalls scanGameStores(
+    const std::filesystem::path& cachePath,
+    const std::vector<std::string>& preferredUILanguages);
+
+// Get the store scan results cached at the given path without checking if
+// they're still valid. Returns nullopt if there are no usable cached results.
+std::optional<StoreGameInstalls> readCachedGameStores(
+    const std::filesystem::path& cachePath);
+
+// Like scanGameStores(), but returns nullopt if no stores have changed since
+// their results were cached.
+std::optional<StoreGameInstalls> rescanChangedGameStores(
+    const std::filesystem::path& cachePath,
+    const std::vector<std::string>& preferredUILanguages);
+
 // Detect installed games and add GameSettings objects for those that
 // aren't already represented by the objects that already exist. Also update
 // game paths for existing settings objects that match a found install.
 std::vector<GameSettings> findInstalledGames(
     const std::vector<GameSettings>& gamesSettings,
+    const StoreGameInstalls& storeInstalls,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths_,
     const std::vector<std::string>& preferredUILanguages_);
 }
@@ -26,6 +26,8 @@
 #include "gui/state/game/detection/detail.h"
 
 #include <algorithm>
+#include <functional>
+#include <future>
 #include <unordered_set>
 
 #include "gui/helpers.h"
@@ -115,8 +117,10 @@ std::vector<GameInstall> deduplicateGameInstalls(
 // Search for installed copies of the given game, and return all those found.
 std::vector<GameInstall> findGameInstalls(
     const loot::RegistryInterface& registry,
+    const loot::gog::GogInstallPaths& gogInstallPaths,
+    const loot::epic::EgsInstallLocations& egsInstallLocations,
+    const loot::microsoft::XboxGameFolders& xboxGameFolders,
     const GameId gameId,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages) {
   const auto logger = getLogger();
   if (logger) {
@@ -128,7 +132,7 @@ std::vector<GameInstall> findGameInstalls(
   const auto steamInstalls = loot::steam::findGameInstalls(registry, gameId);
   installs.insert(installs.end(), steamInstalls.begin(), steamInstalls.end());
 
-  const auto gogInstalls = loot::gog::findGameInstalls(registry, gameId);
+  const auto gogInstalls = loot::gog::findGameInstalls(gogInstallPaths, gameId);
   installs.insert(installs.end(), gogInstalls.begin(), gogInstalls.end());
 
   const auto genericInstalls =
@@ -136,19 +140,48 @@ std::vector<GameInstall> findGameInstalls(
   installs.insert(
       installs.end(), genericInstalls.begin(), genericInstalls.end());
 
-  const auto epicInstall =
-      loot::epic::findGameInstalls(registry, gameId, preferredUILanguages);
+  const auto epicInstall = loot::epic::findGameInstalls(
+      egsInstallLocations, gameId, preferredUILanguages);
   if (epicInstall.has_value()) {
     installs.push_back(epicInstall.value());
   }
 
   const auto msInstalls = loot::microsoft::findGameInstalls(
-      gameId, xboxGamingRootPaths, preferredUILanguages);
+      xboxGameFolders, gameId, preferredUILanguages);
   installs.insert(installs.end(), msInstalls.begin(), msInstalls.end());
 
   return installs;
 }
 
+std::vector<GameInstall> findPerGameInstalls(
+    const loot::RegistryInterface& registry,
+    const loot::epic::EgsInstallLocations& egsInstallLocations,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  // Read the GOG Registry entries and list the Xbox gaming roots once, and
+  // concurrently, so that each game can be resolved against them.
+  auto gogInstallPathsFuture = std::async(std::launch::async,
+                                          loot::gog::findGogInstallPaths,
+                                          std::cref(registry));
+  const auto xboxGameFolders =
+      loot::microsoft::findXboxGameFolders(xboxGamingRootPaths);
+  const auto gogInstallPaths = gogInstallPathsFuture.get();
+
+  std::vector<GameInstall> installs;
+
+  for (const auto& gameId : loot::ALL_GAME_IDS) {
+    const auto gameInstalls = findGameInstalls(registry,
+                                               gogInstallPaths,
+                                               egsInstallLocations,
+                                               xboxGameFolders,
+                                               gameId,
+                                               preferredUILanguages);
+    installs.insert(installs.end(), gameInstalls.begin(), gameInstalls.end());
+  }
+
+  return installs;
+}
+
 void incrementGameSourceCount(
     std::unordered_map<GameId, std::unordered_map<InstallSource, size_t>>&
         gameSourceCounts,
@@ -204,13 +237,12 @@ std::string getNameSourceSuffix(const InstallSource source) {
   }
 }
 
-std::vector<GameInstall> findGameInstalls(
-    const RegistryInterface& registry,
-    const std::vector<std::filesystem::path>& heroicConfigPaths,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
-    const std::vector<std::string>& preferredUILanguages) {
+std::vector<GameInstall> findSteamLibraryGameInstalls(
+    const RegistryInterface& registry) {
   std::vector<GameInstall> installs;
 
+  // Each Steam install's libraryfolders.vdf is read once, and then only the
+  // app manifests for supported games are checked in each library.
   for (const auto& steamInstallPath : steam::getSteamInstallPaths(registry)) {
     for (const auto& libraryPath :
          steam::getSteamLibraryPaths(steamInstallPath)) {
@@ -226,6 +258,14 @@ std::vector<GameInstall> findGameInstalls(
     }
   }
 
+  return installs;
+}
+
+std::vector<GameInstall> findHeroicGameInstalls(
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  std::vector<GameInstall> installs;
+
   for (const auto& heroicConfigPath : heroicConfigPaths) {
     const auto heroicGameInstalls =
         heroic::findGameInstalls(heroicConfigPath, preferredUILanguages);
@@ -233,16 +273,67 @@ std::vector<GameInstall> findGameInstalls(
         installs.end(), heroicGameInstalls.begin(), heroicGameInstalls.end());
   }
 
-  for (const auto& gameId : ALL_GAME_IDS) {
-    const auto gameInstalls = ::findGameInstalls(
-        registry, gameId, xboxGamingRootPaths, preferredUILanguages);
-    installs.insert(installs.end(), gameInstalls.begin(), gameInstalls.end());
-  }
+  return installs;
+}
+
+StoreGameInstalls scanStores(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  // The stores are independent of one another, so scan them concurrently.
+  auto steamInstalls = std::async(
+      std::launch::async, findSteamLibraryGameInstalls, std::cref(registry));
+  auto heroicInstalls = std::async(std::launch::async,
+                                   findHeroicGameInstalls,
+                                   std::cref(heroicConfigPaths),
+                                   std::cref(preferredUILanguages));
+  auto egsInstallLocations = std::async(
+      std::launch::async, epic::findEgsInstallLocations, std::cref(registry));
+
+  StoreGameInstalls storeInstalls;
+  storeInstalls.steam = steamInstalls.get();
+  storeInstalls.heroic = heroicInstalls.get();
+  storeInstalls.egsInstallLocations = egsInstallLocations.get();
+
+  return storeInstalls;
+}
+
+std::vector<GameInstall> resolveGameInstalls(
+    const RegistryInterface& registry,
+    const StoreGameInstalls& storeInstalls,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  // The stores' results are combined in a fixed order so that deduplication
+  // always keeps the same installs.
+  std::vector<GameInstall> installs = storeInstalls.steam;
+  installs.insert(installs.end(),
+                  storeInstalls.heroic.begin(),
+                  storeInstalls.heroic.end());
+
+  const auto perGameInstalls =
+      findPerGameInstalls(registry,
+                          storeInstalls.egsInstallLocations,
+                          xboxGamingRootPaths,
+                          preferredUILanguages);
+  installs.insert(
+      installs.end(), perGameInstalls.begin(), perGameInstalls.end());
 
   // The installs may duplicate Steam or GOG installs, so deduplicate them.
   return deduplicateGameInstalls(installs);
 }
 
+std::vector<GameInstall> findGameInstalls(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  return resolveGameInstalls(
+      registry,
+      scanStores(registry, heroicConfigPaths, preferredUILanguages),
+      xboxGamingRootPaths,
+      preferredUILanguages);
+}
+
 std::unordered_map<GameId, std::unordered_map<InstallSource, size_t>>
 countGameInstalls(const std::vector<GameInstall>& configuredInstalls,
                   const std::vector<GameInstall>& newInstalls) {
@@ -446,6 +537,11 @@ void updateInstalledGamesSettings(
   const auto gameInstalls = findGameInstalls(
       registry, heroicConfigPaths, xboxGamingRootPaths, preferredUILanguages);
 
+  updateGamesSettings(gamesSettings, gameInstalls);
+}
+
+void updateGamesSettings(std::vector<GameSettings>& gamesSettings,
+                         const std::vector<GameInstall>& gameInstalls) {
   const auto newGameInstalls =
       updateMatchingSettings(gamesSettings, gameInstalls, arePathsEquivalent);
 
@@ -35,6 +35,7 @@
 
 #include "gui/state/game/detection/game_install.h"
 #include "gui/state/game/detection/registry.h"
+#include "gui/state/game/detection/store_cache.h"
 #include "gui/state/game/game_settings.h"
 
 namespace loot {
@@ -44,6 +45,27 @@ std::string getSourceDescription(const InstallSource source);
 
 std::string getNameSourceSuffix(const InstallSource source);
 
+std::vector<GameInstall> findSteamLibraryGameInstalls(
+    const RegistryInterface& registry);
+
+std::vector<GameInstall> findHeroicGameInstalls(
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages);
+
+// Scans each store concurrently.
+StoreGameInstalls scanStores(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages);
+
+// Combine the given store scan results with per-game lookups, and deduplicate
+// the installs found.
+std::vector<GameInstall> resolveGameInstalls(
+    const RegistryInterface& registry,
+    const StoreGameInstalls& storeInstalls,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages);
+
 std::vector<GameInstall> findGameInstalls(
     const RegistryInterface& registry,
     const std::vector<std::filesystem::path>& heroicConfigPaths,
@@ -93,6 +115,11 @@ void updateInstalledGamesSettings(
     const std::vector<std::filesystem::path>& heroicConfigPaths,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages);
+
+// As updateInstalledGamesSettings(), but using the given game installs
+// instead of detecting them.
+void updateGamesSettings(std::vector<GameSettings>& gamesSettings,
+                         const std::vector<GameInstall>& gameInstalls);
 }
 
 #endif
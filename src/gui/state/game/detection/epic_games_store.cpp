@@ -218,54 +218,6 @@ EgsManifestData getEgsManifestData(const std::filesystem::path& manifestPath) {
   return data;
 }
 
-std::optional<std::filesystem::path> getEgsGameInstallPath(
-    const loot::RegistryInterface& registry,
-    const loot::GameId gameId) {
-  // Unfortunately we don't know which is the right manifest file, so iterate
-  // over them until the one containing the correct AppName is found.
-  const auto expectedAppName = getEgsAppName(gameId);
-
-  if (!expectedAppName.has_value()) {
-    // Short-circuit to avoid unnecessary directory scanning.
-    return std::nullopt;
-  }
-
-  const auto egsManifestsPath = getEgsManifestsPath(registry);
-  if (!egsManifestsPath.has_value() ||
-      !std::filesystem::exists(egsManifestsPath.value())) {
-    return std::nullopt;
-  }
-
-  const auto logger = getLogger();
-
-  if (logger) {
-    logger->trace(
-        "Checking if game \"{}\" is installed through the Epic Games "
-        "Store.",
-        loot::getGameName(gameId));
-  }
-
-  for (const auto& entry :
-       std::filesystem::directory_iterator(egsManifestsPath.value())) {
-    if (entry.is_regular_file() &&
-        boost::iends_with(entry.path().filename().u8string(), ".item")) {
-      const auto manifestData = getEgsManifestData(entry.path());
-
-      if (manifestData.appName == expectedAppName) {
-        if (logger) {
-          logger->trace(
-              "Extracted install location {} from manifest file at {}.",
-              manifestData.installLocation,
-              entry.path().u8string());
-        }
-
-        return std::filesystem::u8path(manifestData.installLocation);
-      }
-    }
-  }
-
-  return std::nullopt;
-}
 }
 
 namespace loot::epic {
@@ -273,6 +225,11 @@ std::optional<std::string> getEgsAppName(const GameId gameId) {
   return ::getEgsAppName(gameId);
 }
 
+std::optional<std::filesystem::path> getEgsManifestsPath(
+    const RegistryInterface& registry) {
+  return ::getEgsManifestsPath(registry);
+}
+
 std::string getAppDataFolderName(const GameId gameId) {
   switch (gameId) {
     case GameId::tes5se:
@@ -314,16 +271,75 @@ std::optional<std::filesystem::path> findGameInstallPath(
       gameId, preferredUILanguages, pathsToCheck);
 }
 
+EgsInstallLocations findEgsInstallLocations(
+    const RegistryInterface& registry) {
+  EgsInstallLocations installLocations;
+
+  try {
+    const auto egsManifestsPath = getEgsManifestsPath(registry);
+    if (!egsManifestsPath.has_value() ||
+        !std::filesystem::exists(egsManifestsPath.value())) {
+      return installLocations;
+    }
+
+    const auto logger = getLogger();
+
+    if (logger) {
+      logger->trace("Reading Epic Games Store manifests in {}",
+                    egsManifestsPath.value().u8string());
+    }
+
+    // There's no way to tell which manifest file is for which game without
+    // reading it, so read them all once.
+    for (const auto& entry :
+         std::filesystem::directory_iterator(egsManifestsPath.value())) {
+      if (!entry.is_regular_file() ||
+          !boost::iends_with(entry.path().filename().u8string(), ".item")) {
+        continue;
+      }
+
+      const auto manifestData = getEgsManifestData(entry.path());
+      if (manifestData.appName.empty() ||
+          manifestData.installLocation.empty()) {
+        continue;
+      }
+
+      const auto inserted = installLocations.emplace(
+          manifestData.appName,
+          std::filesystem::u8path(manifestData.installLocation));
+
+      if (inserted.second && logger) {
+        logger->trace("Extracted install location {} from manifest file at {}.",
+                      manifestData.installLocation,
+                      entry.path().u8string());
+      }
+    }
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Error while reading Epic Games Store manifests: {}",
+                    e.what());
+    }
+  }
+
+  return installLocations;
+}
+
 std::optional<GameInstall> findGameInstalls(
-    const RegistryInterface& registry,
+    const EgsInstallLocations& installLocations,
     const GameId gameId,
     const std::vector<std::string>& preferredUILanguages) {
   try {
-    const auto installPath = getEgsGameInstallPath(registry, gameId);
+    const auto appName = getEgsAppName(gameId);
+    if (!appName.has_value()) {
+      return std::nullopt;
+    }
 
-    if (installPath.has_value()) {
+    const auto installPath = installLocations.find(appName.value());
+
+    if (installPath != installLocations.end()) {
       const auto localisedInstallPath = findGameInstallPath(
-          gameId, installPath.value(), preferredUILanguages);
+          gameId, installPath->second, preferredUILanguages);
 
       if (localisedInstallPath.has_value()) {
         // Pass a default empty path for the local path because libloot /
@@ -348,4 +364,17 @@ std::optional<GameInstall> findGameInstalls(
 
   return std::nullopt;
 }
+
+std::optional<GameInstall> findGameInstalls(
+    const RegistryInterface& registry,
+    const GameId gameId,
+    const std::vector<std::string>& preferredUILanguages) {
+  if (!getEgsAppName(gameId).has_value()) {
+    // Short-circuit to avoid unnecessary directory scanning.
+    return std::nullopt;
+  }
+
+  return findGameInstalls(
+      findEgsInstallLocations(registry), gameId, preferredUILanguages);
+}
 }
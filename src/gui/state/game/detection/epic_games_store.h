@@ -27,6 +27,7 @@
 #define LOOT_GUI_STATE_GAME_DETECTION_EPIC_GAMES_STORE
 
 #include <filesystem>
+#include <unordered_map>
 #include <vector>
 
 #include "gui/state/game/detection/game_install.h"
@@ -43,6 +44,21 @@ std::optional<std::filesystem::path> findGameInstallPath(
     const std::filesystem::path& rootInstallPath,
     const std::vector<std::string>& preferredUILanguages);
 
+std::optional<std::filesystem::path> getEgsManifestsPath(
+    const RegistryInterface& registry);
+
+// Maps EGS AppNames to install locations.
+typedef std::unordered_map<std::string, std::filesystem::path>
+    EgsInstallLocations;
+
+// Reads all the Epic Games Launcher's manifest files.
+EgsInstallLocations findEgsInstallLocations(const RegistryInterface& registry);
+
+std::optional<GameInstall> findGameInstalls(
+    const EgsInstallLocations& installLocations,
+    const GameId gameId,
+    const std::vector<std::string>& preferredUILanguages);
+
 std::optional<GameInstall> findGameInstalls(
     const RegistryInterface& registry,
     const GameId gameId,
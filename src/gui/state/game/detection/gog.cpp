@@ -31,22 +31,15 @@
 namespace {
 using loot::RegistryRootKey;
 
-std::vector<loot::RegistryValue> getRegistryValues(const loot::GameId gameId) {
-  const auto gogGameIds = loot::gog::getGogGameIds(gameId);
-
-  std::vector<loot::RegistryValue> registryValues;
-  for (const auto& gogGameId : gogGameIds) {
-    registryValues.push_back({RegistryRootKey::LOCAL_MACHINE,
-                              "Software\\GOG.com\\Games\\" + gogGameId,
-                              "path"});
-    registryValues.push_back(
-        {RegistryRootKey::LOCAL_MACHINE,
-         "Software\\Microsoft\\Windows\\CurrentVersion\\Uninstall\\" +
-             gogGameId + "_is1",
-         "InstallLocation"});
-  }
-
-  return registryValues;
+std::vector<loot::RegistryValue> getRegistryValues(
+    const std::string& gogGameId) {
+  return {{RegistryRootKey::LOCAL_MACHINE,
+           "Software\\GOG.com\\Games\\" + gogGameId,
+           "path"},
+          {RegistryRootKey::LOCAL_MACHINE,
+           "Software\\Microsoft\\Windows\\CurrentVersion\\Uninstall\\" +
+               gogGameId + "_is1",
+           "InstallLocation"}};
 }
 }
 
@@ -128,18 +121,41 @@ std::optional<std::string> getAppDataFolderName(const GameId gameId) {
   }
 }
 
-std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
+GogInstallPaths findGogInstallPaths(const RegistryInterface& registry) {
+  GogInstallPaths installPaths;
+
+  for (const auto& gameId : ALL_GAME_IDS) {
+    for (const auto& gogGameId : getGogGameIds(gameId)) {
+      if (installPaths.count(gogGameId) == 0) {
+        installPaths.emplace(
+            gogGameId,
+            findGameInstallPathsInRegistry(registry,
+                                           getRegistryValues(gogGameId)));
+      }
+    }
+  }
+
+  return installPaths;
+}
+
+std::vector<GameInstall> findGameInstalls(const GogInstallPaths& installPaths,
                                           const GameId gameId) {
   std::vector<GameInstall> installs;
 
   try {
-    const auto installPaths =
-        findGameInstallPathsInRegistry(registry, getRegistryValues(gameId));
+    for (const auto& gogGameId : getGogGameIds(gameId)) {
+      const auto it = installPaths.find(gogGameId);
+      if (it == installPaths.end()) {
+        continue;
+      }
 
-    for (const auto& installPath : installPaths) {
-      if (isValidGamePath(gameId, getMasterFilename(gameId), installPath)) {
-        installs.push_back(GameInstall{
-            gameId, InstallSource::gog, installPath, std::filesystem::path()});
+      for (const auto& installPath : it->second) {
+        if (isValidGamePath(gameId, getMasterFilename(gameId), installPath)) {
+          installs.push_back(GameInstall{gameId,
+                                         InstallSource::gog,
+                                         installPath,
+                                         std::filesystem::path()});
+        }
       }
     }
   } catch (const std::exception& e) {
@@ -155,4 +171,17 @@ std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
 
   return installs;
 }
+
+std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
+                                          const GameId gameId) {
+  // Only read the given game's Registry entries.
+  GogInstallPaths installPaths;
+  for (const auto& gogGameId : getGogGameIds(gameId)) {
+    installPaths.emplace(
+        gogGameId,
+        findGameInstallPathsInRegistry(registry, getRegistryValues(gogGameId)));
+  }
+
+  return findGameInstalls(installPaths, gameId);
+}
 }
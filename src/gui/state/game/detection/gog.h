@@ -26,6 +26,9 @@
 #ifndef LOOT_GUI_STATE_GAME_DETECTION_GOG
 #define LOOT_GUI_STATE_GAME_DETECTION_GOG
 
+#include <filesystem>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "gui/state/game/detection/game_install.h"
@@ -36,6 +39,17 @@ std::vector<std::string> getGogGameIds(const GameId gameId);
 
 std::optional<std::string> getAppDataFolderName(const GameId gameId);
 
+// Maps GOG product IDs to the install paths recorded for them in the
+// Registry.
+typedef std::unordered_map<std::string, std::vector<std::filesystem::path>>
+    GogInstallPaths;
+
+// Reads the Registry entries for all supported GOG product IDs.
+GogInstallPaths findGogInstallPaths(const RegistryInterface& registry);
+
+std::vector<GameInstall> findGameInstalls(const GogInstallPaths& installPaths,
+                                          const GameId gameId);
+
 std::vector<GameInstall> findGameInstalls(const RegistryInterface& registry,
                                           const GameId gameId);
 }
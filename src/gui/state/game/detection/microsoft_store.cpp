@@ -25,6 +25,9 @@
 
 #include "gui/state/game/detection/microsoft_store.h"
 
+#include <algorithm>
+#include <cctype>
+
 #include "gui/helpers.h"
 #include "gui/state/game/detection/common.h"
 #include "gui/state/logging.h"
@@ -104,32 +107,24 @@ bool isOnMicrosoftStore(const GameId gameId) {
   }
 }
 
-std::filesystem::path getGameContentPath(
-    GameId gameId,
-    const std::filesystem::path& xboxGamingRootPath) {
+std::string getGameFolderName(GameId gameId) {
   switch (gameId) {
     case GameId::tes3:
-      return xboxGamingRootPath / "The Elder Scrolls III- Morrowind (PC)" /
-             "Content";
+      return "The Elder Scrolls III- Morrowind (PC)";
     case GameId::tes4:
-      return xboxGamingRootPath / "The Elder Scrolls IV- Oblivion (PC)" /
-             "Content";
+      return "The Elder Scrolls IV- Oblivion (PC)";
     case GameId::tes5se:
-      return xboxGamingRootPath /
-             "The Elder Scrolls V- Skyrim Special Edition (PC)" / "Content";
+      return "The Elder Scrolls V- Skyrim Special Edition (PC)";
     case GameId::fo3:
-      return xboxGamingRootPath / "Fallout 3- Game of the Year Edition (PC)" /
-             "Content";
+      return "Fallout 3- Game of the Year Edition (PC)";
     case GameId::fonv:
-      return xboxGamingRootPath / "Fallout- New Vegas Ultimate Edition (PC)" /
-             "Content";
+      return "Fallout- New Vegas Ultimate Edition (PC)";
     case GameId::fo4:
-      return xboxGamingRootPath / "Fallout 4 (PC)" / "Content";
+      return "Fallout 4 (PC)";
     case GameId::starfield:
-      return xboxGamingRootPath / "Starfield" / "Content";
+      return "Starfield";
     case GameId::oblivionRemastered:
-      return xboxGamingRootPath / "The Elder Scrolls IV- Oblivion Remastered" /
-             "Content";
+      return "The Elder Scrolls IV- Oblivion Remastered";
     case GameId::nehrim:
     case GameId::tes5:
     case GameId::tes5vr:
@@ -143,22 +138,39 @@ std::filesystem::path getGameContentPath(
   }
 }
 
+// Folder names are compared case-insensitively, as they are on Windows. They
+// are all ASCII.
+std::string toLowercase(std::string folderName) {
+  std::transform(folderName.begin(),
+                 folderName.end(),
+                 folderName.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+
+  return folderName;
+}
+
 std::optional<GameInstall> findMicrosoftStoreGameInstall(
+    const loot::microsoft::XboxGameFolders& gameFolders,
     const GameId gameId,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages) {
   if (!isOnMicrosoftStore(gameId)) {
     return std::nullopt;
   }
 
+  const auto folderPaths =
+      gameFolders.find(toLowercase(getGameFolderName(gameId)));
+  if (folderPaths == gameFolders.end()) {
+    return std::nullopt;
+  }
+
   // Search for games installed using newer versions of the Xbox app,
   // which does not create Registry entries for the games. Instead, they
   // go in a configurable location, which can be found by looking for a
   // .GamingRoot file in the root of each mounted drive and reading the
   // location path out of that file. The game folders within that location
   // have fixed names.
-  for (const auto& xboxGamingRootPath : xboxGamingRootPaths) {
-    const auto locationPath = getGameContentPath(gameId, xboxGamingRootPath);
+  for (const auto& folderPath : folderPaths->second) {
+    const auto locationPath = folderPath / "Content";
 
     const auto pathsToCheck =
         getGameLocalisationDirectories(gameId, locationPath);
@@ -182,15 +194,41 @@ std::optional<GameInstall> findMicrosoftStoreGameInstall(
 }
 
 namespace loot::microsoft {
+XboxGameFolders findXboxGameFolders(
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths) {
+  XboxGameFolders gameFolders;
+
+  for (const auto& xboxGamingRootPath : xboxGamingRootPaths) {
+    try {
+      for (const auto& entry :
+           std::filesystem::directory_iterator(xboxGamingRootPath)) {
+        if (entry.is_directory()) {
+          gameFolders[toLowercase(entry.path().filename().u8string())]
+              .push_back(entry.path());
+        }
+      }
+    } catch (const std::exception& e) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->error("Error while listing the Xbox gaming root at {}: {}",
+                      xboxGamingRootPath.u8string(),
+                      e.what());
+      }
+    }
+  }
+
+  return gameFolders;
+}
+
 std::vector<GameInstall> findGameInstalls(
+    const XboxGameFolders& gameFolders,
     const GameId gameId,
-    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
     const std::vector<std::string>& preferredUILanguages) {
   std::vector<GameInstall> installs;
 
   try {
     auto install = findMicrosoftStoreGameInstall(
-        gameId, xboxGamingRootPaths, preferredUILanguages);
+        gameFolders, gameId, preferredUILanguages);
 
     if (install.has_value()) {
       installs.push_back(install.value());
@@ -206,4 +244,17 @@ std::vector<GameInstall> findGameInstalls(
 
   return installs;
 }
+
+std::vector<GameInstall> findGameInstalls(
+    const GameId gameId,
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  if (!isOnMicrosoftStore(gameId)) {
+    // Short-circuit to avoid unnecessary directory scanning.
+    return {};
+  }
+
+  return findGameInstalls(
+      findXboxGameFolders(xboxGamingRootPaths), gameId, preferredUILanguages);
+}
 }
@@ -27,6 +27,8 @@
 #define LOOT_GUI_STATE_GAME_DETECTION_MICROSOFT_STORE
 
 #include <filesystem>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "gui/state/game/detection/game_install.h"
@@ -34,6 +36,20 @@
 #include "gui/state/game/game_settings.h"
 
 namespace loot::microsoft {
+// Maps the lowercased names of the folders in Xbox gaming roots to the paths
+// of those folders, in the order their roots were given.
+typedef std::unordered_map<std::string, std::vector<std::filesystem::path>>
+    XboxGameFolders;
+
+// Lists the folders in each of the given Xbox gaming roots.
+XboxGameFolders findXboxGameFolders(
+    const std::vector<std::filesystem::path>& xboxGamingRootPaths);
+
+std::vector<GameInstall> findGameInstalls(
+    const XboxGameFolders& gameFolders,
+    const GameId gameId,
+    const std::vector<std::string>& preferredUILanguages);
+
 std::vector<GameInstall> findGameInstalls(
     const GameId gameId,
     const std::vector<std::filesystem::path>& xboxGamingRootPaths,
@@ -0,0 +1,381 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/detection/store_cache.h"
+
+#include <fmt/format.h>
+
+#include <QtCore/QCryptographicHash>
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <stdexcept>
+
+#include "gui/helpers.h"
+#include "gui/state/game/detection/detail.h"
+#include "gui/state/game/detection/steam.h"
+#include "gui/state/logging.h"
+#include "gui/version.h"
+
+namespace {
+using loot::addToHash;
+using loot::GameInstall;
+using loot::getLogger;
+
+// Directories' modification times change when entries are added to or
+// removed from them, so they can be hashed in the same way as files.
+void addPathToHash(QCryptographicHash& hash,
+                   const std::filesystem::path& path) {
+  addToHash(hash, path.u8string());
+
+  std::error_code statusError;
+  const auto status = std::filesystem::status(path, statusError);
+  if (statusError || !std::filesystem::exists(status)) {
+    addToHash(hash, "missing");
+    return;
+  }
+
+  std::error_code sizeError;
+  const auto size = std::filesystem::is_regular_file(status)
+                        ? std::filesystem::file_size(path, sizeError)
+                        : 0;
+
+  std::error_code timeError;
+  const auto modificationTime =
+      std::filesystem::last_write_time(path, timeError);
+
+  if (sizeError || timeError) {
+    addToHash(hash, "missing");
+  } else {
+    addToHash(
+        hash,
+        fmt::format(
+            "{}:{}", size, modificationTime.time_since_epoch().count()));
+  }
+}
+
+// Hashes the directory and each of the entries in it with the given
+// extension.
+void addDirectoryToHash(QCryptographicHash& hash,
+                        const std::filesystem::path& directory,
+                        const std::string& extension) {
+  addPathToHash(hash, directory);
+
+  std::vector<std::filesystem::path> paths;
+  std::error_code error;
+  for (std::filesystem::directory_iterator it(directory, error), end;
+       !error && it != end;
+       it.increment(error)) {
+    if (it->path().extension().u8string() == extension) {
+      paths.push_back(it->path());
+    }
+  }
+
+  // Directory iteration order is unspecified.
+  std::sort(paths.begin(), paths.end());
+
+  for (const auto& path : paths) {
+    addPathToHash(hash, path);
+  }
+}
+
+std::string getHashString(const QCryptographicHash& hash) {
+  return hash.result().toHex().toStdString();
+}
+
+std::string getSteamValidator(const loot::RegistryInterface& registry) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+
+  // Steam updates libraryfolders.vdf when libraries are added or removed and
+  // when apps are installed into or removed from them, and it adds, replaces
+  // or removes app manifests in a library's steamapps directory when a game
+  // is installed, moved or uninstalled, which changes the directory's
+  // modification time. The library list is needed to find the steamapps
+  // directories, but libraryfolders.vdf is small, so that's still much
+  // cheaper than checking every app manifest.
+  for (const auto& steamInstallPath :
+       loot::steam::getSteamInstallPaths(registry)) {
+    addPathToHash(hash,
+                  steamInstallPath / "config" / "libraryfolders.vdf");
+
+    for (const auto& libraryPath :
+         loot::steam::getSteamLibraryPaths(steamInstallPath)) {
+      addPathToHash(hash, libraryPath / "steamapps");
+    }
+  }
+
+  return getHashString(hash);
+}
+
+std::string getHeroicValidator(
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+
+  // The preferred languages affect which localised install path is used.
+  for (const auto& language : preferredUILanguages) {
+    addToHash(hash, language);
+  }
+
+  // These are the files that loot::heroic::findGameInstalls() reads.
+  for (const auto& heroicConfigPath : heroicConfigPaths) {
+    addPathToHash(hash, heroicConfigPath / "gog_store" / "installed.json");
+    addPathToHash(hash,
+                  heroicConfigPath / "legendaryConfig" / "legendary" /
+                      "installed.json");
+    addDirectoryToHash(hash, heroicConfigPath / "GamesConfig", ".json");
+  }
+
+  return getHashString(hash);
+}
+
+std::string getEgsValidator(const loot::RegistryInterface& registry) {
+  QCryptographicHash hash(QCryptographicHash::Sha256);
+
+  const auto manifestsPath = loot::epic::getEgsManifestsPath(registry);
+  if (manifestsPath.has_value()) {
+    addDirectoryToHash(hash, manifestsPath.value(), ".item");
+  }
+
+  return getHashString(hash);
+}
+
+QString toQString(const std::filesystem::path& path) {
+  return QString::fromStdString(path.u8string());
+}
+
+std::filesystem::path toPath(const QJsonValue& value) {
+  return std::filesystem::u8path(value.toString().toStdString());
+}
+
+QJsonArray toJson(const std::vector<GameInstall>& installs) {
+  QJsonArray array;
+  for (const auto& install : installs) {
+    QJsonObject object;
+    object["gameId"] = static_cast<int>(install.gameId);
+    object["source"] = static_cast<int>(install.source);
+    object["installPath"] = toQString(install.installPath);
+    object["localPath"] = toQString(install.localPath);
+    array.append(object);
+  }
+
+  return array;
+}
+
+std::vector<GameInstall> toGameInstalls(const QJsonValue& value) {
+  std::vector<GameInstall> installs;
+  for (const auto& element : value.toArray()) {
+    const auto object = element.toObject();
+
+    GameInstall install;
+    install.gameId = static_cast<loot::GameId>(object["gameId"].toInt());
+    install.source =
+        static_cast<loot::InstallSource>(object["source"].toInt());
+    install.installPath = toPath(object["installPath"]);
+    install.localPath = toPath(object["localPath"]);
+    installs.push_back(install);
+  }
+
+  return installs;
+}
+}
+
+namespace loot {
+StoreValidators getStoreValidators(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  StoreValidators validators;
+  validators.steam = getSteamValidator(registry);
+  validators.heroic =
+      getHeroicValidator(heroicConfigPaths, preferredUILanguages);
+  validators.egs = getEgsValidator(registry);
+
+  return validators;
+}
+
+std::optional<GameStoreCache> readGameStoreCache(
+    const std::filesystem::path& cachePath) {
+  const auto logger = getLogger();
+
+  if (!std::filesystem::exists(cachePath)) {
+    return std::nullopt;
+  }
+
+  QFile file(toQString(cachePath));
+  if (!file.open(QIODevice::ReadOnly)) {
+    if (logger) {
+      logger->warn("Could not open game detection cache at {}",
+                   cachePath.u8string());
+    }
+    return std::nullopt;
+  }
+
+  QJsonParseError parseError;
+  const auto document = QJsonDocument::fromJson(file.readAll(), &parseError);
+  if (parseError.error != QJsonParseError::NoError || !document.isObject()) {
+    if (logger) {
+      logger->warn("Could not parse game detection cache at {}: {}",
+                   cachePath.u8string(),
+                   parseError.errorString().toStdString());
+    }
+    return std::nullopt;
+  }
+
+  const auto root = document.object();
+
+  // Detection logic may change between versions, so don't trust results
+  // cached by another version.
+  if (root["version"].toString().toStdString() != getLootVersion()) {
+    if (logger) {
+      logger->debug(
+          "Ignoring game detection cache written by a different version of "
+          "LOOT");
+    }
+    return std::nullopt;
+  }
+
+  GameStoreCache cache;
+
+  const auto steam = root["steam"].toObject();
+  cache.validators.steam = steam["validator"].toString().toStdString();
+  cache.installs.steam = toGameInstalls(steam["installs"]);
+
+  const auto heroic = root["heroic"].toObject();
+  cache.validators.heroic = heroic["validator"].toString().toStdString();
+  cache.installs.heroic = toGameInstalls(heroic["installs"]);
+
+  const auto egs = root["egs"].toObject();
+  cache.validators.egs = egs["validator"].toString().toStdString();
+
+  const auto locations = egs["installLocations"].toObject();
+  for (auto it = locations.begin(); it != locations.end(); ++it) {
+    cache.installs.egsInstallLocations.emplace(it.key().toStdString(),
+                                               toPath(it.value()));
+  }
+
+  return cache;
+}
+
+void writeGameStoreCache(const std::filesystem::path& cachePath,
+                         const GameStoreCache& cache) {
+  QJsonObject steam;
+  steam["validator"] = QString::fromStdString(cache.validators.steam);
+  steam["installs"] = toJson(cache.installs.steam);
+
+  QJsonObject heroic;
+  heroic["validator"] = QString::fromStdString(cache.validators.heroic);
+  heroic["installs"] = toJson(cache.installs.heroic);
+
+  QJsonObject locations;
+  for (const auto& [appName, installLocation] :
+       cache.installs.egsInstallLocations) {
+    locations[QString::fromStdString(appName)] = toQString(installLocation);
+  }
+
+  QJsonObject egs;
+  egs["validator"] = QString::fromStdString(cache.validators.egs);
+  egs["installLocations"] = locations;
+
+  QJsonObject root;
+  root["version"] = QString::fromStdString(getLootVersion());
+  root["steam"] = steam;
+  root["heroic"] = heroic;
+  root["egs"] = egs;
+
+  // An interrupted write must not leave a truncated cache behind.
+  writeFileAtomically(
+      cachePath,
+      QJsonDocument(root).toJson(QJsonDocument::Compact).toStdString());
+}
+
+bool updateGameStoreCache(
+    GameStoreCache& cache,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages) {
+  // The validators are calculated before scanning so that if a store changes
+  // during its scan, the stored validator won't match and the store will be
+  // rescanned next time.
+  const auto validators =
+      getStoreValidators(registry, heroicConfigPaths, preferredUILanguages);
+
+  const auto logger = getLogger();
+
+  std::optional<std::future<std::vector<GameInstall>>> steamInstalls;
+  if (validators.steam != cache.validators.steam) {
+    if (logger) {
+      logger->debug("Steam install state has changed, rescanning it.");
+    }
+    steamInstalls = std::async(
+        std::launch::async, findSteamLibraryGameInstalls, std::cref(registry));
+  }
+
+  std::optional<std::future<std::vector<GameInstall>>> heroicInstalls;
+  if (validators.heroic != cache.validators.heroic) {
+    if (logger) {
+      logger->debug(
+          "Heroic Games Launcher install state has changed, rescanning it.");
+    }
+    heroicInstalls = std::async(std::launch::async,
+                                findHeroicGameInstalls,
+                                std::cref(heroicConfigPaths),
+                                std::cref(preferredUILanguages));
+  }
+
+  std::optional<std::future<epic::EgsInstallLocations>> egsInstallLocations;
+  if (validators.egs != cache.validators.egs) {
+    if (logger) {
+      logger->debug(
+          "Epic Games Launcher install state has changed, rescanning it.");
+    }
+    egsInstallLocations = std::async(std::launch::async,
+                                     epic::findEgsInstallLocations,
+                                     std::cref(registry));
+  }
+
+  if (steamInstalls.has_value()) {
+    cache.installs.steam = steamInstalls.value().get();
+  }
+  if (heroicInstalls.has_value()) {
+    cache.installs.heroic = heroicInstalls.value().get();
+  }
+  if (egsInstallLocations.has_value()) {
+    cache.installs.egsInstallLocations = egsInstallLocations.value().get();
+  }
+
+  const auto changed = steamInstalls.has_value() ||
+                       heroicInstalls.has_value() ||
+                       egsInstallLocations.has_value();
+
+  cache.validators = validators;
+
+  return changed;
+}
+}
@@ -0,0 +1,83 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_DETECTION_STORE_CACHE
+#define LOOT_GUI_STATE_GAME_DETECTION_STORE_CACHE
+
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "gui/state/game/detection/epic_games_store.h"
+#include "gui/state/game/detection/game_install.h"
+#include "gui/state/game/detection/registry.h"
+
+namespace loot {
+// The results of scanning stores that keep their own records of the games
+// they've installed, as opposed to the stores that are checked per game.
+struct StoreGameInstalls {
+  std::vector<GameInstall> steam;
+  std::vector<GameInstall> heroic;
+  epic::EgsInstallLocations egsInstallLocations;
+};
+
+// Validators are hashes of the paths, sizes and modification times of the
+// files that each store scan reads, so they can be computed without reading
+// any of those files' content.
+struct StoreValidators {
+  std::string steam;
+  std::string heroic;
+  std::string egs;
+};
+
+struct GameStoreCache {
+  StoreValidators validators;
+  StoreGameInstalls installs;
+};
+
+StoreValidators getStoreValidators(
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages);
+
+// Returns std::nullopt if the cache file doesn't exist, can't be parsed, or
+// was written by a different version of LOOT.
+std::optional<GameStoreCache> readGameStoreCache(
+    const std::filesystem::path& cachePath);
+
+void writeGameStoreCache(const std::filesystem::path& cachePath,
+                         const GameStoreCache& cache);
+
+// Rescans the stores that have changed since the cache was last updated.
+// Returns true if any stores were rescanned.
+bool updateGameStoreCache(
+    GameStoreCache& cache,
+    const RegistryInterface& registry,
+    const std::vector<std::filesystem::path>& heroicConfigPaths,
+    const std::vector<std::string>& preferredUILanguages);
+}
+
+#endif
@@ -49,11 +49,15 @@
 
 #include <fmt/ranges.h>
 
+#include <QtCore/QCryptographicHash>
+#include <boost/algorithm/string/predicate.hpp>
+
 #include "gui/helpers.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/game/validation.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 #include "loot/exception/undefined_group_error.h"
 
@@ -64,6 +68,7 @@ using std::filesystem::u8path;
 namespace fs = std::filesystem;
 
 namespace {
+using loot::addToHash;
 using loot::Filename;
 using loot::GameId;
 using loot::GameType;
@@ -151,6 +156,55 @@ void copyMasterlistFromDefaultGameFolder(
   }
 }
 
+void addFilesToHash(QCryptographicHash& hash,
+                    const std::vector<loot::File>& files) {
+  addToHash(hash, std::to_string(files.size()));
+  for (const auto& file : files) {
+    addToHash(hash, std::string(file.GetName()));
+  }
+}
+
+void addFileToHash(QCryptographicHash& hash,
+                   const std::filesystem::path& path) {
+  addToHash(hash, path.u8string());
+
+  std::error_code sizeError;
+  std::error_code timeError;
+  const auto size = std::filesystem::file_size(path, sizeError);
+  const auto modificationTime =
+      std::filesystem::last_write_time(path, timeError);
+
+  if (sizeError || timeError) {
+    addToHash(hash, "missing");
+  } else {
+    addToHash(hash,
+              fmt::format("{}:{}",
+                          size,
+                          modificationTime.time_since_epoch().count()));
+  }
+}
+
+// Archives can be loaded as part of plugins, and the assets they contain are
+// taken into account when sorting.
+std::vector<std::filesystem::path> findArchives(
+    const std::filesystem::path& directory) {
+  std::vector<std::filesystem::path> archivePaths;
+
+  std::error_code errorCode;
+  for (const auto& entry :
+       std::filesystem::directory_iterator(directory, errorCode)) {
+    const auto extension = entry.path().extension().u8string();
+    if (entry.is_regular_file() && (boost::iequals(extension, ".bsa") ||
+                                    boost::iequals(extension, ".ba2"))) {
+      archivePaths.push_back(entry.path());
+    }
+  }
+
+  std::sort(archivePaths.begin(), archivePaths.end());
+
+  return archivePaths;
+}
+
 std::optional<std::filesystem::path> getCCCFilename(const GameId gameId) {
   switch (gameId) {
     case GameId::tes3:
@@ -590,7 +644,10 @@ Game::Game(Game&& game) noexcept {
   settings_ = std::move(game.settings_);
   creationClubPlugins_ = std::move(game.creationClubPlugins_);
   gameHandle_ = std::move(game.gameHandle_);
+  userlistWriter_ = std::move(game.userlistWriter_);
+  userlistWriteErrorHandler_ = std::move(game.userlistWriteErrorHandler_);
   messages_ = std::move(game.messages_);
+  std::atomic_store(&snapshot_, std::atomic_load(&game.snapshot_));
   lootDataPath_ = std::move(game.lootDataPath_);
   preludePath_ = std::move(game.preludePath_);
   sortCount_ = std::move(game.sortCount_);
@@ -600,10 +657,13 @@ Game::Game(Game&& game) noexcept {
 
 Game& Game::operator=(Game&& game) noexcept {
   if (&game != this) {
+    userlistWriter_ = std::move(game.userlistWriter_);
+    userlistWriteErrorHandler_ = std::move(game.userlistWriteErrorHandler_);
     settings_ = std::move(game.settings_);
     creationClubPlugins_ = std::move(game.creationClubPlugins_);
     gameHandle_ = std::move(game.gameHandle_);
     messages_ = std::move(game.messages_);
+    std::atomic_store(&snapshot_, std::atomic_load(&game.snapshot_));
     lootDataPath_ = std::move(game.lootDataPath_);
     preludePath_ = std::move(game.preludePath_);
     sortCount_ = std::move(game.sortCount_);
@@ -640,15 +700,28 @@ void Game::init() {
   supportsLightPlugins_ =
       ::supportsLightPlugins(settings_.getId(), settings_.getDataPath());
 
+  // Finish any pending writes before the writer is replaced.
+  userlistWriter_.reset();
+
   gameHandle_ = CreateGameHandle(getGameType(settings_.getId()),
                                  settings_.getGamePath(),
                                  settings_.getGameLocalPath());
 
+  userlistWriter_ = std::make_unique<UserlistWriter>(getUserlistPath());
+  userlistWriter_->setErrorHandler(userlistWriteErrorHandler_);
+
   initLootGameFolder(lootDataPath_, settings_);
+
+  publishLoadOrderSnapshot();
+  publishMetadataSnapshot();
 }
 
 bool Game::isInitialised() const { return gameHandle_ != nullptr; }
 
+std::shared_ptr<const GameSnapshot> Game::getSnapshot() const {
+  return std::atomic_load(&snapshot_);
+}
+
 std::unique_ptr<const PluginInterface> Game::getPlugin(
     const std::string& name) const {
   return gameHandle_->GetPlugin(name);
@@ -719,11 +792,17 @@ std::vector<LoadOrderBackup> Game::findLoadOrderBackups() const {
 }
 
 void Game::loadAllInstalledPlugins(bool headersOnly) {
+  TraceSpan span("Game::loadAllInstalledPlugins");
+
   loadCurrentLoadOrderState();
 
   const auto installedPluginPaths = getInstalledPluginPaths();
   gameHandle_->ClearLoadedPlugins();
-  gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+
+  {
+    TraceSpan loadSpan("GameInterface::LoadPlugins");
+    gameHandle_->LoadPlugins(installedPluginPaths, headersOnly);
+  }
 
   // Check if any plugins have been removed.
   std::vector<std::string> installedPluginNames;
@@ -743,6 +822,8 @@ void Game::loadAllInstalledPlugins(bool headersOnly) {
 
   supportsLightPlugins_ =
       ::supportsLightPlugins(settings_.getId(), settings_.getDataPath());
+
+  publishLoadOrderSnapshot();
 }
 
 bool Game::arePluginsFullyLoaded() const { return pluginsFullyLoaded_; }
@@ -765,6 +846,10 @@ std::filesystem::path Game::getOldMessagesPath() const {
   return getLOOTGamePath() / "old_messages.json";
 }
 
+std::filesystem::path Game::getSortCachePath() const {
+  return getLOOTGamePath() / "sort_cache.json";
+}
+
 fs::path Game::getUserlistPath() const {
   return getLOOTGamePath() / "userlist.yaml";
 }
@@ -780,6 +865,8 @@ std::vector<std::string> Game::getLoadOrder() const {
 void Game::setLoadOrder(const std::vector<std::string>& loadOrder) {
   backupLoadOrder(getLoadOrder(), getBackupsPath());
   gameHandle_->SetLoadOrder(loadOrder);
+
+  publishLoadOrderSnapshot();
 }
 
 std::string Game::getLoadOrderAsTextTable() const {
@@ -828,8 +915,15 @@ bool Game::isLoadOrderAmbiguous() const {
 }
 
 std::vector<std::string> Game::sortPlugins() {
+  TraceSpan span("Game::sortPlugins");
+
+  flushUserMetadata();
+
   loadCurrentLoadOrderState();
 
+  // The load order may have been changed by another application.
+  publishLoadOrderSnapshot();
+
   try {
     // Clear any existing game-specific messages, as these only relate to
     // state that has been changed by sorting.
@@ -837,6 +931,22 @@ std::vector<std::string> Game::sortPlugins() {
 
     const auto loadOrder = gameHandle_->GetLoadOrder();
 
+    // If nothing that affects sorting has changed since the last sort, its
+    // result can be reused without loading all the plugins' data.
+    const auto fingerprint = getSortFingerprint(loadOrder);
+    if (fingerprint.has_value()) {
+      const auto cachedPlugins =
+          getCachedSortResult(loadOrder, fingerprint.value());
+      if (cachedPlugins.has_value()) {
+        appendMessages(createMessagesForRemovedPlugins(
+            checkForRemovedPlugins(loadOrder, cachedPlugins.value())));
+
+        sortCount_.increment();
+
+        return cachedPlugins.value();
+      }
+    }
+
     std::vector<std::filesystem::path> pluginPaths;
     for (const auto& pluginName : loadOrder) {
       if (pluginName != settings_.getMasterFilename() ||
@@ -849,12 +959,24 @@ std::vector<std::string> Game::sortPlugins() {
       }
     }
 
-    gameHandle_->LoadPlugins(pluginPaths, false);
-    auto sortedPlugins = gameHandle_->SortPlugins(loadOrder);
+    {
+      TraceSpan loadSpan("GameInterface::LoadPlugins");
+      gameHandle_->LoadPlugins(pluginPaths, false);
+    }
+
+    std::vector<std::string> sortedPlugins;
+    {
+      TraceSpan sortSpan("GameInterface::SortPlugins");
+      sortedPlugins = gameHandle_->SortPlugins(loadOrder);
+    }
 
     appendMessages(createMessagesForRemovedPlugins(
         checkForRemovedPlugins(loadOrder, sortedPlugins)));
 
+    if (fingerprint.has_value()) {
+      cacheSortResult(fingerprint.value(), sortedPlugins);
+    }
+
     sortCount_.increment();
 
     return sortedPlugins;
@@ -936,6 +1058,11 @@ std::vector<SourcedMessage> Game::getMessages(
 void Game::clearMessages() { messages_.clear(); }
 
 void Game::loadMetadata() {
+  TraceSpan span("Game::loadMetadata");
+
+  // The userlist is about to be read, so make sure it's up to date.
+  flushUserMetadata();
+
   const auto logger = getLogger();
 
   try {
@@ -1007,6 +1134,8 @@ void Game::loadMetadata() {
             escapeMarkdownASCIIPunctuation(e.what()),
             docUrl)});
   }
+
+  publishMetadataSnapshot();
 }
 
 std::vector<std::string> Game::getKnownBashTags() const {
@@ -1069,7 +1198,9 @@ std::optional<PluginMetadata> Game::getUserMetadata(
 }
 
 void Game::setUserGroups(const std::vector<Group>& groups) {
-  return gameHandle_->GetDatabase().SetUserGroups(groups);
+  gameHandle_->GetDatabase().SetUserGroups(groups);
+
+  publishMetadataSnapshot();
 }
 
 void Game::addUserMetadata(const PluginMetadata& metadata) {
@@ -1082,12 +1213,45 @@ void Game::clearUserMetadata(const std::string& pluginName) {
 
 void Game::clearAllUserMetadata() {
   gameHandle_->GetDatabase().DiscardAllUserMetadata();
+
+  // Discarding user metadata also discards user groups.
+  publishMetadataSnapshot();
+}
+
+void Game::setUserlistWriteErrorHandler(
+    const UserlistWriter::ErrorHandler& handler) {
+  userlistWriteErrorHandler_ = handler;
+
+  if (userlistWriter_) {
+    userlistWriter_->setErrorHandler(handler);
+  }
 }
 
 void Game::saveUserMetadata() {
+  // libloot can only write user metadata to a file, so serialise it here
+  // while nothing else can be using the database and leave the writer to
+  // replace the userlist with the serialised content.
+  auto stagingPath = getUserlistPath();
+  stagingPath += ".staging";
+
   MetadataWriteOptions options;
   options.SetTruncate(true);
-  gameHandle_->GetDatabase().WriteUserMetadata(getUserlistPath(), options);
+  gameHandle_->GetDatabase().WriteUserMetadata(stagingPath, options);
+
+  std::ifstream in(stagingPath, std::ios::binary);
+  std::string content(std::istreambuf_iterator<char>(in),
+                      std::istreambuf_iterator<char>{});
+  in.close();
+
+  std::filesystem::remove(stagingPath);
+
+  userlistWriter_->requestWrite(std::move(content));
+}
+
+void Game::flushUserMetadata() {
+  if (userlistWriter_) {
+    userlistWriter_->flush();
+  }
 }
 
 std::filesystem::path Game::getLOOTGamePath() const {
@@ -1099,6 +1263,8 @@ std::filesystem::path Game::getBackupsPath() const {
 }
 
 std::vector<std::filesystem::path> Game::getInstalledPluginPaths() const {
+  TraceSpan span("Game::getInstalledPluginPaths");
+
   // Checking to see if a plugin is valid is relatively slow, almost entirely
   // due to blocking on opening the file, so instead just add all the files
   // found to a buffer and then check if they're valid plugins in parallel.
@@ -1171,7 +1337,128 @@ void Game::appendMessage(const SourcedMessage& message) {
   messages_.push_back(message);
 }
 
+std::optional<std::string> Game::getSortFingerprint(
+    const std::vector<std::string>& loadOrder) const {
+  TraceSpan span("Game::getSortFingerprint");
+
+  try {
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+
+    addToHash(hash, GetLiblootVersion());
+    addToHash(hash, GetLiblootRevision());
+
+    // The load order and the plugins' metadata, evaluated against the
+    // current install, decide how plugins are sorted. The metadata is taken
+    // from what has been loaded, not the metadata files, because that is
+    // what sorting uses.
+    const auto& database = gameHandle_->GetDatabase();
+    for (const auto& pluginName : loadOrder) {
+      addToHash(hash, pluginName);
+      addToHash(hash, isPluginActive(pluginName) ? "active" : "inactive");
+
+      const auto pluginPath = resolveGameFilePath(pluginName);
+      if (pluginPath.has_value()) {
+        addFileToHash(hash, pluginPath.value());
+      } else {
+        addToHash(hash, "missing");
+      }
+
+      const auto metadata =
+          database.GetPluginMetadata(pluginName, true, true)
+              .value_or(PluginMetadata(pluginName));
+      addToHash(hash, metadata.GetGroup().value_or(""));
+      addFilesToHash(hash, metadata.GetLoadAfterFiles());
+      addFilesToHash(hash, metadata.GetRequirements());
+    }
+
+    for (const auto& group : getGroups()) {
+      addToHash(hash, group.GetName());
+
+      const auto afterGroups = group.GetAfterGroups();
+      addToHash(hash, std::to_string(afterGroups.size()));
+      for (const auto& afterGroup : afterGroups) {
+        addToHash(hash, afterGroup);
+      }
+    }
+
+    auto dataPaths = gameHandle_->GetAdditionalDataPaths();
+    dataPaths.push_back(settings_.getDataPath());
+    for (const auto& dataPath : dataPaths) {
+      for (const auto& archivePath : findArchives(dataPath)) {
+        addFileToHash(hash, archivePath);
+      }
+    }
+
+    return hash.result().toHex().toStdString();
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error(
+          "Failed to calculate the sort inputs' fingerprint. Details: {}",
+          e.what());
+    }
+
+    return std::nullopt;
+  }
+}
+
+std::optional<std::vector<std::string>> Game::getCachedSortResult(
+    const std::vector<std::string>& loadOrder,
+    const std::string& fingerprint) const {
+  const auto logger = getLogger();
+
+  try {
+    const auto cachedPlugins =
+        readCachedSortResult(getSortCachePath(), fingerprint);
+    if (!cachedPlugins.has_value()) {
+      return std::nullopt;
+    }
+
+    // The plugins must all be loaded for their data to be displayed.
+    const auto isLoaded = [this](const std::string& pluginName) {
+      return gameHandle_->GetPlugin(pluginName) != nullptr;
+    };
+
+    if (cachedPlugins.value().size() != loadOrder.size() ||
+        !std::all_of(cachedPlugins.value().begin(),
+                     cachedPlugins.value().end(),
+                     isLoaded)) {
+      return std::nullopt;
+    }
+
+    if (logger) {
+      logger->info(
+          "Nothing that affects sorting has changed since the last sort, "
+          "reusing its result.");
+    }
+
+    return cachedPlugins;
+  } catch (const std::exception& e) {
+    if (logger) {
+      logger->error("Failed to read the cached sort result. Details: {}",
+                    e.what());
+    }
+
+    return std::nullopt;
+  }
+}
+
+void Game::cacheSortResult(
+    const std::string& fingerprint,
+    const std::vector<std::string>& sortedPlugins) const {
+  try {
+    writeCachedSortResult(getSortCachePath(), fingerprint, sortedPlugins);
+  } catch (const std::exception& e) {
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to cache the sort result. Details: {}", e.what());
+    }
+  }
+}
+
 void Game::loadCurrentLoadOrderState() {
+  TraceSpan span("Game::loadCurrentLoadOrderState");
+
   try {
     gameHandle_->LoadCurrentLoadOrderState();
   } catch (const std::exception& e) {
@@ -1186,5 +1473,53 @@ void Game::loadCurrentLoadOrderState() {
                   "information displayed may be incorrect.")));
   }
 }
+
+void Game::publishLoadOrderSnapshot() {
+  publishSnapshot([this](GameSnapshot& snapshot) {
+    snapshot.loadOrder = gameHandle_->GetLoadOrder();
+
+    snapshot.loadedPluginCount = gameHandle_->GetLoadedPlugins().size();
+    snapshot.isLoadOrderAmbiguous = gameHandle_->IsLoadOrderAmbiguous();
+    snapshot.supportsLightPlugins = supportsLightPlugins();
+    snapshot.supportsMediumPlugins = supportsMediumPlugins();
+  });
+}
+
+void Game::publishMetadataSnapshot() {
+  publishSnapshot([this](GameSnapshot& snapshot) {
+    snapshot.groupNames.clear();
+    for (const auto& group : gameHandle_->GetDatabase().GetGroups()) {
+      snapshot.groupNames.push_back(group.GetName());
+    }
+
+    snapshot.masterlistGroups = gameHandle_->GetDatabase().GetGroups(false);
+    snapshot.userGroups = gameHandle_->GetDatabase().GetUserGroups();
+
+    snapshot.knownBashTags = gameHandle_->GetDatabase().GetKnownBashTags();
+  });
+}
+
+void Game::publishSnapshot(const std::function<void(GameSnapshot&)>& update) {
+  TraceSpan span("Game::publishSnapshot");
+
+  std::lock_guard<std::mutex> guard(publishMutex_);
+
+  try {
+    auto snapshot =
+        std::make_shared<GameSnapshot>(*std::atomic_load(&snapshot_));
+
+    update(*snapshot);
+
+    std::atomic_store(&snapshot_,
+                      std::shared_ptr<const GameSnapshot>(std::move(snapshot)));
+  } catch (const std::exception& e) {
+    // Keep the previous snapshot, it's better than nothing.
+    const auto logger = getLogger();
+    if (logger) {
+      logger->error("Failed to publish a snapshot of the game's state: {}",
+                    e.what());
+    }
+  }
+}
 }
 }
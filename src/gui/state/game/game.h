@@ -38,9 +38,12 @@
 #endif
 #endif
 
+#include <algorithm>
+#include <atomic>
 #include <execution>
 #include <filesystem>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
@@ -53,9 +56,12 @@
 #endif
 
 #include "gui/sourced_message.h"
+#include "gui/state/cancellation_token.h"
 #include "gui/state/change_count.h"
 #include "gui/state/game/game_settings.h"
+#include "gui/state/game/game_snapshot.h"
 #include "gui/state/game/load_order_backup.h"
+#include "gui/state/game/userlist_writer.h"
 #include "gui/state/logging.h"
 #include "loot/api.h"
 
@@ -104,6 +110,10 @@ public:
   void init();
   bool isInitialised() const;
 
+  // Get the most recently published snapshot of the game's state. This is safe
+  // to call while another thread is changing the game.
+  std::shared_ptr<const GameSnapshot> getSnapshot() const;
+
   std::unique_ptr<const PluginInterface> getPlugin(
       const std::string& name) const;
   std::vector<std::unique_ptr<const PluginInterface>> getPlugins() const;
@@ -129,6 +139,7 @@ public:
   std::filesystem::path getGroupNodePositionsPath() const;
   std::filesystem::path getActivePluginsFilePath() const;
   std::filesystem::path getOldMessagesPath() const;
+  std::filesystem::path getSortCachePath() const;
 
   std::vector<std::string> getLoadOrder() const;
   void setLoadOrder(const std::vector<std::string>& loadOrder);
@@ -170,7 +181,14 @@ public:
   void addUserMetadata(const PluginMetadata& metadata);
   void clearUserMetadata(const std::string& pluginName);
   void clearAllUserMetadata();
+  // The handler is called from a background thread if writing the userlist
+  // fails.
+  void setUserlistWriteErrorHandler(
+      const UserlistWriter::ErrorHandler& handler);
+  // The userlist is written in the background, use flushUserMetadata() to
+  // wait for it to be written.
   void saveUserMetadata();
+  void flushUserMetadata();
 
   std::string getLoadOrderAsTextTable() const;
   std::string getLoadOrderAsTextTable(
@@ -189,10 +207,35 @@ private:
 
   void loadCurrentLoadOrderState();
 
+  // Publish a new snapshot with its load order or metadata fields updated
+  // from the game's current state. These may be called concurrently, e.g.
+  // when plugins and metadata are loaded in parallel.
+  void publishLoadOrderSnapshot();
+  void publishMetadataSnapshot();
+  void publishSnapshot(const std::function<void(GameSnapshot&)>& update);
+
+  // Calculate a fingerprint of everything that can affect the result of
+  // sorting the given load order, or nullopt if that fails.
+  std::optional<std::string> getSortFingerprint(
+      const std::vector<std::string>& loadOrder) const;
+  std::optional<std::vector<std::string>> getCachedSortResult(
+      const std::vector<std::string>& loadOrder,
+      const std::string& fingerprint) const;
+  void cacheSortResult(const std::string& fingerprint,
+                       const std::vector<std::string>& sortedPlugins) const;
+
   GameSettings settings_;
   CreationClubPlugins creationClubPlugins_;
   std::unique_ptr<GameInterface> gameHandle_;
+  std::unique_ptr<UserlistWriter> userlistWriter_;
+  UserlistWriter::ErrorHandler userlistWriteErrorHandler_;
   std::vector<SourcedMessage> messages_;
+  // Only accessed using std::atomic_load() and std::atomic_store().
+  std::shared_ptr<const GameSnapshot> snapshot_{
+      std::make_shared<const GameSnapshot>()};
+  // Serialises publishing so that concurrent updates aren't lost. Reading the
+  // snapshot doesn't need it.
+  std::mutex publishMutex_;
   std::filesystem::path lootDataPath_;
   std::filesystem::path preludePath_;
   ChangeCount sortCount_;
@@ -212,15 +255,26 @@ std::vector<LoadOrderTuple> mapToLoadOrderTuples(
     const gui::Game& game,
     const std::vector<std::string>& loadOrder);
 
+// Once the cancellation token is cancelled, plugins that haven't been mapped
+// yet are skipped and OperationCancelledError is thrown. The progress callback
+// is given the number of plugins mapped so far and the total about once per
+// percent and when the last plugin is mapped, and may be called from several
+// threads at once.
 template<typename T>
 std::vector<T> mapFromLoadOrderData(
     const gui::Game& game,
     const std::vector<std::string>& loadOrder,
     const std::function<T(std::shared_ptr<const PluginInterface>,
                           std::optional<short>,
-                          bool)>& mapper) {
+                          bool)>& mapper,
+    const CancellationToken& cancellationToken = CancellationToken(),
+    const std::function<void(size_t, size_t)>& sendProgressUpdate = nullptr) {
   const auto data = mapToLoadOrderTuples(game, loadOrder);
 
+  const auto total = data.size();
+  const auto progressInterval = std::max(total / 100, size_t{1});
+  std::atomic<size_t> mappedCount{0};
+
   // Now perform the mapping in a second loop that can be parallelised
   // (because sometimes the mapper is slow).
   //
@@ -229,12 +283,22 @@ std::vector<T> mapFromLoadOrderData(
   // type in the variant holds the exception message string if an exception
   // is thrown by the mapper.
   typedef std::variant<T, std::string> MappedDataOrError;
-  const auto transformer = [&mapper](const LoadOrderTuple& loadOrderTuple) {
+  const auto transformer = [&](const LoadOrderTuple& loadOrderTuple) {
+    if (cancellationToken.isCancelled()) {
+      return MappedDataOrError(std::string());
+    }
+
     try {
       const auto& [plugin, activeLoadOrderIndex, isActive] = loadOrderTuple;
 
       const auto mappedData = mapper(plugin, activeLoadOrderIndex, isActive);
 
+      const auto mapped = ++mappedCount;
+      if (sendProgressUpdate &&
+          (mapped % progressInterval == 0 || mapped == total)) {
+        sendProgressUpdate(mapped, total);
+      }
+
       return MappedDataOrError(mappedData);
     } catch (const std::exception& e) {
       const auto logger = getLogger();
@@ -257,6 +321,8 @@ std::vector<T> mapFromLoadOrderData(
                  maybeMappedData.begin(),
                  transformer);
 
+  cancellationToken.throwIfCancelled();
+
   std::vector<T> mappedData;
   mappedData.reserve(maybeMappedData.size());
 
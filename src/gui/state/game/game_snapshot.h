@@ -0,0 +1,51 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_GAME_SNAPSHOT
+#define LOOT_GUI_STATE_GAME_GAME_SNAPSHOT
+
+#include <string>
+#include <vector>
+
+#include "loot/metadata/group.h"
+
+namespace loot::gui {
+// An immutable copy of the game state that the UI reads. A new snapshot is
+// published whenever that state changes, so the UI can read the latest one
+// without touching the game handle while a query is running.
+struct GameSnapshot {
+  std::vector<std::string> loadOrder;
+  size_t loadedPluginCount{0};
+  bool isLoadOrderAmbiguous{false};
+  bool supportsLightPlugins{false};
+  bool supportsMediumPlugins{false};
+  std::vector<std::string> groupNames;
+  std::vector<Group> masterlistGroups;
+  std::vector<Group> userGroups;
+  std::vector<std::string> knownBashTags;
+};
+}
+
+#endif
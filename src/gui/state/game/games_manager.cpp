@@ -26,8 +26,8 @@
 #include "gui/state/game/games_manager.h"
 
 namespace {
-bool gameNeedsRecreating(const loot::gui::Game& game,
-                         const loot::GameSettings& newSettings) {
+bool gameNeedsReinitialising(const loot::gui::Game& game,
+                             const loot::GameSettings& newSettings) {
   return game.getSettings().getGamePath() != newSettings.getGamePath() ||
          game.getSettings().getGameLocalPath() != newSettings.getGameLocalPath() ||
          game.getSettings().getMasterFilename() != newSettings.getMasterFilename();
@@ -49,12 +49,13 @@ void GamesManager::setInstalledGames(
   }
 
   std::optional<std::string> currentGameFolder;
-  if (currentGame_ != installedGames_.end()) {
+  if (currentGame_ != nullptr) {
     currentGameFolder = currentGame_->getSettings().getFolderName();
   }
 
-  bool currentGameUpdated = false;
-  std::vector<gui::Game> installedGames;
+  bool currentGameKept = false;
+  bool currentGameReinitialised = false;
+  std::vector<std::unique_ptr<gui::Game>> installedGames;
   for (const auto& gameSettings : gamesSettings) {
     if (!isInstalled(gameSettings)) {
       if (logger) {
@@ -65,53 +66,94 @@ void GamesManager::setInstalledGames(
       continue;
     }
 
-    if (currentGameFolder.has_value() &&
-        currentGameFolder.value() == gameSettings.getFolderName() &&
-        !gameNeedsRecreating(getCurrentGame(), gameSettings)) {
-      if (logger) {
-        logger->trace("Updating game entry for: {}", gameSettings.getFolderName());
+    if (!currentGameKept && currentGameFolder.has_value() &&
+        currentGameFolder.value() == gameSettings.getFolderName()) {
+      // Keep the current game object so that references to it stay valid.
+      auto currentGame = std::find_if(
+          installedGames_.begin(),
+          installedGames_.end(),
+          [&](const auto& game) { return game.get() == currentGame_; });
+
+      if (gameNeedsReinitialising(*currentGame_, gameSettings)) {
+        if (logger) {
+          logger->trace("Reinitialising game entry for: {}",
+                        gameSettings.getFolderName());
+        }
+
+        currentGame_->getSettings() = gameSettings;
+        currentGameReinitialised = true;
+      } else {
+        if (logger) {
+          logger->trace("Updating game entry for: {}",
+                        gameSettings.getFolderName());
+        }
+
+        currentGame_->getSettings()
+            .setName(gameSettings.getName())
+            .setMinimumHeaderVersion(gameSettings.getMinimumHeaderVersion())
+            .setMasterlistSource(gameSettings.getMasterlistSource());
       }
 
-      getCurrentGame()
-          .getSettings()
-          .setName(gameSettings.getName())
-          .setMinimumHeaderVersion(gameSettings.getMinimumHeaderVersion())
-          .setMasterlistSource(gameSettings.getMasterlistSource());
-
-      installedGames.push_back(std::move(getCurrentGame()));
-      currentGameUpdated = true;
+      installedGames.push_back(std::move(*currentGame));
+      currentGameKept = true;
     } else {
       if (logger) {
         logger->trace("Adding new installed game entry for: {}",
                       gameSettings.getFolderName());
       }
 
-      installedGames.push_back(
-          gui::Game(gameSettings, lootDataPath_, preludePath_));
+      installedGames.push_back(std::make_unique<gui::Game>(
+          gameSettings, lootDataPath_, preludePath_));
+      installedGames.back()->setUserlistWriteErrorHandler(
+          userlistWriteErrorHandler_);
     }
   }
+
+  // If the current game wasn't moved into the new list, it's no longer
+  // installed.
+  uninstalledCurrentGame_.reset();
+  if (currentGame_ != nullptr && !currentGameKept) {
+    for (auto& game : installedGames_) {
+      if (game.get() == currentGame_) {
+        uninstalledCurrentGame_ = std::move(game);
+      }
+    }
+  }
+
   installedGames_ = std::move(installedGames);
 
-  if (currentGameUpdated) {
-    setCurrentGame(currentGameFolder.value());
+  if (currentGameReinitialised) {
+    initialiseGameData(*currentGame_);
   } else if (currentGameFolder.has_value()) {
     setCurrentGame(currentGameFolder.value());
-    initialiseGameData(getCurrentGame());
-  } else {
-    currentGame_ = installedGames_.end();
+  }
+}
+
+void GamesManager::setUserlistWriteErrorHandler(
+    const UserlistWriter::ErrorHandler& handler) {
+  std::lock_guard<std::recursive_mutex> guard(mutex_);
+
+  userlistWriteErrorHandler_ = handler;
+
+  for (auto& game : installedGames_) {
+    game->setUserlistWriteErrorHandler(handler);
+  }
+
+  if (uninstalledCurrentGame_) {
+    uninstalledCurrentGame_->setUserlistWriteErrorHandler(handler);
   }
 }
 
 bool GamesManager::hasCurrentGame() const {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  return currentGame_ != installedGames_.end();
+  return currentGame_ != nullptr;
 }
 
 gui::Game& GamesManager::getCurrentGame() {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  if (currentGame_ == installedGames_.end()) {
+  if (currentGame_ == nullptr) {
     throw std::runtime_error("No current game to get.");
   }
 
@@ -121,7 +163,7 @@ gui::Game& GamesManager::getCurrentGame() {
 const gui::Game& GamesManager::getCurrentGame() const {
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-  if (currentGame_ == installedGames_.end()) {
+  if (currentGame_ == nullptr) {
     throw std::runtime_error("No current game to get.");
   }
 
@@ -137,14 +179,15 @@ void GamesManager::setCurrentGame(const std::string& newGameFolder) {
                   newGameFolder);
   }
 
-  currentGame_ =
+  const auto newGame =
       find_if(installedGames_.begin(),
               installedGames_.end(),
-              [&](const gui::Game& game) {
-                return newGameFolder == game.getSettings().getFolderName();
+              [&](const std::unique_ptr<gui::Game>& game) {
+                return newGameFolder == game->getSettings().getFolderName();
               });
 
-  if (currentGame_ == installedGames_.end()) {
+  if (newGame == installedGames_.end()) {
+    currentGame_ = nullptr;
     logger->error(
         "Cannot set the current game: the game with folder \"{}\" is not "
         "installed.",
@@ -153,6 +196,8 @@ void GamesManager::setCurrentGame(const std::string& newGameFolder) {
                              "\" cannot be found.");
   }
 
+  currentGame_ = newGame->get();
+
   if (logger) {
     logger->debug("New game is: {}", currentGame_->getSettings().getName());
   }
@@ -163,7 +208,7 @@ std::vector<std::string> GamesManager::getInstalledGameFolderNames() const {
 
   std::vector<std::string> installedGames;
   for (const auto& game : installedGames_) {
-    installedGames.push_back(game.getSettings().getFolderName());
+    installedGames.push_back(game->getSettings().getFolderName());
   }
 
   return installedGames;
@@ -174,7 +219,7 @@ std::optional<std::string> GamesManager::getFirstInstalledGameFolderName()
   std::lock_guard<std::recursive_mutex> guard(mutex_);
 
   if (!installedGames_.empty()) {
-    return installedGames_.front().getSettings().getFolderName();
+    return installedGames_.front()->getSettings().getFolderName();
   }
 
   return std::nullopt;
@@ -185,8 +230,8 @@ bool GamesManager::isGameInstalled(const std::string& gameFolder) const {
 
   return std::any_of(installedGames_.cbegin(),
                      installedGames_.cend(),
-                     [&](const gui::Game& game) {
-                       return gameFolder == game.getSettings().getFolderName();
+                     [&](const std::unique_ptr<gui::Game>& game) {
+                       return gameFolder == game->getSettings().getFolderName();
                      });
 }
 
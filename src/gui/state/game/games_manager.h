@@ -27,6 +27,7 @@
 #define LOOT_GUI_STATE_GAME_GAMES_MANAGER
 
 #include <filesystem>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <stdexcept>
@@ -50,9 +51,15 @@ public:
   GamesManager& operator=(const GamesManager&) = delete;
   GamesManager& operator=(GamesManager&&) = delete;
 
-  // Updates or recreates the current game as necessary.
+  // Updates the current game in place, reinitialising it if its paths have
+  // changed, so that references to it stay valid.
   void setInstalledGames(const std::vector<GameSettings>& gamesSettings);
 
+  // Sets the handler that is called from a background thread when writing a
+  // game's userlist fails.
+  void setUserlistWriteErrorHandler(
+      const UserlistWriter::ErrorHandler& handler);
+
   bool hasCurrentGame() const;
 
   gui::Game& getCurrentGame();
@@ -74,8 +81,14 @@ private:
 
   std::filesystem::path lootDataPath_;
   std::filesystem::path preludePath_;
-  std::vector<gui::Game> installedGames_;
-  std::vector<gui::Game>::iterator currentGame_{installedGames_.end()};
+  // Games are held by pointer so that references to them (e.g. held by
+  // queries) stay valid when the list of installed games changes.
+  std::vector<std::unique_ptr<gui::Game>> installedGames_;
+  gui::Game* currentGame_{nullptr};
+  // If the current game is no longer installed, it's kept alive until the
+  // list of installed games next changes, as queries may still reference it.
+  std::unique_ptr<gui::Game> uninstalledCurrentGame_;
+  UserlistWriter::ErrorHandler userlistWriteErrorHandler_;
 
   // Mutex used to protect access to member variables.
   mutable std::recursive_mutex mutex_;
@@ -40,7 +40,10 @@
 #include <boost/locale/conversion.hpp>
 #include <fstream>
 #include <regex>
+#include <set>
+#include <unordered_map>
 
+#include "gui/helpers.h"
 #include "gui/state/logging.h"
 #include "gui/translate.h"
 
@@ -58,6 +61,7 @@ namespace {
 using loot::EdgeType;
 using loot::GameId;
 using loot::LoadOrderBackup;
+using loot::writeFileAtomically;
 
 constexpr std::string_view GHOST_EXTENSION = ".ghost";
 
@@ -96,38 +100,171 @@ std::optional<std::filesystem::path> resolveGameFilePath(
   return std::nullopt;
 }
 
-void createBackup(const std::vector<std::string>& loadOrder,
-                  const std::filesystem::path& backupDirectory,
-                  std::string_view name,
-                  bool autoDelete) {
-  const auto timestamp = QDateTime::currentDateTimeUtc();
+constexpr std::string_view BACKUP_INDEX_FILENAME = "index.json";
+
+// The newest backup is always a full snapshot. When a backup is added, the
+// previous newest backup is rewritten as a delta against it where that's
+// smaller, so nothing is stored as a delta against the oldest backups and
+// pruning them doesn't involve rewriting any others. No backup is more than
+// this many deltas away from a full snapshot, so restoring a backup only needs
+// to read a few files.
+constexpr size_t MAX_DELTA_CHAIN_LENGTH = 4;
+
+constexpr std::string_view SNAPSHOT_EXTENSION = ".json";
+// Deltas use a different extension so that older versions of LOOT, which
+// can't read them, ignore them instead of listing them as empty backups.
+constexpr std::string_view DELTA_EXTENSION = ".delta";
+
+bool isLoadOrderBackupFilename(const std::string& filename) {
+  return boost::starts_with(filename, "loadorder.") &&
+         (boost::ends_with(filename, SNAPSHOT_EXTENSION) ||
+          boost::ends_with(filename, DELTA_EXTENSION));
+}
+
+bool isLoadOrderBackupDelta(const std::filesystem::path& path) {
+  return path.extension().u8string() == DELTA_EXTENSION;
+}
+
+std::filesystem::path getBackupPath(const std::filesystem::path& backupPath,
+                                    std::string_view extension) {
+  auto path = backupPath;
+  path.replace_extension(std::filesystem::u8path(extension));
+  return path;
+}
+
+// Deltas refer to their base by its filename without its extension, as the
+// base is rewritten as a delta itself when a newer backup is added. If both
+// files exist, rewriting the backup was interrupted and the full snapshot is
+// the complete one.
+std::filesystem::path resolveBackupBasePath(
+    const std::filesystem::path& backupDirectory,
+    const std::string& baseStem) {
+  const auto snapshotPath =
+      backupDirectory /
+      std::filesystem::u8path(baseStem + std::string(SNAPSHOT_EXTENSION));
+  if (std::filesystem::exists(snapshotPath)) {
+    return snapshotPath;
+  }
+
+  return getBackupPath(snapshotPath, DELTA_EXTENSION);
+}
+
+std::filesystem::path getBackupIndexPath(
+    const std::filesystem::path& backupDirectory) {
+  return backupDirectory / std::filesystem::u8path(BACKUP_INDEX_FILENAME);
+}
+
+// A delta is an array of operations that build a load order from the load
+// order of the backup it is based on. Each operation is either a
+// [start, length] array giving a range of plugins to copy from the base load
+// order, or the name of a plugin to insert. Moving a plugin therefore costs
+// an insertion plus a split copy range, and removing a plugin costs a split
+// copy range.
+QJsonArray encodeLoadOrderDelta(const std::vector<std::string>& baseLoadOrder,
+                                const std::vector<std::string>& loadOrder) {
+  std::unordered_map<std::string, size_t> baseIndices;
+  for (size_t i = 0; i < baseLoadOrder.size(); i += 1) {
+    baseIndices.emplace(baseLoadOrder[i], i);
+  }
+
+  QJsonArray delta;
+  std::optional<std::pair<size_t, size_t>> copyRange;
+  const auto endCopyRange = [&]() {
+    if (copyRange.has_value()) {
+      delta.push_back(QJsonArray{static_cast<qint64>(copyRange->first),
+                                 static_cast<qint64>(copyRange->second)});
+      copyRange.reset();
+    }
+  };
+
+  for (const auto& plugin : loadOrder) {
+    const auto it = baseIndices.find(plugin);
+    if (it == baseIndices.end()) {
+      endCopyRange();
+      delta.push_back(QString::fromStdString(plugin));
+    } else if (copyRange.has_value() &&
+               copyRange->first + copyRange->second == it->second) {
+      copyRange->second += 1;
+    } else {
+      endCopyRange();
+      copyRange = std::make_pair(it->second, 1);
+    }
+  }
+
+  endCopyRange();
+
+  return delta;
+}
+
+std::vector<std::string> decodeLoadOrderDelta(
+    const std::vector<std::string>& baseLoadOrder,
+    const QJsonArray& delta) {
+  std::vector<std::string> loadOrder;
+
+  for (const auto& operation : delta) {
+    if (operation.isString()) {
+      loadOrder.push_back(operation.toString().toStdString());
+      continue;
+    }
 
+    const auto range = operation.toArray();
+    const auto start = range.at(0).toInteger(-1);
+    const auto length = range.at(1).toInteger(-1);
+
+    if (range.size() != 2 || start < 0 || length < 0 ||
+        static_cast<size_t>(start + length) > baseLoadOrder.size()) {
+      throw std::runtime_error("Load order backup delta is invalid");
+    }
+
+    const auto begin = std::next(baseLoadOrder.begin(), start);
+    loadOrder.insert(loadOrder.end(), begin, std::next(begin, length));
+  }
+
+  return loadOrder;
+}
+
+QJsonObject createSnapshotContent(const std::vector<std::string>& loadOrder) {
   QJsonArray loadOrderArray;
   for (const auto& plugin : loadOrder) {
     loadOrderArray.push_back(QString::fromStdString(plugin));
   }
 
   QJsonObject json;
-  json["name"] = std::string(name).c_str();
-  json["creationTimestamp"] = timestamp.toString(Qt::DateFormat::ISODateWithMs);
-  json["autoDelete"] = autoDelete;
   json["loadOrder"] = loadOrderArray;
 
-  const auto filename =
-      fmt::format("loadorder.{}.json", timestamp.toMSecsSinceEpoch());
+  return json;
+}
 
-  std::filesystem::create_directories(backupDirectory);
+QJsonObject createDeltaContent(const std::filesystem::path& basePath,
+                               const QJsonArray& delta) {
+  QJsonObject json;
+  json["base"] = QString::fromStdString(basePath.stem().u8string());
+  json["delta"] = delta;
+
+  return json;
+}
+
+void writeBackupFile(const LoadOrderBackup& backup, QJsonObject content) {
+  const auto timestamp =
+      QDateTime::fromMSecsSinceEpoch(backup.unixTimestampMs).toUTC();
 
-  std::ofstream out(backupDirectory / std::filesystem::u8path(filename));
-  out << QJsonDocument(json).toJson().toStdString();
+  content["name"] = QString::fromStdString(backup.name);
+  content["creationTimestamp"] =
+      timestamp.toString(Qt::DateFormat::ISODateWithMs);
+  content["autoDelete"] = backup.autoDelete;
+  content["pluginCount"] = static_cast<qint64>(backup.pluginCount);
+
+  writeFileAtomically(
+      backup.path,
+      QJsonDocument(content).toJson(QJsonDocument::Compact).toStdString());
 }
 
 std::optional<LoadOrderBackup> readLoadOrder(const std::filesystem::path& path,
-                                             bool includePlugins) {
+                                             bool includePlugins,
+                                             size_t chainLength = 0) {
   const auto filename = path.filename().u8string();
 
-  if (!boost::starts_with(filename, "loadorder.") ||
-      !boost::ends_with(filename, ".json")) {
+  if (!isLoadOrderBackupFilename(filename)) {
     return std::nullopt;
   }
   auto file = QFile(QString::fromStdString(path.u8string()));
@@ -140,7 +277,7 @@ std::optional<LoadOrderBackup> readLoadOrder(const std::filesystem::path& path,
   const auto name = json.value("name").toString();
   const auto timestamp = json.value("creationTimestamp").toString();
   const auto autoDelete = json.value("autoDelete").toBool();
-  const auto loadOrder = json.value("loadOrder").toArray();
+  const auto base = json.value("base").toString().toStdString();
 
   if (name.isEmpty() || timestamp.isEmpty()) {
     return std::nullopt;
@@ -154,47 +291,384 @@ std::optional<LoadOrderBackup> readLoadOrder(const std::filesystem::path& path,
           .toMSecsSinceEpoch();
   backup.autoDelete = autoDelete;
 
-  if (includePlugins) {
-    for (const auto& entry : loadOrder) {
+  if (base.empty()) {
+    // Full snapshots are also how backups were written by older versions of
+    // LOOT, which didn't record a plugin count.
+    for (const auto& entry : json.value("loadOrder").toArray()) {
       const auto pluginName = entry.toString();
       if (!pluginName.isEmpty()) {
-        backup.loadOrder.push_back(pluginName.toStdString());
+        backup.pluginCount += 1;
+
+        if (includePlugins) {
+          backup.loadOrder.push_back(pluginName.toStdString());
+        }
+      }
+    }
+
+    return backup;
+  }
+
+  if (!isLoadOrderBackupFilename(base + std::string(SNAPSHOT_EXTENSION))) {
+    return std::nullopt;
+  }
+
+  backup.basePath = resolveBackupBasePath(path.parent_path(), base);
+  backup.pluginCount =
+      static_cast<size_t>(json.value("pluginCount").toInteger());
+
+  if (includePlugins) {
+    if (chainLength >= MAX_DELTA_CHAIN_LENGTH) {
+      throw std::runtime_error("The load order backup at " + path.u8string() +
+                               " has too many bases");
+    }
+
+    const auto baseBackup =
+        readLoadOrder(backup.basePath, true, chainLength + 1);
+    if (!baseBackup.has_value()) {
+      throw std::runtime_error("The base of the load order backup at " +
+                               path.u8string() + " is not valid");
+    }
+
+    backup.loadOrder = decodeLoadOrderDelta(baseBackup.value().loadOrder,
+                                            json.value("delta").toArray());
+  }
+
+  return backup;
+}
+
+// Get the largest number of deltas between the given backup and the backups
+// that are stored as deltas against it, directly or through other deltas.
+size_t getLongestDeltaChainTo(const LoadOrderBackup& base,
+                              const std::vector<LoadOrderBackup>& backups) {
+  size_t longest = 0;
+
+  for (const auto& backup : backups) {
+    size_t length = 0;
+    auto basePath = backup.basePath;
+
+    while (!basePath.empty() && length < MAX_DELTA_CHAIN_LENGTH) {
+      length += 1;
+
+      if (basePath == base.path) {
+        longest = std::max(longest, length);
+        break;
+      }
+
+      const auto it = std::find_if(
+          backups.begin(), backups.end(), [&](const LoadOrderBackup& other) {
+            return other.path == basePath;
+          });
+
+      if (it == backups.end()) {
+        break;
       }
+
+      basePath = it->basePath;
+    }
+  }
+
+  return longest;
+}
+
+// Replace the given backup's file with the given file, which has already been
+// written, and update the backups that refer to it.
+void moveBackup(LoadOrderBackup& backup,
+                const std::filesystem::path& newPath,
+                std::vector<LoadOrderBackup>& backups) {
+  if (newPath == backup.path) {
+    return;
+  }
+
+  std::filesystem::remove(backup.path);
+
+  for (auto& other : backups) {
+    if (other.basePath == backup.path) {
+      other.basePath = newPath;
     }
   }
 
+  backup.path = newPath;
+}
+
+// Rewrite the given full snapshot as a delta against the given newer backup,
+// if doing so is possible and worthwhile.
+void storeAsDelta(LoadOrderBackup& backup,
+                  const LoadOrderBackup& newerBackup,
+                  const std::vector<std::string>& newerLoadOrder,
+                  std::vector<LoadOrderBackup>& backups) {
+  if (!backup.basePath.empty() ||
+      getLongestDeltaChainTo(backup, backups) >= MAX_DELTA_CHAIN_LENGTH) {
+    return;
+  }
+
+  try {
+    const auto snapshot = readLoadOrder(backup.path, true);
+    if (!snapshot.has_value()) {
+      return;
+    }
+
+    const auto& loadOrder = snapshot.value().loadOrder;
+    const auto delta = encodeLoadOrderDelta(newerLoadOrder, loadOrder);
+
+    // Beyond this size a delta saves too little to be worth reading its base.
+    if (static_cast<size_t>(delta.size()) * 2 >= loadOrder.size()) {
+      return;
+    }
+
+    auto deltaBackup = backup;
+    deltaBackup.path = getBackupPath(backup.path, DELTA_EXTENSION);
+    writeBackupFile(deltaBackup, createDeltaContent(newerBackup.path, delta));
+
+    moveBackup(backup, deltaBackup.path, backups);
+    backup.basePath = newerBackup.path;
+  } catch (const std::exception& e) {
+    const auto logger = loot::getLogger();
+    if (logger) {
+      logger->warn(
+          "Failed to store the load order backup at {} as a delta, keeping "
+          "it as a full snapshot: {}",
+          backup.path.u8string(),
+          e.what());
+    }
+  }
+}
+
+LoadOrderBackup createBackup(const std::vector<std::string>& loadOrder,
+                             const std::filesystem::path& backupDirectory,
+                             std::string_view name,
+                             bool autoDelete) {
+  const auto timestamp = QDateTime::currentDateTimeUtc();
+
+  const auto filename = fmt::format("loadorder.{}{}",
+                                    timestamp.toMSecsSinceEpoch(),
+                                    SNAPSHOT_EXTENSION);
+
+  std::filesystem::create_directories(backupDirectory);
+
+  LoadOrderBackup backup;
+  backup.path = backupDirectory / std::filesystem::u8path(filename);
+  backup.name = name;
+  backup.unixTimestampMs = timestamp.toMSecsSinceEpoch();
+  backup.autoDelete = autoDelete;
+  backup.pluginCount = loadOrder.size();
+
+  writeBackupFile(backup, createSnapshotContent(loadOrder));
+
   return backup;
 }
 
-std::vector<LoadOrderBackup> findLoadOrderBackups(
+// The index holds everything about each backup except its load order, so that
+// backups can be listed and pruned without reading every backup file.
+std::optional<std::vector<LoadOrderBackup>> readBackupIndex(
     const std::filesystem::path& backupDirectory) {
+  const auto indexPath = getBackupIndexPath(backupDirectory);
+  if (!std::filesystem::exists(indexPath)) {
+    return std::nullopt;
+  }
+
+  auto file = QFile(QString::fromStdString(indexPath.u8string()));
+
+  file.open(QIODevice::ReadOnly | QIODevice::Text);
+  const auto content = file.readAll();
+  file.close();
+
+  const auto json = QJsonDocument::fromJson(content);
+  if (!json.isArray()) {
+    return std::nullopt;
+  }
+
   std::vector<LoadOrderBackup> backups;
+  for (const auto& value : json.array()) {
+    const auto entry = value.toObject();
+    const auto filename = entry.value("file").toString().toStdString();
+    const auto name = entry.value("name").toString();
+
+    if (!isLoadOrderBackupFilename(filename) || name.isEmpty()) {
+      return std::nullopt;
+    }
+
+    LoadOrderBackup backup;
+    backup.path = backupDirectory / std::filesystem::u8path(filename);
+    backup.name = name.toStdString();
+    backup.unixTimestampMs = entry.value("creationTimestamp").toInteger();
+    backup.autoDelete = entry.value("autoDelete").toBool();
+    backup.pluginCount =
+        static_cast<size_t>(entry.value("pluginCount").toInteger());
+
+    const auto base = entry.value("base").toString().toStdString();
+    if (!base.empty()) {
+      backup.basePath = backupDirectory / std::filesystem::u8path(base);
+    }
 
+    backups.push_back(backup);
+  }
+
+  return backups;
+}
+
+void writeBackupIndex(const std::filesystem::path& backupDirectory,
+                      const std::vector<LoadOrderBackup>& backups) {
+  QJsonArray array;
+  for (const auto& backup : backups) {
+    QJsonObject entry;
+    entry["file"] = QString::fromStdString(backup.path.filename().u8string());
+    entry["name"] = QString::fromStdString(backup.name);
+    entry["creationTimestamp"] = static_cast<qint64>(backup.unixTimestampMs);
+    entry["autoDelete"] = backup.autoDelete;
+    entry["pluginCount"] = static_cast<qint64>(backup.pluginCount);
+
+    if (!backup.basePath.empty()) {
+      entry["base"] =
+          QString::fromStdString(backup.basePath.filename().u8string());
+    }
+
+    array.push_back(entry);
+  }
+
+  std::filesystem::create_directories(backupDirectory);
+
+  writeFileAtomically(
+      getBackupIndexPath(backupDirectory),
+      QJsonDocument(array).toJson(QJsonDocument::Compact).toStdString());
+}
+
+// Read the backup index, bringing it up to date with the backup files that
+// exist, so that backups created by older versions of LOOT or deleted
+// outside of LOOT are accounted for. Only backup files that are missing from
+// the index are read.
+std::vector<LoadOrderBackup> loadBackupIndex(
+    const std::filesystem::path& backupDirectory) {
   if (!std::filesystem::exists(backupDirectory)) {
-    return backups;
+    return {};
   }
 
+  std::set<std::string> filenames;
   for (const auto& entry :
        std::filesystem::directory_iterator(backupDirectory)) {
-    const auto loadOrder = readLoadOrder(entry.path(), true);
+    const auto filename = entry.path().filename().u8string();
+    if (!isLoadOrderBackupFilename(filename)) {
+      continue;
+    }
 
-    if (loadOrder.has_value()) {
-      backups.push_back(loadOrder.value());
+    // If both a delta and a full snapshot exist for a backup, rewriting it
+    // was interrupted, and the full snapshot is the complete one.
+    if (isLoadOrderBackupDelta(entry.path()) &&
+        std::filesystem::exists(
+            getBackupPath(entry.path(), SNAPSHOT_EXTENSION))) {
+      continue;
+    }
+
+    filenames.insert(filename);
+  }
+
+  const auto indexedBackups = readBackupIndex(backupDirectory);
+  auto isIndexOutdated = !indexedBackups.has_value();
+
+  std::vector<LoadOrderBackup> backups;
+  if (indexedBackups.has_value()) {
+    for (const auto& backup : indexedBackups.value()) {
+      if (filenames.erase(backup.path.filename().u8string()) > 0) {
+        backups.push_back(backup);
+      } else {
+        isIndexOutdated = true;
+      }
+    }
+  }
+
+  for (const auto& filename : filenames) {
+    const auto backup = readLoadOrder(
+        backupDirectory / std::filesystem::u8path(filename), false);
+    if (backup.has_value()) {
+      backups.push_back(backup.value());
+      isIndexOutdated = true;
+    }
+  }
+
+  if (isIndexOutdated) {
+    try {
+      writeBackupIndex(backupDirectory, backups);
+    } catch (const std::exception& e) {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error("Failed to update the load order backup index: {}",
+                      e.what());
+      }
     }
   }
 
   return backups;
 }
 
-void removeOldBackups(const std::filesystem::path& backupDirectory) {
-  using std::filesystem::u8path;
+// Remove a backup file, first rewriting any backups that are stored as deltas
+// against it as full snapshots. As only older backups are stored as deltas,
+// pruning the oldest backups rarely involves any rewriting. If any of them
+// can't be rewritten, the backup is kept so that they remain restorable, and
+// false is returned.
+bool removeBackup(const std::filesystem::path& backupPath,
+                  std::vector<LoadOrderBackup>& backups) {
+  auto rewroteAllDependents = true;
+  for (auto& backup : backups) {
+    if (backup.basePath != backupPath) {
+      continue;
+    }
 
-  constexpr size_t MAX_BACKUPS = 10;
+    try {
+      const auto dependent = readLoadOrder(backup.path, true);
+      if (!dependent.has_value()) {
+        throw std::runtime_error("the backup is not valid");
+      }
 
-  if (!std::filesystem::exists(backupDirectory)) {
-    return;
+      auto snapshotBackup = backup;
+      snapshotBackup.path = getBackupPath(backup.path, SNAPSHOT_EXTENSION);
+      writeBackupFile(snapshotBackup,
+                      createSnapshotContent(dependent.value().loadOrder));
+
+      moveBackup(backup, snapshotBackup.path, backups);
+      backup.basePath.clear();
+    } catch (const std::exception& e) {
+      const auto logger = loot::getLogger();
+      if (logger) {
+        logger->error(
+            "Failed to rewrite the load order backup at {} as a full "
+            "snapshot: {}",
+            backup.path.u8string(),
+            e.what());
+      }
+
+      rewroteAllDependents = false;
+    }
   }
 
+  if (!rewroteAllDependents) {
+    const auto logger = loot::getLogger();
+    if (logger) {
+      logger->error(
+          "Not removing the load order backup at {} as other backups still "
+          "depend on it",
+          backupPath.u8string());
+    }
+
+    return false;
+  }
+
+  std::filesystem::remove(backupPath);
+
+  backups.erase(std::remove_if(backups.begin(),
+                               backups.end(),
+                               [&](const LoadOrderBackup& backup) {
+                                 return backup.path == backupPath;
+                               }),
+                backups.end());
+
+  return true;
+}
+
+void removeOldBackups(const std::filesystem::path& backupDirectory,
+                      std::vector<LoadOrderBackup>& backups) {
+  using std::filesystem::u8path;
+
+  constexpr size_t MAX_BACKUPS = 10;
+
   std::map<int64_t, std::filesystem::path> backupFiles;
 
   // Remove backups that use the old naming scheme first.
@@ -212,23 +686,47 @@ void removeOldBackups(const std::filesystem::path& backupDirectory) {
     backupFiles.emplace(INT64_MIN + 2, oldBak0);
   }
 
-  for (const auto& entry :
-       std::filesystem::directory_iterator(backupDirectory)) {
-    const auto loadOrder = readLoadOrder(entry.path(), false);
-
-    if (loadOrder.has_value() && loadOrder.value().autoDelete) {
-      backupFiles.emplace(loadOrder.value().unixTimestampMs, entry.path());
+  for (const auto& backup : backups) {
+    if (backup.autoDelete) {
+      backupFiles.emplace(backup.unixTimestampMs, backup.path);
     }
   }
 
   while (backupFiles.size() > MAX_BACKUPS) {
     const auto node = backupFiles.extract(backupFiles.begin());
     if (!node.empty()) {
-      std::filesystem::remove(node.mapped());
+      removeBackup(node.mapped(), backups);
     }
   }
 }
 
+void addBackup(const std::vector<std::string>& loadOrder,
+               const std::filesystem::path& backupDirectory,
+               std::string_view name,
+               bool autoDelete) {
+  auto backups = loadBackupIndex(backupDirectory);
+
+  const auto backup =
+      createBackup(loadOrder, backupDirectory, name, autoDelete);
+
+  const auto previous = std::max_element(
+      backups.begin(),
+      backups.end(),
+      [](const LoadOrderBackup& lhs, const LoadOrderBackup& rhs) {
+        return lhs.unixTimestampMs < rhs.unixTimestampMs;
+      });
+
+  if (previous != backups.end() && previous->path != backup.path) {
+    storeAsDelta(*previous, backup, loadOrder, backups);
+  }
+
+  backups.push_back(backup);
+
+  removeOldBackups(backupDirectory, backups);
+
+  writeBackupIndex(backupDirectory, backups);
+}
+
 std::string describeEdgeType(const EdgeType edgeType) {
   switch (edgeType) {
     case EdgeType::hardcoded:
@@ -266,23 +764,101 @@ std::string describeEdgeType(const EdgeType edgeType) {
 namespace loot {
 void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory) {
-  createBackup(loadOrder,
-               backupDirectory,
-               translate("Automatic Load Order Backup"),
-               true);
-  removeOldBackups(backupDirectory);
+  addBackup(loadOrder,
+            backupDirectory,
+            translate("Automatic Load Order Backup"),
+            true);
 }
 
 void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory,
                      std::string_view name) {
-  createBackup(loadOrder, backupDirectory, name, false);
-  removeOldBackups(backupDirectory);
+  addBackup(loadOrder, backupDirectory, name, false);
 }
 
 std::vector<LoadOrderBackup> findLoadOrderBackups(
     const std::filesystem::path& backupDirectory) {
-  return ::findLoadOrderBackups(backupDirectory);
+  return loadBackupIndex(backupDirectory);
+}
+
+std::vector<std::string> readLoadOrderBackup(
+    const std::filesystem::path& backupPath) {
+  const auto backup = readLoadOrder(backupPath, true);
+  if (!backup.has_value()) {
+    throw std::runtime_error(backupPath.u8string() +
+                             " is not a valid load order backup");
+  }
+
+  return backup.value().loadOrder;
+}
+
+void deleteLoadOrderBackup(const std::filesystem::path& backupPath) {
+  const auto backupDirectory = backupPath.parent_path();
+  auto backups = loadBackupIndex(backupDirectory);
+
+  const auto removed = removeBackup(backupPath, backups);
+
+  // Record any backups that were rewritten as full snapshots even if the
+  // backup couldn't be removed.
+  writeBackupIndex(backupDirectory, backups);
+
+  if (!removed) {
+    throw std::runtime_error(
+        "Could not delete the load order backup at " + backupPath.u8string() +
+        " because other backups depend on it");
+  }
+}
+
+std::optional<std::vector<std::string>> readCachedSortResult(
+    const std::filesystem::path& cachePath,
+    std::string_view fingerprint) {
+  if (!std::filesystem::exists(cachePath)) {
+    return std::nullopt;
+  }
+
+  auto file = QFile(QString::fromStdString(cachePath.u8string()));
+
+  file.open(QIODevice::ReadOnly | QIODevice::Text);
+  const auto content = file.readAll();
+  file.close();
+
+  const auto json = QJsonDocument::fromJson(content).object();
+  const auto cachedFingerprint = json.value("fingerprint").toString();
+  const auto loadOrder = json.value("loadOrder").toArray();
+
+  if (cachedFingerprint.toStdString() != fingerprint || loadOrder.isEmpty()) {
+    return std::nullopt;
+  }
+
+  std::vector<std::string> sortedLoadOrder;
+  for (const auto& entry : loadOrder) {
+    const auto pluginName = entry.toString();
+    if (pluginName.isEmpty()) {
+      return std::nullopt;
+    }
+
+    sortedLoadOrder.push_back(pluginName.toStdString());
+  }
+
+  return sortedLoadOrder;
+}
+
+void writeCachedSortResult(const std::filesystem::path& cachePath,
+                           std::string_view fingerprint,
+                           const std::vector<std::string>& sortedLoadOrder) {
+  QJsonArray loadOrderArray;
+  for (const auto& plugin : sortedLoadOrder) {
+    loadOrderArray.push_back(QString::fromStdString(plugin));
+  }
+
+  QJsonObject json;
+  json["fingerprint"] = std::string(fingerprint).c_str();
+  json["loadOrder"] = loadOrderArray;
+
+  std::filesystem::create_directories(cachePath.parent_path());
+
+  // An interrupted write must not leave a truncated cache behind.
+  writeFileAtomically(cachePath, QJsonDocument(json).toJson().toStdString());
 }
 
 std::string escapeMarkdownASCIIPunctuation(const std::string& text) {
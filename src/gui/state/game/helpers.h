@@ -33,6 +33,8 @@
 #include <loot/vertex.h>
 
 #include <filesystem>
+#include <optional>
+#include <string_view>
 #include <tuple>
 #include <vector>
 
@@ -48,9 +50,26 @@ void backupLoadOrder(const std::vector<std::string>& loadOrder,
                      const std::filesystem::path& backupDirectory,
                      std::string_view name);
 
+// Find the backups in the given directory. Their load orders are not read,
+// use readLoadOrderBackup() to do that.
 std::vector<LoadOrderBackup> findLoadOrderBackups(
     const std::filesystem::path& backupDirectory);
 
+std::vector<std::string> readLoadOrderBackup(
+    const std::filesystem::path& backupPath);
+
+void deleteLoadOrderBackup(const std::filesystem::path& backupPath);
+
+// Returns the sorted load order stored in the given cache file, if the file
+// exists and was written with the given fingerprint of the sort's inputs.
+std::optional<std::vector<std::string>> readCachedSortResult(
+    const std::filesystem::path& cachePath,
+    std::string_view fingerprint);
+
+void writeCachedSortResult(const std::filesystem::path& cachePath,
+                           std::string_view fingerprint,
+                           const std::vector<std::string>& sortedLoadOrder);
+
 // Escape any Markdown special characters in the input text.
 std::string escapeMarkdownASCIIPunctuation(const std::string& text);
 
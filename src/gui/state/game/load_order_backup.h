@@ -36,6 +36,11 @@ struct LoadOrderBackup {
   std::string name;
   int64_t unixTimestampMs{0};
   bool autoDelete{false};
+  size_t pluginCount{0};
+  // Empty if the backup is a full snapshot, otherwise the path of the backup
+  // that this backup's load order is stored as a delta against.
+  std::filesystem::path basePath;
+  // May be empty if the backup's load order hasn't been read.
   std::vector<std::string> loadOrder;
 };
 }
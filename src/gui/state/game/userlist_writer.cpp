@@ -0,0 +1,135 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#include "gui/state/game/userlist_writer.h"
+
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include "gui/helpers.h"
+#include "gui/state/logging.h"
+
+namespace loot {
+UserlistWriter::UserlistWriter(const std::filesystem::path& userlistPath,
+                               std::chrono::milliseconds coalescingDelay) :
+    userlistPath_(userlistPath),
+    coalescingDelay_(coalescingDelay),
+    thread_([this]() { run(); }) {}
+
+UserlistWriter::~UserlistWriter() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  condition_.notify_all();
+
+  thread_.join();
+}
+
+void UserlistWriter::setErrorHandler(ErrorHandler handler) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  errorHandler_ = std::move(handler);
+}
+
+void UserlistWriter::requestWrite(std::string content) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    content_ = std::move(content);
+    requestedWrites_ += 1;
+  }
+  condition_.notify_all();
+}
+
+void UserlistWriter::flush() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  const auto target = requestedWrites_;
+  flushWaiters_ += 1;
+  condition_.notify_all();
+
+  condition_.wait(lock, [&]() { return completedWrites_ >= target; });
+  flushWaiters_ -= 1;
+}
+
+void UserlistWriter::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  while (true) {
+    condition_.wait(lock, [&]() {
+      return stopping_ || requestedWrites_ != completedWrites_;
+    });
+
+    if (requestedWrites_ == completedWrites_) {
+      // Stopping with nothing left to write.
+      return;
+    }
+
+    // Give any further edits a chance to be made so that they can share this
+    // write, unless something is waiting for the write to complete.
+    condition_.wait_for(lock, coalescingDelay_, [&]() {
+      return stopping_ || flushWaiters_ > 0;
+    });
+
+    const auto target = requestedWrites_;
+    const auto content = std::move(content_);
+    content_.clear();
+    lock.unlock();
+
+    std::optional<std::string> error;
+    try {
+      write(content);
+    } catch (const std::exception& e) {
+      const auto logger = getLogger();
+      if (logger) {
+        logger->error("Failed to write the userlist at {}: {}",
+                      userlistPath_.u8string(),
+                      e.what());
+      }
+      error = e.what();
+    }
+
+    lock.lock();
+
+    // The handler is called while holding the lock so that it can't be
+    // called after it has been replaced.
+    if (error.has_value() && errorHandler_) {
+      errorHandler_(error.value());
+    }
+
+    completedWrites_ = target;
+    condition_.notify_all();
+  }
+}
+
+void UserlistWriter::write(const std::string& content) const {
+  const auto logger = getLogger();
+  if (logger) {
+    logger->trace("Writing the userlist to {}", userlistPath_.u8string());
+  }
+
+  writeFileAtomically(userlistPath_, content);
+}
+}
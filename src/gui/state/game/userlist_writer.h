@@ -0,0 +1,93 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_GUI_STATE_GAME_USERLIST_WRITER
+#define LOOT_GUI_STATE_GAME_USERLIST_WRITER
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace loot {
+// Writes a userlist on a background thread, so that saving user metadata
+// doesn't block the caller. Writes that are requested in quick succession are
+// coalesced into a single write of the most recently requested content, and
+// each write replaces the userlist atomically by writing to a temporary file
+// and then renaming it.
+class UserlistWriter {
+public:
+  typedef std::function<void(const std::string&)> ErrorHandler;
+
+  explicit UserlistWriter(const std::filesystem::path& userlistPath,
+                          std::chrono::milliseconds coalescingDelay =
+                              std::chrono::milliseconds(100));
+  UserlistWriter(const UserlistWriter&) = delete;
+  UserlistWriter(UserlistWriter&&) = delete;
+
+  // Waits for any requested writes to complete.
+  ~UserlistWriter();
+
+  UserlistWriter& operator=(const UserlistWriter&) = delete;
+  UserlistWriter& operator=(UserlistWriter&&) = delete;
+
+  // The handler is called on the writer's thread with a description of each
+  // write that fails, including writes made while the writer is destroyed.
+  // Once this returns, the previous handler will not be called again.
+  void setErrorHandler(ErrorHandler handler);
+
+  void requestWrite(std::string content);
+
+  // Blocks until all the writes requested before this was called have
+  // completed.
+  void flush();
+
+private:
+  void run();
+  void write(const std::string& content) const;
+
+  std::filesystem::path userlistPath_;
+  std::chrono::milliseconds coalescingDelay_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  std::string content_;
+  uint64_t requestedWrites_{0};
+  uint64_t completedWrites_{0};
+  unsigned int flushWaiters_{0};
+  bool stopping_{false};
+  ErrorHandler errorHandler_;
+
+  // Declared last so that the thread starts after everything else has been
+  // initialised.
+  std::thread thread_;
+};
+}
+
+#endif
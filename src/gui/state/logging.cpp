@@ -25,10 +25,13 @@
 
 #include "gui/state/logging.h"
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/stdout_sinks.h>
 
 #include <boost/algorithm/string/replace.hpp>
+#include <chrono>
+#include <memory>
 #include <optional>
 
 #include "gui/helpers.h"
@@ -49,6 +52,20 @@
 namespace {
 static constexpr const char* LOGGER_NAME = "loot_logger";
 
+// The number of log messages that can be queued for the background writer
+// thread before logging calls block until there's space.
+static constexpr size_t LOG_QUEUE_SIZE = 8192;
+
+// How often the background writer flushes the log file, for messages that are
+// not severe enough to be flushed immediately.
+static constexpr std::chrono::seconds LOG_FLUSH_INTERVAL =
+    std::chrono::seconds(1);
+
+// Cache the logger so that getLogger() doesn't need to look it up in spdlog's
+// registry (which involves locking a global mutex) every time it's called.
+// Access is through std::atomic_load() and std::atomic_store().
+std::shared_ptr<spdlog::logger> cachedLogger;
+
 std::vector<std::pair<std::string, std::string>> getStringsToCensor() {
   const auto userProfilePath = loot::getUserProfilePath();
 
@@ -62,6 +79,9 @@ std::vector<std::pair<std::string, std::string>> getStringsToCensor() {
 
 namespace loot {
 
+// When used with an async logger, this sink's log() is called on the
+// logger's background thread, so censoring doesn't slow down the thread that
+// logged the message.
 class CensoringFileSink : public spdlog::sinks::sink {
 public:
   CensoringFileSink(
@@ -121,7 +141,12 @@ private:
 };
 
 std::shared_ptr<spdlog::logger> getLogger() {
-  auto logger = spdlog::get(LOGGER_NAME);
+  auto logger = std::atomic_load(&cachedLogger);
+  if (logger) {
+    return logger;
+  }
+
+  logger = spdlog::get(LOGGER_NAME);
 
   if (!logger) {
     spdlog::set_pattern("[%T.%f] [%l]: %v");
@@ -136,12 +161,15 @@ std::shared_ptr<spdlog::logger> getLogger() {
     }
   }
 
+  std::atomic_store(&cachedLogger, logger);
+
   return logger;
 }
 
 void setLogPath(const std::filesystem::path& outputFile) {
   spdlog::set_pattern("[%T.%f] [%l]: %v");
 
+  std::atomic_store(&cachedLogger, std::shared_ptr<spdlog::logger>());
   spdlog::drop(LOGGER_NAME);
 
 #if defined(_WIN32)
@@ -151,13 +179,37 @@ void setLogPath(const std::filesystem::path& outputFile) {
 #endif
   const auto stringsToCensor = getStringsToCensor();
 
-  auto logger = spdlog::synchronous_factory::create<CensoringFileSink>(
-      LOGGER_NAME, platformFilePath, stringsToCensor);
+  // Log messages are formatted, censored and written to the file on a single
+  // background thread so that logging (especially debug logging) doesn't
+  // slow down the threads doing the actual work. If the queue fills up,
+  // logging blocks instead of discarding messages. The pool is shared by
+  // every async logger, so only create it once: replacing it would leave
+  // loggers that are still in use holding the old pool.
+  if (!spdlog::thread_pool()) {
+    spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+  }
+
+  std::shared_ptr<spdlog::logger> logger =
+      spdlog::async_factory::create<CensoringFileSink>(
+          LOGGER_NAME, platformFilePath, stringsToCensor);
 
   if (!logger) {
     throw std::runtime_error("Error: Could not initialise logging.");
   }
-  logger->flush_on(spdlog::level::trace);
+
+  // Flush immediately for warnings and errors so that they're not lost if
+  // LOOT crashes, and periodically otherwise.
+  logger->flush_on(spdlog::level::warn);
+  spdlog::flush_every(LOG_FLUSH_INTERVAL);
+
+  std::atomic_store(&cachedLogger, logger);
+}
+
+void shutDownLogging() {
+  std::atomic_store(&cachedLogger, std::shared_ptr<spdlog::logger>());
+
+  // This writes any queued messages and stops the background threads.
+  spdlog::shutdown();
 }
 
 void enableDebugLogging(bool enable) {
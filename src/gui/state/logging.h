@@ -42,6 +42,11 @@ std::shared_ptr<spdlog::logger> getLogger();
 
 void setLogPath(const std::filesystem::path& outputFile);
 
+// Writes out any buffered log messages and stops logging. This must be called
+// before main() returns, as the background logging thread can't be stopped
+// safely during static destruction.
+void shutDownLogging();
+
 void enableDebugLogging(bool enable);
 }
 
@@ -76,4 +76,8 @@ std::filesystem::path LootPaths::getLogPath() const {
 std::filesystem::path LootPaths::getPreludePath() const {
   return lootDataPath_ / "prelude" / "prelude.yaml";
 }
+
+std::filesystem::path LootPaths::getGameDetectionCachePath() const {
+  return lootDataPath_ / "game_detection_cache.json";
+}
 }
@@ -41,6 +41,7 @@ public:
   std::filesystem::path getThemesPath() const;
   std::filesystem::path getLogPath() const;
   std::filesystem::path getPreludePath() const;
+  std::filesystem::path getGameDetectionCachePath() const;
 
 private:
   std::filesystem::path lootDocsPath_;
@@ -41,12 +41,14 @@
 #include <fmt/base.h>
 
 #include <boost/locale/generator.hpp>
+#include <future>
 
 #include "gui/helpers.h"
 #include "gui/state/game/detection.h"
 #include "gui/state/game/helpers.h"
 #include "gui/state/logging.h"
 #include "gui/state/loot_paths.h"
+#include "gui/state/tracing.h"
 #include "gui/translate.h"
 #include "loot/api.h"
 
@@ -115,23 +117,46 @@ LootState::LootState(LootPaths&& paths) :
   enableDebugLogging(true);
 }
 
-void LootState::init(const std::string& cmdLineGame,
-                     const std::filesystem::path& cmdLineGamePath,
-                     bool autoSort) {
+void LootState::initSettings(const std::string& cmdLineGame, bool autoSort) {
   loadSettings(cmdLineGame, autoSort);
 
-  // Check settings after handling translations so that any messages
-  // are correctly translated.
-  checkSettingsFile();
-
-  // Find Xbox gaming root paths for detection of games installed through the
-  // Microsoft Store / Xbox app.
-  findXboxGamingRootPaths();
-
   preferredUILanguages_ = getPreferredUILanguages();
   if (preferredUILanguages_.empty() && settings_.getLanguage().size() > 1) {
     preferredUILanguages_ = {settings_.getLanguage()};
   }
+}
+
+void LootState::initGames(const std::string& cmdLineGame,
+                          const std::filesystem::path& cmdLineGamePath) {
+  TraceSpan span("LootState::initGames");
+
+  // Finding Xbox gaming root paths (for detection of games installed through
+  // the Microsoft Store / Xbox app) and scanning game stores don't depend on
+  // the steps below, so run them in the background in the meantime.
+  auto xboxGamingRootPaths = std::async(
+      std::launch::async, [this]() { return findXboxGamingRootPaths(); });
+
+  // If the stores have been scanned before, use the cached results so that
+  // startup doesn't wait for them to be revalidated. The revalidation runs in
+  // the background, see waitForStoreRevalidation().
+  const auto cachePath = paths_.getGameDetectionCachePath();
+  const auto cachedStoreInstalls = readCachedGameStores(cachePath);
+  std::future<StoreGameInstalls> storeInstalls;
+  if (cachedStoreInstalls.has_value()) {
+    storeRevalidation_ = std::async(std::launch::async,
+                                    rescanChangedGameStores,
+                                    cachePath,
+                                    preferredUILanguages_);
+  } else {
+    storeInstalls = std::async(std::launch::async,
+                               scanGameStores,
+                               cachePath,
+                               preferredUILanguages_);
+  }
+
+  // Check settings after handling translations so that any messages
+  // are correctly translated.
+  checkSettingsFile();
 
   // Check if the prelude directory exists and create it if not.
   createPreludeDirectory();
@@ -142,8 +167,13 @@ void LootState::init(const std::string& cmdLineGame,
   // Detect games & select startup game
   //-----------------------------------
 
+  xboxGamingRootPaths_ = xboxGamingRootPaths.get();
+
   // Detect installed games.
-  const auto gameSettings = loadInstalledGames(settings_.getGameSettings());
+  const auto gameSettings = loadInstalledGames(
+      settings_.getGameSettings(),
+      cachedStoreInstalls.has_value() ? cachedStoreInstalls.value()
+                                      : storeInstalls.get());
 
   settings_.storeGameSettings(gameSettings);
 
@@ -173,8 +203,50 @@ void LootState::initCurrentGame() {
 
 std::vector<GameSettings> LootState::loadInstalledGames(
     const std::vector<GameSettings>& gamesSettings) {
-  auto allGamesSettings = findInstalledGames(
-      gamesSettings, xboxGamingRootPaths_, preferredUILanguages_);
+  // Revalidating the cached store scan results is cheap, so do it every time.
+  return loadInstalledGames(
+      gamesSettings,
+      scanGameStores(paths_.getGameDetectionCachePath(),
+                     preferredUILanguages_));
+}
+
+std::optional<StoreGameInstalls> LootState::waitForStoreRevalidation() {
+  if (!storeRevalidation_.valid()) {
+    return std::nullopt;
+  }
+
+  TraceSpan span("LootState::waitForStoreRevalidation");
+
+  const auto storeInstalls = storeRevalidation_.get();
+
+  const auto logger = getLogger();
+  if (logger) {
+    if (storeInstalls.has_value()) {
+      logger->info(
+          "Game stores have changed since they were last scanned, detecting "
+          "installed games again.");
+    } else {
+      logger->debug("Cached game store scan results are still valid.");
+    }
+  }
+
+  return storeInstalls;
+}
+
+void LootState::updateInstalledGames(const StoreGameInstalls& storeInstalls) {
+  const auto gameSettings =
+      loadInstalledGames(settings_.getGameSettings(), storeInstalls);
+
+  settings_.storeGameSettings(gameSettings);
+}
+
+std::vector<GameSettings> LootState::loadInstalledGames(
+    const std::vector<GameSettings>& gamesSettings,
+    const StoreGameInstalls& storeInstalls) {
+  auto allGamesSettings = findInstalledGames(gamesSettings,
+                                             storeInstalls,
+                                             xboxGamingRootPaths_,
+                                             preferredUILanguages_);
 
   setInstalledGames(allGamesSettings);
 
@@ -293,13 +365,15 @@ void LootState::checkSettingsFile() {
   }
 }
 
-void LootState::findXboxGamingRootPaths() {
+std::vector<std::filesystem::path> LootState::findXboxGamingRootPaths()
+    const {
+  std::vector<std::filesystem::path> xboxGamingRootPaths;
 #ifdef _WIN32
   try {
     for (const auto& driveRootPath : getDriveRootPaths()) {
       const auto xboxGamingRootPath = findXboxGamingRootPath(driveRootPath);
       if (xboxGamingRootPath.has_value()) {
-        xboxGamingRootPaths_.push_back(xboxGamingRootPath.value());
+        xboxGamingRootPaths.push_back(xboxGamingRootPath.value());
       }
     }
   } catch (const exception& e) {
@@ -318,8 +392,8 @@ void LootState::findXboxGamingRootPaths() {
   // detection entirely. There is still legacy install detection logic, but that
   // will do nothing as it relies on Registry interactions that similarly find
   // no matches.
-  xboxGamingRootPaths_.clear();
 #endif
+  return xboxGamingRootPaths;
 }
 
 void LootState::createPreludeDirectory() {
@@ -27,6 +27,7 @@
 #define LOOT_GUI_STATE_LOOT_STATE
 
 #include "gui/state/change_count.h"
+#include "gui/state/game/detection/store_cache.h"
 #include "gui/state/game/games_manager.h"
 #include "gui/state/loot_settings.h"
 
@@ -35,14 +36,26 @@ class LootState : public GamesManager {
 public:
   LootState(LootPaths&& paths);
 
-  void init(const std::string& cmdLineGame,
-            const std::filesystem::path& cmdLineGamePath,
-            bool autoSort);
+  // Load LOOT's settings. This needs to be done before the UI is created.
+  void initSettings(const std::string& cmdLineGame, bool autoSort);
+
+  // Check the settings file, detect installed games and select the initial
+  // game. This doesn't touch the UI, so can be run on a worker thread.
+  void initGames(const std::string& cmdLineGame,
+                 const std::filesystem::path& cmdLineGamePath);
   void initCurrentGame();
 
   std::vector<GameSettings> loadInstalledGames(
       const std::vector<GameSettings>& gamesSettings);
 
+  // If initGames() used cached store scan results, wait for them to be
+  // revalidated and return the new results if any stores have changed. This
+  // doesn't touch any other state, so can be run on any thread.
+  std::optional<StoreGameInstalls> waitForStoreRevalidation();
+
+  // Detect installed games again using the given store scan results.
+  void updateInstalledGames(const StoreGameInstalls& storeInstalls);
+
   const std::vector<SourcedMessage>& getInitMessages() const;
 
   const LootSettings& getSettings() const;
@@ -56,12 +69,16 @@ private:
   void createLootDataPath();
   void loadSettings(const std::string& cmdLineGame, bool autoSort);
   void checkSettingsFile();
-  void findXboxGamingRootPaths();
+  std::vector<std::filesystem::path> findXboxGamingRootPaths() const;
   void createPreludeDirectory();
   void overrideGamePath(const std::string& gameFolderName,
                         const std::filesystem::path& gamePath);
   void setInitialGame(const std::string& cliGameValue);
 
+  std::vector<GameSettings> loadInstalledGames(
+      const std::vector<GameSettings>& gamesSettings,
+      const StoreGameInstalls& storeInstalls);
+
   bool isInstalled(const GameSettings& gameSettings) const override;
 
   void initialiseGameData(gui::Game& game) override;
@@ -73,6 +90,7 @@ private:
   std::vector<std::filesystem::path> xboxGamingRootPaths_;
   std::vector<std::string> preferredUILanguages_;
   std::vector<SourcedMessage> initMessages_;
+  std::future<std::optional<StoreGameInstalls>> storeRevalidation_;
   LootSettings settings_;
   ChangeCount unappliedChangeCount_;
 };
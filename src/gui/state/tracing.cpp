@@ -0,0 +1,229 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#include "gui/state/tracing.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "gui/state/logging.h"
+
+namespace {
+struct TraceEvent {
+  const char* name{nullptr};
+  uint32_t threadId{0};
+  std::chrono::microseconds start{0};
+  std::chrono::microseconds duration{0};
+};
+
+// Spans are kept in memory until the trace file is written, so stop
+// recording after this many to bound memory use in long sessions. Each event
+// is 24 bytes, so this is about 24 MB.
+constexpr size_t MAX_TRACE_EVENTS = 1'000'000;
+
+std::atomic<bool> tracingEnabled{false};
+
+std::mutex traceMutex;
+std::chrono::steady_clock::time_point traceEpoch;
+std::vector<TraceEvent> traceEvents;
+size_t droppedTraceEventCount{0};
+
+std::mutex startupMutex;
+std::optional<std::chrono::steady_clock::time_point> startupStart;
+std::vector<std::string> startupMilestones;
+
+// Give each thread a small sequential ID, as that's easier to read in trace
+// viewers than a platform thread ID.
+uint32_t getCurrentThreadTraceId() {
+  static std::atomic<uint32_t> nextThreadId{1};
+  thread_local const uint32_t threadId = nextThreadId++;
+
+  return threadId;
+}
+
+void recordSpan(const char* name,
+                std::chrono::steady_clock::time_point start,
+                std::chrono::steady_clock::time_point end) {
+  using std::chrono::duration_cast;
+  using std::chrono::microseconds;
+
+  const auto threadId = getCurrentThreadTraceId();
+
+  std::lock_guard<std::mutex> guard(traceMutex);
+
+  // Tracing may have been disabled since the span started.
+  if (!tracingEnabled) {
+    return;
+  }
+
+  if (traceEvents.size() >= MAX_TRACE_EVENTS) {
+    droppedTraceEventCount += 1;
+    return;
+  }
+
+  traceEvents.push_back(
+      TraceEvent{name,
+                 threadId,
+                 duration_cast<microseconds>(start - traceEpoch),
+                 duration_cast<microseconds>(end - start)});
+}
+}
+
+namespace loot {
+void enableTracing() {
+  std::lock_guard<std::mutex> guard(traceMutex);
+
+  if (!tracingEnabled) {
+    traceEpoch = std::chrono::steady_clock::now();
+    tracingEnabled = true;
+  }
+}
+
+void disableTracing() {
+  std::lock_guard<std::mutex> guard(traceMutex);
+
+  tracingEnabled = false;
+  traceEvents.clear();
+  traceEvents.shrink_to_fit();
+  droppedTraceEventCount = 0;
+}
+
+bool isTracingEnabled() { return tracingEnabled; }
+
+void writeTraceFile(const std::filesystem::path& outputFile) {
+  std::vector<TraceEvent> events;
+  size_t droppedEventCount = 0;
+  {
+    std::lock_guard<std::mutex> guard(traceMutex);
+    events = traceEvents;
+    droppedEventCount = droppedTraceEventCount;
+  }
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info(
+        "Writing {} trace spans to {}", events.size(), outputFile.u8string());
+
+    if (droppedEventCount > 0) {
+      logger->warn(
+          "{} trace spans were not recorded because the limit of {} spans "
+          "was reached",
+          droppedEventCount,
+          MAX_TRACE_EVENTS);
+    }
+  }
+
+  std::ofstream out(outputFile);
+  if (!out.is_open()) {
+    throw std::runtime_error(outputFile.u8string() +
+                             " could not be opened for writing");
+  }
+
+  out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  for (size_t i = 0; i < events.size(); i += 1) {
+    const auto& event = events[i];
+
+    // Span names are string literals that don't need escaping.
+    out << fmt::format(
+        "{}\n{{\"name\":\"{}\",\"cat\":\"loot\",\"ph\":\"X\",\"pid\":1,"
+        "\"tid\":{},\"ts\":{},\"dur\":{}}}",
+        i == 0 ? "" : ",",
+        event.name,
+        event.threadId,
+        event.start.count(),
+        event.duration.count());
+  }
+
+  out << "\n]}\n";
+}
+
+void startStartupTimeline() {
+  std::lock_guard<std::mutex> guard(startupMutex);
+
+  if (!startupStart.has_value()) {
+    startupStart = std::chrono::steady_clock::now();
+  }
+}
+
+std::optional<std::chrono::milliseconds> markStartupMilestone(
+    const char* milestone) {
+  const auto now = std::chrono::steady_clock::now();
+
+  std::chrono::steady_clock::time_point start;
+  {
+    std::lock_guard<std::mutex> guard(startupMutex);
+
+    if (!startupStart.has_value() ||
+        std::find(startupMilestones.begin(),
+                  startupMilestones.end(),
+                  milestone) != startupMilestones.end()) {
+      return std::nullopt;
+    }
+
+    startupMilestones.push_back(milestone);
+    start = startupStart.value();
+  }
+
+  const auto elapsed =
+      std::chrono::duration_cast<std::chrono::milliseconds>(now - start);
+
+  const auto logger = getLogger();
+  if (logger) {
+    logger->info(
+        "Startup timeline: {} after {} ms", milestone, elapsed.count());
+  }
+
+  if (tracingEnabled) {
+    recordSpan(milestone, start, now);
+  }
+
+  return elapsed;
+}
+
+TraceSpan::TraceSpan(const char* name) noexcept : name_(name) {
+  if (tracingEnabled) {
+    start_ = std::chrono::steady_clock::now();
+  }
+}
+
+TraceSpan::~TraceSpan() {
+  if (!start_.has_value()) {
+    return;
+  }
+
+  try {
+    recordSpan(name_, start_.value(), std::chrono::steady_clock::now());
+  } catch (...) {
+    // Failing to record a span shouldn't affect anything else.
+  }
+}
+}
@@ -0,0 +1,81 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_GUI_STATE_TRACING
+#define LOOT_GUI_STATE_TRACING
+
+#include <chrono>
+#include <filesystem>
+#include <optional>
+
+namespace loot {
+// Start recording trace spans. Until this is called, creating a TraceSpan
+// does nothing.
+void enableTracing();
+
+// Stop recording trace spans and discard those that have been recorded.
+void disableTracing();
+
+bool isTracingEnabled();
+
+// Write all the spans that have been recorded so far to the given file in
+// Chrome's trace event JSON format, which can be viewed using Perfetto or
+// chrome://tracing. To bound memory use, only the first million spans are
+// recorded.
+void writeTraceFile(const std::filesystem::path& outputFile);
+
+// Record the start of LOOT's startup, which startup milestones are timed
+// relative to. Only the first call has any effect.
+void startStartupTimeline();
+
+// Log the time taken to reach the given startup milestone, and record it as a
+// span from the start of startup if tracing is enabled. Each milestone is only
+// recorded the first time it's reached, and nothing is recorded if
+// startStartupTimeline() hasn't been called. The name must be a string literal
+// (or otherwise outlive the recorded trace). Returns the elapsed time if the
+// milestone was recorded.
+std::optional<std::chrono::milliseconds> markStartupMilestone(
+    const char* milestone);
+
+// Records the time between its construction and destruction as a named span
+// on the current thread, if tracing is enabled. The name must be a string
+// literal (or otherwise outlive the recorded trace).
+class TraceSpan {
+public:
+  explicit TraceSpan(const char* name) noexcept;
+  TraceSpan(const TraceSpan&) = delete;
+  TraceSpan(TraceSpan&&) = delete;
+  ~TraceSpan();
+
+  TraceSpan& operator=(const TraceSpan&) = delete;
+  TraceSpan& operator=(TraceSpan&&) = delete;
+
+private:
+  const char* name_;
+  std::optional<std::chrono::steady_clock::time_point> start_;
+};
+}
+
+#endif
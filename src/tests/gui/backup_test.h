@@ -26,8 +26,12 @@ along with LOOT.  If not, see
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
 
 #include "gui/backup.h"
 #include "tests/gui/test_helpers.h"
@@ -73,84 +77,135 @@ protected:
   std::filesystem::path destRoot;
 };
 
-class CompressDirectoryTest : public BackupTest {
+class FindFilesToBackupTest : public BackupTest {
 protected:
-  static size_t getStreamSize(std::istream& stream) {
-    std::streampos startingPosition = stream.tellg();
+  bool contains(const std::vector<std::filesystem::path>& paths,
+                const std::filesystem::path& path) {
+    return std::find(paths.begin(), paths.end(), path) != paths.end();
+  }
+};
 
-    stream.seekg(0, std::ios_base::end);
-    size_t streamSize = stream.tellg();
-    stream.seekg(startingPosition, std::ios_base::beg);
+class CreateBackupTest : public BackupTest {
+protected:
+  CreateBackupTest() : archivePath(destRoot / "backup.zip") {}
 
-    return streamSize;
+  std::string readArchive() const {
+    std::ifstream in(archivePath, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in)),
+                       std::istreambuf_iterator<char>());
   }
+
+  const std::filesystem::path archivePath;
 };
 
-class CreateBackupTest : public BackupTest {};
+TEST_F(FindFilesToBackupTest, shouldRecursivelyFindFilesInSourceDir) {
+  const auto paths = findFilesToBackup(sourceRoot);
 
-TEST_F(CompressDirectoryTest, shouldReturnThePathToAZipOfTheInput) {
-  createBackup(sourceRoot, destRoot);
+  EXPECT_TRUE(contains(paths, ROOT_DIR_FILE));
+  EXPECT_TRUE(
+      contains(paths, std::filesystem::path(SUB_FOLDER) / SUB_FOLDER_FILE));
+}
 
-  auto archivePath = compressDirectory(destRoot);
+TEST_F(FindFilesToBackupTest, shouldSkipDebugLogInRootDir) {
+  const auto paths = findFilesToBackup(sourceRoot);
 
-  EXPECT_TRUE(std::filesystem::exists(archivePath));
+  ASSERT_TRUE(contains(paths, ROOT_DIR_FILE));
 
-  // Just check the file size because minizip-ng is not compiled with support
-  // for decompression. The size is different on Windows and Linux due to
-  // different amounts of filesystem metadata being stored.
-#ifdef _WIN32
-  auto expectedSize = 656;
-#else
-  auto expectedSize = 440;
-#endif
+  EXPECT_FALSE(contains(paths, DEBUG_LOG));
+}
 
-  auto archiveSize = std::filesystem::file_size(archivePath);
-  EXPECT_EQ(expectedSize, archiveSize);
+TEST_F(FindFilesToBackupTest, shouldSkipBackupsDirectoryInRootDir) {
+  const auto paths = findFilesToBackup(sourceRoot);
 
-  std::filesystem::remove(archivePath);
+  ASSERT_TRUE(contains(paths, ROOT_DIR_FILE));
+
+  for (const auto& path : paths) {
+    EXPECT_NE(BACKUPS_FOLDER, path.begin()->u8string());
+  }
 }
 
-TEST_F(CreateBackupTest, shouldRecursivelyCopyFilesInSourceDirToDestDir) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(FindFilesToBackupTest, shouldSkipDotGitFolderInAnyDirectory) {
+  const auto paths = findFilesToBackup(sourceRoot);
 
-  EXPECT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  EXPECT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  EXPECT_EQ(2, paths.size());
+  for (const auto& path : paths) {
+    EXPECT_EQ(path.end(), std::find(path.begin(), path.end(), GIT_FOLDER));
+  }
 }
 
-TEST_F(CreateBackupTest, shouldSkipDebugLogInRootDir) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(FindFilesToBackupTest, shouldSkipEmptyDirectories) {
+  const auto paths = findFilesToBackup(sourceRoot);
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  EXPECT_FALSE(contains(paths, EMPTY_FOLDER));
+}
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / DEBUG_LOG));
+TEST_F(CreateBackupTest, shouldReturnThePathToAZipOfTheSourceDir) {
+  const auto result = createBackup(sourceRoot, archivePath);
+
+  ASSERT_TRUE(result.has_value());
+  EXPECT_EQ(archivePath, result.value());
+
+  // minizip-ng is not compiled with support for decompression, so just check
+  // that the archive has the expected entries, as their names are stored
+  // uncompressed.
+  const auto archive = readArchive();
+  EXPECT_EQ(0, archive.find("PK\x03\x04"));
+  EXPECT_NE(std::string::npos, archive.find(ROOT_DIR_FILE));
+  EXPECT_NE(std::string::npos,
+            archive.find(std::string(SUB_FOLDER) + "/" + SUB_FOLDER_FILE));
+  EXPECT_EQ(std::string::npos, archive.find(DEBUG_LOG));
+  EXPECT_EQ(std::string::npos, archive.find(GIT_FOLDER));
 }
 
-TEST_F(CreateBackupTest, shouldSkipBackupsDirectoryInRootDir) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(CreateBackupTest, shouldReturnNulloptIfThereAreNoFilesToBackUp) {
+  const auto emptyDir = sourceRoot / EMPTY_FOLDER;
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  EXPECT_FALSE(createBackup(emptyDir, archivePath).has_value());
+  EXPECT_FALSE(std::filesystem::exists(archivePath));
+}
+
+TEST_F(CreateBackupTest, shouldReportProgressAfterEachFileIsWritten) {
+  for (int i = 0; i < 50; i += 1) {
+    std::ofstream out(sourceRoot / SUB_FOLDER /
+                      ("file" + std::to_string(i) + ".txt"));
+    out << std::string(static_cast<size_t>(i) * 1000, 'a');
+  }
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / BACKUPS_FOLDER));
+  std::vector<std::pair<size_t, size_t>> updates;
+  createBackup(sourceRoot,
+               archivePath,
+               [&](size_t filesBackedUp, size_t totalFiles) {
+                 updates.emplace_back(filesBackedUp, totalFiles);
+               });
+
+  ASSERT_EQ(52, updates.size());
+  for (size_t i = 0; i < updates.size(); i += 1) {
+    EXPECT_EQ(i + 1, updates[i].first);
+    EXPECT_EQ(52, updates[i].second);
+  }
 }
 
-TEST_F(CreateBackupTest, shouldSkipDotGitFolderInAnyDirectory) {
-  createBackup(sourceRoot, destRoot);
+TEST_F(CreateBackupTest, shouldWriteTheSameArchiveGivenTheSameFiles) {
+  for (int i = 0; i < 50; i += 1) {
+    std::ofstream out(sourceRoot / SUB_FOLDER /
+                      ("file" + std::to_string(i) + ".txt"));
+    out << std::string(static_cast<size_t>(i) * 1000, 'a');
+  }
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  const auto relativePaths = findFilesToBackup(sourceRoot);
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / SUB_FOLDER / GIT_FOLDER));
-}
+  compressFiles(sourceRoot, relativePaths, archivePath);
+  const auto first = readArchive();
 
-TEST_F(CreateBackupTest, shouldSkipEmptyDirectories) {
-  createBackup(sourceRoot, destRoot);
+  compressFiles(sourceRoot, relativePaths, archivePath);
 
-  ASSERT_TRUE(std::filesystem::exists(destRoot / ROOT_DIR_FILE));
-  ASSERT_TRUE(std::filesystem::exists(destRoot / SUB_FOLDER / SUB_FOLDER_FILE));
+  EXPECT_EQ(first, readArchive());
+}
 
-  EXPECT_FALSE(std::filesystem::exists(destRoot / EMPTY_FOLDER));
+TEST_F(CreateBackupTest, shouldThrowAndRemoveTheArchiveIfAFileCannotBeRead) {
+  EXPECT_THROW(compressFiles(sourceRoot, {"missing.txt"}, archivePath),
+               std::runtime_error);
+  EXPECT_FALSE(std::filesystem::exists(archivePath));
 }
 }
 }
@@ -0,0 +1,144 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_GAME_BENCHMARKS
+#define LOOT_TESTS_GUI_BENCHMARKS_GAME_BENCHMARKS
+
+#include <benchmark/benchmark.h>
+
+#include "gui/plugin_item.h"
+#include "gui/state/game/game.h"
+#include "tests/gui/benchmarks/synthetic_game.h"
+
+namespace loot::test {
+static constexpr const char* BENCHMARK_LANGUAGE{"en"};
+
+// The synthetic load order sizes to benchmark.
+void applyPluginCounts(benchmark::internal::Benchmark* benchmark) {
+  benchmark->ArgName("plugins")->Arg(500)->Arg(2000)->Arg(5000);
+  benchmark->Unit(benchmark::kMillisecond);
+  // Work is done on other threads, so CPU time of the main thread is not
+  // meaningful.
+  benchmark->UseRealTime();
+}
+
+SyntheticGame& getSyntheticGame(const benchmark::State& state) {
+  return SyntheticGame::get(static_cast<size_t>(state.range(0)));
+}
+
+void BM_loadAllInstalledPluginHeaders(benchmark::State& state) {
+  auto game = getSyntheticGame(state).createGame();
+
+  for (auto _ : state) {
+    game.loadAllInstalledPlugins(true);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_loadAllInstalledPluginHeaders)->Apply(applyPluginCounts);
+
+void BM_loadAllInstalledPlugins(benchmark::State& state) {
+  auto game = getSyntheticGame(state).createGame();
+
+  for (auto _ : state) {
+    game.loadAllInstalledPlugins(false);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_loadAllInstalledPlugins)->Apply(applyPluginCounts);
+
+void BM_getPluginItems(benchmark::State& state) {
+  const auto& game = getSyntheticGame(state).getLoadedGame();
+  const auto loadOrder = game.getLoadOrder();
+
+  for (auto _ : state) {
+    auto items = getPluginItems(loadOrder, game, BENCHMARK_LANGUAGE);
+    benchmark::DoNotOptimize(items);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_getPluginItems)->Apply(applyPluginCounts);
+
+void BM_checkInstallValidity(benchmark::State& state) {
+  const auto& game = getSyntheticGame(state).getLoadedGame();
+
+  std::vector<std::pair<std::unique_ptr<const PluginInterface>, PluginMetadata>>
+      plugins;
+  for (auto& plugin : game.getPlugins()) {
+    auto metadata = game.getMasterlistMetadata(plugin->GetName(), true)
+                        .value_or(PluginMetadata(plugin->GetName()));
+    plugins.emplace_back(std::move(plugin), std::move(metadata));
+  }
+
+  for (auto _ : state) {
+    for (const auto& [plugin, metadata] : plugins) {
+      auto messages =
+          game.checkInstallValidity(*plugin, metadata, BENCHMARK_LANGUAGE);
+      benchmark::DoNotOptimize(messages);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(plugins.size()));
+}
+BENCHMARK(BM_checkInstallValidity)->Apply(applyPluginCounts);
+
+void BM_sortPlugins(benchmark::State& state) {
+  auto game = getSyntheticGame(state).createGame();
+
+  for (auto _ : state) {
+    // Remove the cached result of the previous iteration so that each
+    // iteration actually sorts.
+    state.PauseTiming();
+    std::filesystem::remove(game.getSortCachePath());
+    state.ResumeTiming();
+
+    auto sortedPlugins = game.sortPlugins();
+    benchmark::DoNotOptimize(sortedPlugins);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_sortPlugins)->Apply(applyPluginCounts);
+
+void BM_sortPluginsWithCachedResult(benchmark::State& state) {
+  auto game = getSyntheticGame(state).createGame();
+
+  // Populate the sort cache.
+  game.sortPlugins();
+
+  for (auto _ : state) {
+    auto sortedPlugins = game.sortPlugins();
+    benchmark::DoNotOptimize(sortedPlugins);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_sortPluginsWithCachedResult)->Apply(applyPluginCounts);
+}
+
+#endif
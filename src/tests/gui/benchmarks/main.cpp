@@ -0,0 +1,86 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifdef _MSC_VER
+// Qt typedef's a uint type in the global namespace that spdlog shadows, just
+// disable the warning.
+#pragma warning(disable : 4459)
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+#pragma warning(default : 4459)
+#else
+#include <spdlog/sinks/null_sink.h>
+#include <spdlog/spdlog.h>
+#endif
+
+#include <benchmark/benchmark.h>
+
+#include <QtWidgets/QApplication>
+#include <algorithm>
+#include <string_view>
+#include <vector>
+
+#include "tests/gui/benchmarks/game_benchmarks.h"
+#include "tests/gui/benchmarks/plugin_item_filter_model_benchmarks.h"
+#include "tests/gui/benchmarks/qt_helpers_benchmarks.h"
+
+int main(int argc, char **argv) {
+  // Set the logger to use a null sink.
+  spdlog::create<spdlog::sinks::null_sink_st>("loot_logger");
+
+  // The benchmarks don't show any windows, so don't need a display.
+  if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM")) {
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+  }
+
+  // The plugin item model creates icons, which needs a GUI application.
+  QApplication app(argc, argv);
+
+  // Unless told otherwise, write the results to a JSON file so that they can
+  // be compared across runs.
+  std::vector<char *> args(argv, argv + argc);
+  std::string outputArg = "--benchmark_out=loot_gui_benchmarks.json";
+  std::string outputFormatArg = "--benchmark_out_format=json";
+
+  const auto hasOutputArg =
+      std::any_of(args.begin(), args.end(), [](const char *arg) {
+        return std::string_view(arg).rfind("--benchmark_out=", 0) == 0;
+      });
+  if (!hasOutputArg) {
+    args.push_back(outputArg.data());
+    args.push_back(outputFormatArg.data());
+  }
+
+  auto argCount = static_cast<int>(args.size());
+  benchmark::Initialize(&argCount, args.data());
+  if (benchmark::ReportUnrecognizedArguments(argCount, args.data())) {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
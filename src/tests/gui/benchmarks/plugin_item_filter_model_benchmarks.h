@@ -0,0 +1,99 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_PLUGIN_ITEM_FILTER_MODEL_BENCHMARKS
+#define LOOT_TESTS_GUI_BENCHMARKS_PLUGIN_ITEM_FILTER_MODEL_BENCHMARKS
+
+#include <benchmark/benchmark.h>
+
+#include "gui/plugin_item.h"
+#include "gui/qt/plugin_item_filter_model.h"
+#include "gui/qt/plugin_item_model.h"
+#include "tests/gui/benchmarks/game_benchmarks.h"
+#include "tests/gui/benchmarks/synthetic_game.h"
+
+namespace loot::test {
+// Holds the models that back the main window's cards and sidebar, populated
+// with a synthetic game's plugins.
+class PluginItemModels {
+public:
+  explicit PluginItemModels(size_t pluginCount) :
+      pluginItemModel(nullptr), proxyModel(nullptr) {
+    const auto& game = SyntheticGame::get(pluginCount).getLoadedGame();
+
+    pluginItemModel.setPluginItems(
+        getPluginItems(game.getLoadOrder(), game, BENCHMARK_LANGUAGE));
+    proxyModel.setSourceModel(&pluginItemModel);
+  }
+
+  PluginItemModel pluginItemModel;
+  PluginItemFilterModel proxyModel;
+};
+
+void BM_filterPlugins(benchmark::State& state) {
+  PluginItemModels models(static_cast<size_t>(state.range(0)));
+
+  // Alternate between two filters so that every iteration changes which rows
+  // are accepted.
+  PluginFiltersState inactiveFilter;
+  inactiveFilter.hideInactivePlugins = true;
+
+  PluginFiltersState contentFilter;
+  contentFilter.content = std::string("Synthetic message");
+
+  for (auto _ : state) {
+    auto first = inactiveFilter;
+    models.proxyModel.setFiltersState(std::move(first));
+
+    auto second = contentFilter;
+    models.proxyModel.setFiltersState(std::move(second));
+  }
+
+  state.SetItemsProcessed(state.iterations() * 2 * state.range(0));
+}
+BENCHMARK(BM_filterPlugins)->Apply(applyPluginCounts);
+
+void BM_searchCards(benchmark::State& state) {
+  PluginItemModels models(static_cast<size_t>(state.range(0)));
+  const auto& proxyModel = models.proxyModel;
+
+  const QVariant searchText(QString("Light"));
+
+  for (auto _ : state) {
+    auto results =
+        proxyModel.match(proxyModel.index(0, PluginItemModel::CARDS_COLUMN),
+                         ContentSearchRole,
+                         searchText,
+                         -1,
+                         Qt::MatchContains | Qt::MatchWrap);
+    benchmark::DoNotOptimize(results);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_searchCards)->Apply(applyPluginCounts);
+}
+
+#endif
@@ -0,0 +1,98 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_QT_HELPERS_BENCHMARKS
+#define LOOT_TESTS_GUI_BENCHMARKS_QT_HELPERS_BENCHMARKS
+
+#include <benchmark/benchmark.h>
+
+#include <fstream>
+
+#include "gui/qt/helpers.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot::test {
+// A masterlist-like file of roughly the given size, with LF or CRLF line
+// endings, that is deleted when the object is destroyed.
+class SyntheticMasterlistFile {
+public:
+  SyntheticMasterlistFile(size_t sizeInMiB, bool useCrlf) :
+      rootPath_(getTempPath()), filePath_(rootPath_ / "masterlist.yaml") {
+    static constexpr size_t MIB = 1024 * 1024;
+
+    std::filesystem::create_directories(rootPath_);
+
+    const std::string lineEnding = useCrlf ? "\r\n" : "\n";
+    std::ofstream out(filePath_, std::ios_base::binary);
+
+    size_t written = 0;
+    for (size_t i = 0; written < sizeInMiB * MIB; i += 1) {
+      const auto entry = "  - name: 'Plugin" + std::to_string(i) + ".esp'" +
+                         lineEnding + "    group: *defaultGroup" +
+                         lineEnding + "    after: [ 'Plugin" +
+                         std::to_string(i / 2) + ".esp' ]" + lineEnding;
+      out << entry;
+      written += entry.size();
+    }
+  }
+
+  SyntheticMasterlistFile(const SyntheticMasterlistFile&) = delete;
+  SyntheticMasterlistFile(SyntheticMasterlistFile&&) = delete;
+
+  ~SyntheticMasterlistFile() {
+    std::error_code errorCode;
+    std::filesystem::remove_all(rootPath_, errorCode);
+  }
+
+  SyntheticMasterlistFile& operator=(const SyntheticMasterlistFile&) = delete;
+  SyntheticMasterlistFile& operator=(SyntheticMasterlistFile&&) = delete;
+
+  const std::filesystem::path& getPath() const { return filePath_; }
+
+private:
+  std::filesystem::path rootPath_;
+  std::filesystem::path filePath_;
+};
+
+void BM_calculateGitBlobHash(benchmark::State& state) {
+  const auto sizeInMiB = static_cast<size_t>(state.range(0));
+  const SyntheticMasterlistFile file(sizeInMiB, state.range(1) != 0);
+
+  for (auto _ : state) {
+    auto hash = calculateGitBlobHash(file.getPath());
+    benchmark::DoNotOptimize(hash);
+  }
+
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<int64_t>(
+                              std::filesystem::file_size(file.getPath())));
+}
+BENCHMARK(BM_calculateGitBlobHash)
+    ->ArgNames({"MiB", "crlf"})
+    ->ArgsProduct({{1, 4, 16}, {0, 1}})
+    ->Unit(benchmark::kMillisecond);
+}
+
+#endif
@@ -0,0 +1,399 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_BENCHMARKS_SYNTHETIC_GAME
+#define LOOT_TESTS_GUI_BENCHMARKS_SYNTHETIC_GAME
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "gui/state/game/game.h"
+#include "gui/state/game/game_settings.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot::test {
+// Generates a Skyrim Special Edition install containing the given number of
+// plugins, along with a masterlist that gives them groups and other metadata.
+// The plugins only contain a header, but have realistic chains of masters
+// and a mix of master, light and full plugins. The install is deterministic
+// for a given plugin count, so that benchmark results are comparable between
+// runs.
+//
+// Skyrim SE does not support medium plugins, which only exist for Starfield,
+// so none are generated.
+class SyntheticGame {
+public:
+  explicit SyntheticGame(size_t pluginCount) :
+      rootPath_(getTempPath()),
+      gamePath_(rootPath_ / "games" / "game"),
+      dataPath_(gamePath_ / "Data"),
+      localPath_(rootPath_ / "local" / "game"),
+      lootDataPath_(rootPath_ / "local" / "LOOT"),
+      settings_(GameSettings(GameId::tes5se, "Skyrim Special Edition")
+                    .setMinimumHeaderVersion(0.0f)
+                    .setGamePath(gamePath_)
+                    .setGameLocalPath(localPath_)) {
+    std::filesystem::create_directories(dataPath_);
+    std::filesystem::create_directories(localPath_);
+    std::filesystem::create_directories(lootDataPath_);
+
+    touch(gamePath_ / "SkyrimSE.exe");
+
+    generatePlugins(pluginCount);
+    writePlugins();
+    writeActivePlugins();
+
+    initLootGameFolder(lootDataPath_, settings_);
+    writeMasterlist(getMasterlistPath(lootDataPath_, settings_));
+  }
+
+  SyntheticGame(const SyntheticGame&) = delete;
+  SyntheticGame(SyntheticGame&&) = delete;
+
+  ~SyntheticGame() {
+    loadedGame_.reset();
+
+    std::error_code errorCode;
+    std::filesystem::remove_all(rootPath_, errorCode);
+  }
+
+  SyntheticGame& operator=(const SyntheticGame&) = delete;
+  SyntheticGame& operator=(SyntheticGame&&) = delete;
+
+  // Get a shared synthetic game with the given number of plugins, creating it
+  // if it does not already exist, as generating the larger installs is slow.
+  static SyntheticGame& get(size_t pluginCount) {
+    static std::map<size_t, std::unique_ptr<SyntheticGame>> games;
+
+    auto& game = games[pluginCount];
+    if (!game) {
+      game = std::make_unique<SyntheticGame>(pluginCount);
+    }
+
+    return *game;
+  }
+
+  // Create an initialised game with its metadata loaded but no plugins
+  // loaded.
+  gui::Game createGame() const {
+    gui::Game game(settings_, lootDataPath_, "");
+    game.init();
+    game.loadMetadata();
+
+    return game;
+  }
+
+  // Get a game with its metadata and all its plugins fully loaded. The game
+  // is shared between benchmarks and must not be modified.
+  const gui::Game& getLoadedGame() {
+    if (!loadedGame_.has_value()) {
+      loadedGame_ = createGame();
+      loadedGame_->loadAllInstalledPlugins(false);
+    }
+
+    return *loadedGame_;
+  }
+
+  size_t getPluginCount() const { return plugins_.size(); }
+
+private:
+  static constexpr uint32_t MASTER_FLAG = 0x1;
+  static constexpr uint32_t LIGHT_FLAG = 0x200;
+
+  // The game limits how many plugins can be active.
+  static constexpr size_t MAX_ACTIVE_FULL_PLUGINS = 250;
+  static constexpr size_t MAX_ACTIVE_LIGHT_PLUGINS = 4000;
+
+  static constexpr size_t PLUGINS_PER_GROUP = 50;
+  static constexpr size_t RECENT_MASTERS_WINDOW = 20;
+
+  static constexpr const char* GAME_MASTER{"Skyrim.esm"};
+
+  enum class PluginKind { master, lightMaster, light, full };
+
+  struct SyntheticPlugin {
+    std::string name;
+    PluginKind kind{PluginKind::full};
+    std::vector<std::string> masters;
+    bool isActive{false};
+  };
+
+  void generatePlugins(size_t pluginCount) {
+    std::mt19937 prng(static_cast<std::mt19937::result_type>(pluginCount));
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    // Masters must load before other plugins, so generate them separately
+    // and then put them first.
+    std::vector<SyntheticPlugin> masters;
+    std::vector<SyntheticPlugin> others;
+    for (size_t i = 0; i < pluginCount; i += 1) {
+      const auto roll = percent(prng);
+      const auto number = fmt::format("{:04}", i);
+
+      SyntheticPlugin plugin;
+      if (roll < 12) {
+        plugin.kind = PluginKind::master;
+        plugin.name = "Synthetic Master " + number + ".esm";
+      } else if (roll < 22) {
+        plugin.kind = PluginKind::lightMaster;
+        plugin.name = "Synthetic Light Master " + number + ".esl";
+      } else if (roll < 42) {
+        plugin.kind = PluginKind::light;
+        plugin.name = "Synthetic Light " + number + ".esp";
+      } else {
+        plugin.kind = PluginKind::full;
+        plugin.name = "Synthetic Plugin " + number + ".esp";
+      }
+
+      const auto isMasterPlugin = isMaster(plugin.kind);
+      plugin.masters = pickMasters(prng, masters, others, !isMasterPlugin);
+
+      auto& block = isMasterPlugin ? masters : others;
+      block.push_back(std::move(plugin));
+    }
+
+    plugins_ = std::move(masters);
+    plugins_.insert(plugins_.end(), others.begin(), others.end());
+
+    size_t activeFullPlugins = 0;
+    size_t activeLightPlugins = 0;
+    for (auto& plugin : plugins_) {
+      auto& activeCount = isLight(plugin.kind) ? activeLightPlugins
+                                                : activeFullPlugins;
+      const auto maxActive = isLight(plugin.kind) ? MAX_ACTIVE_LIGHT_PLUGINS
+                                                  : MAX_ACTIVE_FULL_PLUGINS;
+
+      if (activeCount < maxActive) {
+        plugin.isActive = true;
+        activeCount += 1;
+      }
+    }
+  }
+
+  // Pick up to three recently-generated masters, and for non-masters maybe
+  // also an earlier non-master, so that plugins form chains of dependencies.
+  static std::vector<std::string> pickMasters(
+      std::mt19937& prng,
+      const std::vector<SyntheticPlugin>& masters,
+      const std::vector<SyntheticPlugin>& others,
+      bool canDependOnNonMasters) {
+    std::vector<std::string> pickedMasters{GAME_MASTER};
+
+    std::uniform_int_distribution<size_t> masterCount(0, 3);
+    const auto count = std::min(masterCount(prng), masters.size());
+    const auto windowStart = masters.size() > RECENT_MASTERS_WINDOW
+                                 ? masters.size() - RECENT_MASTERS_WINDOW
+                                 : 0;
+    for (size_t i = 0; i < count; i += 1) {
+      std::uniform_int_distribution<size_t> index(windowStart,
+                                                  masters.size() - 1);
+      const auto& name = masters.at(index(prng)).name;
+      if (std::find(pickedMasters.begin(), pickedMasters.end(), name) ==
+          pickedMasters.end()) {
+        pickedMasters.push_back(name);
+      }
+    }
+
+    std::uniform_int_distribution<int> percent(0, 99);
+    if (canDependOnNonMasters && !others.empty() && percent(prng) < 25) {
+      std::uniform_int_distribution<size_t> index(0, others.size() - 1);
+      pickedMasters.push_back(others.at(index(prng)).name);
+    }
+
+    return pickedMasters;
+  }
+
+  void writePlugins() const {
+    writePlugin(dataPath_ / GAME_MASTER, MASTER_FLAG, {});
+
+    for (const auto& plugin : plugins_) {
+      uint32_t flags = 0;
+      if (isMaster(plugin.kind)) {
+        flags |= MASTER_FLAG;
+      }
+      if (plugin.kind == PluginKind::light) {
+        flags |= LIGHT_FLAG;
+      }
+
+      writePlugin(dataPath_ / std::filesystem::u8path(plugin.name),
+                  flags,
+                  plugin.masters);
+    }
+  }
+
+  // Write a plugin that only contains a TES4 header record.
+  static void writePlugin(const std::filesystem::path& path,
+                          uint32_t flags,
+                          const std::vector<std::string>& masters) {
+    std::string subrecords;
+
+    // HEDR: version, number of records, next object ID.
+    static constexpr float HEADER_VERSION = 1.71f;
+    static constexpr uint32_t NEXT_OBJECT_ID = 0x800;
+    std::string hedr;
+    appendLittleEndian(hedr, HEADER_VERSION);
+    appendLittleEndian(hedr, uint32_t{0});
+    appendLittleEndian(hedr, NEXT_OBJECT_ID);
+    appendSubrecord(subrecords, "HEDR", hedr);
+
+    for (const auto& master : masters) {
+      appendSubrecord(subrecords, "MAST", master + '\0');
+      appendSubrecord(subrecords, "DATA", std::string(sizeof(uint64_t), '\0'));
+    }
+
+    static constexpr uint16_t FORM_VERSION = 44;
+    std::string record = "TES4";
+    appendLittleEndian(record, static_cast<uint32_t>(subrecords.size()));
+    appendLittleEndian(record, flags);
+    appendLittleEndian(record, uint32_t{0});  // FormID
+    appendLittleEndian(record, uint32_t{0});  // Version control info
+    appendLittleEndian(record, FORM_VERSION);
+    appendLittleEndian(record, uint16_t{0});  // Unknown
+    record += subrecords;
+
+    std::ofstream out(path, std::ios::binary);
+    out.write(record.data(), static_cast<std::streamsize>(record.size()));
+  }
+
+  void writeActivePlugins() const {
+    std::ofstream out(localPath_ / "Plugins.txt");
+    out << '*' << GAME_MASTER << '\n';
+    for (const auto& plugin : plugins_) {
+      if (plugin.isActive) {
+        out << '*';
+      }
+      out << plugin.name << '\n';
+    }
+  }
+
+  // Give every plugin a group, with groups following the current load
+  // order, and give some of them load after metadata, requirements,
+  // incompatibilities, messages and Bash Tags. All relationships point to
+  // earlier plugins so that the metadata contains no cycles.
+  void writeMasterlist(const std::filesystem::path& masterlistPath) const {
+    std::mt19937 prng(static_cast<std::mt19937::result_type>(plugins_.size()));
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    const auto groupCount =
+        std::max(size_t{1}, plugins_.size() / PLUGINS_PER_GROUP);
+
+    std::ofstream out(masterlistPath);
+    out << "groups:\n  - name: default\n";
+    for (size_t i = 0; i < groupCount; i += 1) {
+      out << "  - name: '" << getGroupName(i) << "'\n    after: [ '"
+          << (i == 0 ? std::string("default") : getGroupName(i - 1))
+          << "' ]\n";
+    }
+
+    out << "\nplugins:\n";
+    for (size_t i = 0; i < plugins_.size(); i += 1) {
+      const auto& plugin = plugins_.at(i);
+
+      out << "  - name: '" << plugin.name << "'\n";
+      out << "    group: '" << getGroupName(i * groupCount / plugins_.size())
+          << "'\n";
+
+      if (i > 0) {
+        std::uniform_int_distribution<size_t> earlierIndex(0, i - 1);
+
+        if (percent(prng) < 20) {
+          out << "    after: [ '" << plugins_.at(earlierIndex(prng)).name
+              << "' ]\n";
+        }
+        if (percent(prng) < 10) {
+          out << "    req: [ '" << plugins_.at(earlierIndex(prng)).name
+              << "' ]\n";
+        }
+      }
+
+      if (percent(prng) < 5) {
+        out << "    inc: [ 'Synthetic Missing " << i << ".esp' ]\n";
+      }
+      if (percent(prng) < 20) {
+        out << "    msg:\n      - type: say\n        content: 'Synthetic "
+               "message for plugin "
+            << i << ".'\n";
+      }
+      if (percent(prng) < 10) {
+        out << "    tag: [ Delev, Relev ]\n";
+      }
+    }
+  }
+
+  static std::string getGroupName(size_t index) {
+    return "Synthetic Group " + std::to_string(index);
+  }
+
+  static bool isMaster(PluginKind kind) {
+    return kind == PluginKind::master || kind == PluginKind::lightMaster;
+  }
+
+  static bool isLight(PluginKind kind) {
+    return kind == PluginKind::lightMaster || kind == PluginKind::light;
+  }
+
+  // All the platforms that LOOT supports are little-endian, so values can be
+  // copied as-is.
+  template<typename T>
+  static void appendLittleEndian(std::string& buffer, T value) {
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    buffer.append(bytes, sizeof(T));
+  }
+
+  static void appendSubrecord(std::string& buffer,
+                              const char* type,
+                              const std::string& data) {
+    buffer.append(type, 4);
+    appendLittleEndian(buffer, static_cast<uint16_t>(data.size()));
+    buffer += data;
+  }
+
+  std::filesystem::path rootPath_;
+  std::filesystem::path gamePath_;
+  std::filesystem::path dataPath_;
+  std::filesystem::path localPath_;
+  std::filesystem::path lootDataPath_;
+  GameSettings settings_;
+  std::vector<SyntheticPlugin> plugins_;
+  std::optional<gui::Game> loadedGame_;
+};
+}
+
+#endif
@@ -27,6 +27,7 @@ along with LOOT.  If not, see
 #include <gtest/gtest.h>
 
 #include <boost/locale/generator.hpp>
+#include <fstream>
 
 #include "gui/helpers.h"
 #include "tests/common_game_test_fixture.h"
@@ -166,6 +167,37 @@ TEST(CompareFilenames, shouldBeCaseInsensitiveAndLocaleInvariant) {
   // Reset locale.
   std::locale::global(boost::locale::generator().generate(""));
 }
+
+TEST(AddToHash, shouldNotConfuseConsecutiveValuesWithTheirConcatenation) {
+  QCryptographicHash hash1(QCryptographicHash::Sha256);
+  addToHash(hash1, "ab");
+  addToHash(hash1, "c");
+
+  QCryptographicHash hash2(QCryptographicHash::Sha256);
+  addToHash(hash2, "a");
+  addToHash(hash2, "bc");
+
+  EXPECT_NE(hash1.result(), hash2.result());
+}
+
+class WriteFileAtomicallyTest : public CommonGameTestFixture {
+protected:
+  WriteFileAtomicallyTest() : CommonGameTestFixture(GameId::tes3) {}
+};
+
+TEST_F(WriteFileAtomicallyTest,
+       shouldReplaceTheFileContentAndNotLeaveATemporaryFileBehind) {
+  const auto path = dataPath / "file.txt";
+  writeFileAtomically(path, "first content");
+  writeFileAtomically(path, "second");
+
+  std::ifstream in(path, std::ios::binary);
+  const std::string content{std::istreambuf_iterator<char>(in),
+                            std::istreambuf_iterator<char>()};
+
+  EXPECT_EQ("second", content);
+  EXPECT_FALSE(std::filesystem::exists(dataPath / "file.txt.tmp"));
+}
 }
 }
 
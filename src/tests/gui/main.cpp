@@ -38,8 +38,11 @@
 
 #include "tests/gui/backup_test.h"
 #include "tests/gui/helpers_test.h"
+#include "tests/gui/qt/completion_model_test.h"
+#include "tests/gui/qt/groups_editor/graph_layout_test.h"
 #include "tests/gui/qt/helpers_test.h"
 #include "tests/gui/qt/tasks/tasks_test.h"
+#include "tests/gui/qt/tasks/update_masterlist_task_test.h"
 #include "tests/gui/sourced_message_test.h"
 #include "tests/gui/state/change_count_test.h"
 #include "tests/gui/state/game/detection/common_test.h"
@@ -50,14 +53,17 @@
 #include "tests/gui/state/game/detection/heroic_test.h"
 #include "tests/gui/state/game/detection/microsoft_store_test.h"
 #include "tests/gui/state/game/detection/steam_test.h"
+#include "tests/gui/state/game/detection/store_cache_test.h"
 #include "tests/gui/state/game/detection_test.h"
 #include "tests/gui/state/game/game_settings_test.h"
 #include "tests/gui/state/game/game_test.h"
 #include "tests/gui/state/game/games_manager_test.h"
 #include "tests/gui/state/game/group_node_positions_test.h"
 #include "tests/gui/state/game/helpers_test.h"
+#include "tests/gui/state/game/userlist_writer_test.h"
 #include "tests/gui/state/loot_paths_test.h"
 #include "tests/gui/state/loot_settings_test.h"
+#include "tests/gui/state/tracing_test.h"
 
 int main(int argc, char **argv) {
   // Set the logger to use a null sink.
@@ -0,0 +1,131 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_COMPLETION_MODEL_TEST
+#define LOOT_TESTS_GUI_QT_COMPLETION_MODEL_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtTest/QSignalSpy>
+
+#include "gui/qt/completion_model.h"
+
+namespace loot {
+namespace test {
+std::vector<std::string> getRows(const CompletionModel& model) {
+  std::vector<std::string> rows;
+  for (int i = 0; i < model.rowCount(); i += 1) {
+    rows.push_back(model.data(model.index(i), Qt::DisplayRole)
+                       .toString()
+                       .toStdString());
+  }
+
+  return rows;
+}
+
+TEST(CompletionModel, setCompletionsShouldSortCompletionsCaseInsensitively) {
+  CompletionModel model(nullptr);
+
+  model.setCompletions({"c.esp", "B.esm", "a.esp"});
+
+  EXPECT_EQ(std::vector<std::string>({"a.esp", "B.esm", "c.esp"}),
+            getRows(model));
+}
+
+TEST(CompletionModel, setCompletionsShouldRemoveDuplicates) {
+  CompletionModel model(nullptr);
+
+  model.setCompletions({"a.esp", "b.esp", "a.esp"});
+
+  EXPECT_EQ(std::vector<std::string>({"a.esp", "b.esp"}), getRows(model));
+}
+
+TEST(CompletionModel,
+     setCompletionsShouldNotChangeAnyRowsIfTheCompletionsAreUnchanged) {
+  CompletionModel model(nullptr);
+  model.setCompletions({"a.esp", "b.esp"});
+
+  auto insertedSpy = QSignalSpy(&model, &QAbstractItemModel::rowsInserted);
+  auto removedSpy = QSignalSpy(&model, &QAbstractItemModel::rowsRemoved);
+  auto resetSpy = QSignalSpy(&model, &QAbstractItemModel::modelReset);
+
+  model.setCompletions({"b.esp", "a.esp"});
+
+  EXPECT_EQ(0, insertedSpy.count());
+  EXPECT_EQ(0, removedSpy.count());
+  EXPECT_EQ(0, resetSpy.count());
+}
+
+TEST(CompletionModel,
+     setCompletionsShouldOnlyInsertAndRemoveTheRowsThatChanged) {
+  CompletionModel model(nullptr);
+  model.setCompletions({"a.esp", "b.esp", "c.esp", "d.esp", "f.esp"});
+
+  auto insertedSpy = QSignalSpy(&model, &QAbstractItemModel::rowsInserted);
+  auto removedSpy = QSignalSpy(&model, &QAbstractItemModel::rowsRemoved);
+
+  model.setCompletions({"a.esp", "d.esp", "e1.esp", "e2.esp", "f.esp"});
+
+  EXPECT_EQ(std::vector<std::string>(
+                {"a.esp", "d.esp", "e1.esp", "e2.esp", "f.esp"}),
+            getRows(model));
+
+  ASSERT_EQ(1, removedSpy.count());
+  EXPECT_EQ(1, removedSpy.at(0).at(1).toInt());
+  EXPECT_EQ(2, removedSpy.at(0).at(2).toInt());
+
+  ASSERT_EQ(1, insertedSpy.count());
+  EXPECT_EQ(2, insertedSpy.at(0).at(1).toInt());
+  EXPECT_EQ(3, insertedSpy.at(0).at(2).toInt());
+}
+
+TEST(CompletionModel, setCompletionsShouldHandleAllRowsBeingReplaced) {
+  CompletionModel model(nullptr);
+  model.setCompletions({"a.esp", "b.esp"});
+
+  model.setCompletions({"c.esp"});
+
+  EXPECT_EQ(std::vector<std::string>({"c.esp"}), getRows(model));
+
+  model.setCompletions({});
+
+  EXPECT_EQ(0, model.rowCount());
+}
+
+TEST(CompletionModel, createCompleterShouldFindCompletionsCaseInsensitively) {
+  CompletionModel model(nullptr);
+  model.setCompletions({"Blank.esm", "blank - different.esp", "Other.esp"});
+
+  const auto completer = model.createCompleter(nullptr);
+  completer->setCompletionPrefix("BLANK");
+
+  EXPECT_EQ(2, completer->completionCount());
+
+  delete completer;
+}
+}
+}
+
+#endif
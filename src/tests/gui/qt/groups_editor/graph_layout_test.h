@@ -0,0 +1,246 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2021    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GRAPH_LAYOUT_TEST
+#define LOOT_TESTS_GUI_QT_GROUPS_EDITOR_GRAPH_LAYOUT_TEST
+
+#include <gtest/gtest.h>
+
+#include "gui/qt/groups_editor/graph_layout.h"
+
+namespace loot {
+namespace test {
+// Nodes are 100 wide and 20 high, so a node placed beside another is offset
+// horizontally by 100 + LAYER_SPACING.
+GraphLayoutInput createLayoutInput(
+    const std::vector<std::string>& nodeNames,
+    const std::vector<std::pair<size_t, size_t>>& edges) {
+  GraphLayoutInput input;
+  input.nodeNames = nodeNames;
+  input.nodeSizes = std::vector<QSizeF>(nodeNames.size(), QSizeF(100, 20));
+  input.edges = edges;
+
+  return input;
+}
+
+TEST(CalculateIncrementalLayout, shouldThrowIfThereAreMoreNodeNamesThanSizes) {
+  auto input = createLayoutInput({"a", "b"}, {});
+  input.nodeSizes.pop_back();
+
+  EXPECT_THROW(calculateIncrementalLayout(input, {}), std::invalid_argument);
+}
+
+TEST(CalculateIncrementalLayout, shouldThrowIfAnEdgeIsOutOfRange) {
+  const auto input = createLayoutInput({"a", "b"}, {{0, 2}});
+
+  EXPECT_THROW(calculateIncrementalLayout(input, {}), std::logic_error);
+}
+
+TEST(CalculateIncrementalLayout, shouldNotReturnPositionsForFixedNodes) {
+  const auto input = createLayoutInput({"a", "b"}, {{0, 1}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}, {"b", QPointF(200, 0)}};
+
+  EXPECT_TRUE(calculateIncrementalLayout(input, fixedLayout).empty());
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceANewNodeAfterItsPredecessorIfEdgesPointRight) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 1}, {1, 2}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}, {"b", QPointF(200, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(330, 0)}}), layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceANewNodeAfterItsPredecessorIfEdgesPointLeft) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 1}, {1, 2}});
+  const GraphLayout fixedLayout{{"a", QPointF(200, 0)}, {"b", QPointF(0, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(-130, 0)}}), layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceANewNodeBeforeItsSuccessorIfItHasNoPlacedPredecessors) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 1}, {2, 0}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}, {"b", QPointF(200, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(-130, 0)}}), layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceANewNodeLevelWithTheAverageHeightOfItsPredecessors) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 2}, {1, 2}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}, {"b", QPointF(0, 200)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(130, 100)}}), layout);
+}
+
+TEST(CalculateIncrementalLayout, shouldPlaceChainsOfNewNodesOneAfterAnother) {
+  // The chain runs from c to b to a, so a can't be placed until after b.
+  const auto input = createLayoutInput({"a", "b", "c"}, {{2, 1}, {1, 0}});
+  const GraphLayout fixedLayout{{"c", QPointF(0, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"a", QPointF(260, 0)}, {"b", QPointF(130, 0)}}),
+            layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldMoveANewNodeDownUntilItDoesNotOverlapAnyOtherNode) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 1}, {0, 2}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  // Nodes that are level with one another need to be at least their height
+  // plus NODE_SPACING apart, and nodes are moved in steps of NODE_SPACING.
+  EXPECT_EQ(GraphLayout({{"b", QPointF(130, 0)},
+                         {"c", QPointF(130, 2 * NODE_SPACING)}}),
+            layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceNodesWithNoPlacedNeighboursInAColumnPastTheEndOfTheGraph) {
+  const auto input = createLayoutInput({"a", "b", "c", "d"}, {{0, 1}});
+  const GraphLayout fixedLayout{{"a", QPointF(0, 0)}, {"b", QPointF(200, 50)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(330, 0)},
+                         {"d", QPointF(330, 2 * NODE_SPACING)}}),
+            layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceTheColumnBeforeTheStartOfTheGraphIfEdgesPointLeft) {
+  const auto input = createLayoutInput({"a", "b", "c"}, {{0, 1}});
+  const GraphLayout fixedLayout{{"a", QPointF(200, 50)}, {"b", QPointF(0, 0)}};
+
+  const auto layout = calculateIncrementalLayout(input, fixedLayout);
+
+  EXPECT_EQ(GraphLayout({{"c", QPointF(-130, 0)}}), layout);
+}
+
+TEST(CalculateIncrementalLayout,
+     shouldPlaceTheColumnAtTheOriginIfNoNodesArePlaced) {
+  const auto input = createLayoutInput({"a"}, {});
+
+  const auto layout = calculateIncrementalLayout(input, {});
+
+  EXPECT_EQ(GraphLayout({{"a", QPointF(0, 0)}}), layout);
+}
+
+TEST(GetGraphLayoutKey, shouldBeTheSameForTheSameInputAndMode) {
+  const auto input = createLayoutInput({"a", "b"}, {{0, 1}});
+
+  EXPECT_EQ(getGraphLayoutKey(input, LayoutMode::Fast),
+            getGraphLayoutKey(input, LayoutMode::Fast));
+}
+
+TEST(GetGraphLayoutKey, shouldBeDifferentForFastAndOptimalLayouts) {
+  const auto input = createLayoutInput({"a", "b"}, {{0, 1}});
+
+  EXPECT_NE(getGraphLayoutKey(input, LayoutMode::Fast),
+            getGraphLayoutKey(input, LayoutMode::Optimal));
+}
+
+TEST(GetGraphLayoutKey, shouldBeDifferentIfAnEdgeIsReversed) {
+  const auto input1 = createLayoutInput({"a", "b"}, {{0, 1}});
+  const auto input2 = createLayoutInput({"a", "b"}, {{1, 0}});
+
+  EXPECT_NE(getGraphLayoutKey(input1, LayoutMode::Fast),
+            getGraphLayoutKey(input2, LayoutMode::Fast));
+}
+
+TEST(GetGraphLayoutKey, shouldBeDifferentIfANodeSizeChanges) {
+  const auto input1 = createLayoutInput({"a", "b"}, {{0, 1}});
+  auto input2 = input1;
+  input2.nodeSizes[1].setWidth(150);
+
+  EXPECT_NE(getGraphLayoutKey(input1, LayoutMode::Fast),
+            getGraphLayoutKey(input2, LayoutMode::Fast));
+}
+
+TEST(GetGraphLayoutKey, shouldNotConfuseNodeNamesWithTheirConcatenation) {
+  const auto input1 = createLayoutInput({"ab", "c"}, {});
+  const auto input2 = createLayoutInput({"a", "bc"}, {});
+
+  EXPECT_NE(getGraphLayoutKey(input1, LayoutMode::Fast),
+            getGraphLayoutKey(input2, LayoutMode::Fast));
+}
+
+TEST(GraphLayoutCache, shouldNotFindAKeyThatHasNotBeenInserted) {
+  GraphLayoutCache cache;
+
+  EXPECT_FALSE(cache.find("key").has_value());
+}
+
+TEST(GraphLayoutCache, shouldFindTheLayoutMostRecentlyInsertedForAKey) {
+  GraphLayoutCache cache;
+  cache.insert("key", {{"a", QPointF(0, 0)}});
+  cache.insert("key", {{"a", QPointF(1, 1)}});
+
+  EXPECT_EQ(GraphLayout({{"a", QPointF(1, 1)}}), cache.find("key"));
+}
+
+TEST(GraphLayoutCache, shouldNotMixUpFastAndOptimalLayoutsOfTheSameGraph) {
+  const auto input = createLayoutInput({"a", "b"}, {{0, 1}});
+  const GraphLayout fastLayout{{"a", QPointF(0, 0)}, {"b", QPointF(130, 0)}};
+  const GraphLayout optimalLayout{{"a", QPointF(0, 0)},
+                                  {"b", QPointF(130, 10)}};
+
+  GraphLayoutCache cache;
+  cache.insert(getGraphLayoutKey(input, LayoutMode::Fast), fastLayout);
+  cache.insert(getGraphLayoutKey(input, LayoutMode::Optimal), optimalLayout);
+
+  EXPECT_EQ(fastLayout,
+            cache.find(getGraphLayoutKey(input, LayoutMode::Fast)));
+  EXPECT_EQ(optimalLayout,
+            cache.find(getGraphLayoutKey(input, LayoutMode::Optimal)));
+}
+
+TEST(GraphLayoutCache, shouldEvictTheLeastRecentlyInsertedLayoutWhenFull) {
+  GraphLayoutCache cache;
+  for (int i = 0; i < 9; i += 1) {
+    cache.insert(std::to_string(i), {{"a", QPointF(i, 0)}});
+  }
+
+  EXPECT_FALSE(cache.find("0").has_value());
+  EXPECT_TRUE(cache.find("1").has_value());
+  EXPECT_TRUE(cache.find("8").has_value());
+}
+}
+}
+
+#endif
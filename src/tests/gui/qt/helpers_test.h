@@ -65,10 +65,18 @@ class GetFileRevisionTest : public QtHelpersFixture {};
 
 class GetFileRevisionSummaryTest : public QtHelpersFixture {};
 
+class GetCachedFileRevisionSummaryTest : public QtHelpersFixture {};
+
 class UpdateFileWithDataTest : public QtHelpersFixture {};
 
 class UpdateFileTest : public QtHelpersFixture {};
 
+class ReadHttpValidatorsTest : public QtHelpersFixture {};
+
+class UpdateFileRevisionTimestampTest : public QtHelpersFixture {};
+
+class CreateConditionalRequestTest : public QtHelpersFixture {};
+
 class ReadOldMessagesTest : public QtHelpersFixture {};
 
 class WriteOldMessagesTest : public QtHelpersFixture {};
@@ -101,6 +109,32 @@ TEST_F(CalculateGitBlobHashTest, shouldReplaceCRLFWithLFBeforeCalculatingHash) {
   EXPECT_EQ("7d91453217afc429984c4706e8df22aaac47c9ce", hash);
 }
 
+TEST_F(CalculateGitBlobHashTest,
+       shouldReplaceCRLFThatSpansTheBoundaryBetweenReadChunks) {
+  static constexpr size_t CHUNK_SIZE = 64 * 1024;
+  const auto file = rootPath_ / "text.txt";
+
+  std::ofstream out(file, std::ios_base::binary);
+  out << std::string(CHUNK_SIZE - 1, 'a') << "\r\nb\r\r\n";
+  out.close();
+
+  const auto expectedData =
+      QByteArray(std::string(CHUNK_SIZE - 1, 'a').c_str()) + "\nb\r\n";
+
+  EXPECT_EQ(calculateGitBlobHash(expectedData), calculateGitBlobHash(file));
+}
+
+TEST_F(CalculateGitBlobHashTest, shouldNotReplaceACROnItsOwn) {
+  const auto file = rootPath_ / "text.txt";
+
+  std::ofstream out(file, std::ios_base::binary);
+  out << "a\rb\r";
+  out.close();
+
+  EXPECT_EQ(calculateGitBlobHash(QByteArray("a\rb\r")),
+            calculateGitBlobHash(file));
+}
+
 TEST_F(GetFileRevisionTest, shouldThrowIfGivenPathIsNotARegularFile) {
   EXPECT_THROW(getFileRevision(rootPath_), std::runtime_error);
 }
@@ -192,6 +226,70 @@ TEST_F(GetFileRevisionSummaryTest,
   EXPECT_EQ("Unknown: No revision metadata found", summary.date);
 }
 
+TEST_F(GetFileRevisionTest, shouldDetectChangesAfterCachingTheFileHash) {
+  getFileRevision(filePath_);
+
+  std::ofstream out(filePath_);
+  out << "";
+  out.close();
+
+  auto revision = getFileRevision(filePath_);
+
+  EXPECT_EQ("e69de29bb2d1d6434b8b29ae775ad8c2e48c5391", revision.id);
+  EXPECT_TRUE(revision.is_modified);
+}
+
+TEST_F(GetCachedFileRevisionSummaryTest,
+       shouldReturnNulloptIfTheFileHashHasNotBeenCached) {
+  EXPECT_FALSE(getCachedFileRevisionSummary(filePath_, FileType::Masterlist)
+                   .has_value());
+}
+
+TEST_F(GetCachedFileRevisionSummaryTest,
+       shouldReturnTheSummaryOnceTheFileHashHasBeenCached) {
+  getFileRevisionSummary(filePath_, FileType::Masterlist);
+
+  const auto summary =
+      getCachedFileRevisionSummary(filePath_, FileType::Masterlist);
+
+  ASSERT_TRUE(summary.has_value());
+  EXPECT_EQ("686d51d", summary.value().id);
+  EXPECT_EQ("2022-01-22", summary.value().date);
+}
+
+TEST_F(GetCachedFileRevisionSummaryTest,
+       shouldReturnTheSummaryIfTheFileWasUpdatedByLoot) {
+  updateFileWithData(filePath_, QByteArray("new data"));
+
+  const auto summary =
+      getCachedFileRevisionSummary(filePath_, FileType::Masterlist);
+
+  ASSERT_TRUE(summary.has_value());
+  EXPECT_EQ(calculateGitBlobHash(QByteArray("new data")).substr(0, 7),
+            summary.value().id);
+}
+
+TEST_F(GetCachedFileRevisionSummaryTest,
+       shouldReturnNulloptIfTheFileHasChangedSinceItsHashWasCached) {
+  getFileRevisionSummary(filePath_, FileType::Masterlist);
+
+  std::ofstream out(filePath_);
+  out << "";
+  out.close();
+
+  EXPECT_FALSE(getCachedFileRevisionSummary(filePath_, FileType::Masterlist)
+                   .has_value());
+}
+
+TEST_F(GetCachedFileRevisionSummaryTest,
+       shouldDisplayErrorsIfTheMasterlistDoesNotExist) {
+  const auto summary =
+      getCachedFileRevisionSummary(rootPath_, FileType::Masterlist);
+
+  ASSERT_TRUE(summary.has_value());
+  EXPECT_EQ("N/A: No masterlist present", summary.value().id);
+}
+
 TEST_F(UpdateFileWithDataTest, shouldWriteToFileIfHashesAreDifferent) {
   auto originalHash = calculateGitBlobHash(filePath_);
 
@@ -248,6 +346,120 @@ TEST_F(UpdateFileWithDataTest, shouldWriteMetadataFileEvenIfHashIsUnchanged) {
   EXPECT_EQ(expectedDate, revision.date);
 }
 
+TEST_F(UpdateFileWithDataTest, shouldRecordGivenHttpValidators) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+  validators.lastModified = "Wed, 21 Oct 2015 07:28:00 GMT";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  const auto recordedValidators = readHttpValidators(filePath_);
+
+  ASSERT_TRUE(recordedValidators.has_value());
+  EXPECT_EQ(validators.etag, recordedValidators.value().etag);
+  EXPECT_EQ(validators.lastModified, recordedValidators.value().lastModified);
+}
+
+TEST_F(ReadHttpValidatorsTest, shouldReturnNulloptIfNoneWereRecorded) {
+  EXPECT_FALSE(readHttpValidators(filePath_).has_value());
+}
+
+TEST_F(ReadHttpValidatorsTest, shouldReturnNulloptIfTheFileDoesNotExist) {
+  EXPECT_FALSE(readHttpValidators(rootPath_ / "missing").has_value());
+}
+
+TEST_F(ReadHttpValidatorsTest,
+       shouldReturnNulloptIfTheFileHasChangedSinceItWasUpdated) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  std::ofstream out(filePath_);
+  out << "edited data";
+  out.close();
+
+  EXPECT_FALSE(readHttpValidators(filePath_).has_value());
+}
+
+TEST_F(ReadHttpValidatorsTest, shouldReturnTheUrlThatTheValidatorsAreFor) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+  validators.url = "https://example.com/masterlist.yaml";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  const auto recordedValidators = readHttpValidators(filePath_);
+
+  ASSERT_TRUE(recordedValidators.has_value());
+  EXPECT_EQ(validators.url, recordedValidators.value().url);
+}
+
+TEST_F(CreateConditionalRequestTest,
+       shouldSetValidatorHeadersIfTheyWereRecordedForTheSameUrl) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+  validators.lastModified = "Wed, 21 Oct 2015 07:28:00 GMT";
+  validators.url = "https://example.com/masterlist.yaml";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  const auto request = createConditionalRequest(validators.url, filePath_);
+
+  EXPECT_EQ(QByteArray::fromStdString(validators.etag),
+            request.rawHeader("If-None-Match"));
+  EXPECT_EQ(QByteArray::fromStdString(validators.lastModified),
+            request.rawHeader("If-Modified-Since"));
+}
+
+TEST_F(CreateConditionalRequestTest,
+       shouldNotSetValidatorHeadersIfTheyWereRecordedForADifferentUrl) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+  validators.lastModified = "Wed, 21 Oct 2015 07:28:00 GMT";
+  validators.url = "https://example.com/masterlist.yaml";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  const auto request = createConditionalRequest(
+      "https://example.com/v0.21/masterlist.yaml", filePath_);
+
+  EXPECT_FALSE(request.hasRawHeader("If-None-Match"));
+  EXPECT_FALSE(request.hasRawHeader("If-Modified-Since"));
+}
+
+TEST_F(UpdateFileRevisionTimestampTest,
+       shouldUpdateTheDateWithoutChangingTheRevisionId) {
+  updateFileRevisionTimestamp(filePath_, HttpValidators());
+
+  const auto revision = getFileRevision(filePath_);
+  const auto expectedDate =
+      QDate::currentDate().toString(Qt::ISODate).toStdString();
+
+  EXPECT_EQ("686d51d2991e7359e636720c5cb04446257a42af", revision.id);
+  EXPECT_EQ(expectedDate, revision.date);
+  EXPECT_FALSE(revision.is_modified);
+}
+
+TEST_F(UpdateFileRevisionTimestampTest, shouldReplaceNonEmptyValidators) {
+  HttpValidators validators;
+  validators.etag = "\"abc\"";
+  validators.lastModified = "Wed, 21 Oct 2015 07:28:00 GMT";
+
+  updateFileWithData(filePath_, QByteArray("new data"), validators);
+
+  HttpValidators newValidators;
+  newValidators.etag = "\"def\"";
+
+  updateFileRevisionTimestamp(filePath_, newValidators);
+
+  const auto recordedValidators = readHttpValidators(filePath_);
+
+  ASSERT_TRUE(recordedValidators.has_value());
+  EXPECT_EQ(newValidators.etag, recordedValidators.value().etag);
+  EXPECT_EQ(validators.lastModified, recordedValidators.value().lastModified);
+}
+
 TEST_F(UpdateFileTest,
        shouldOverwriteDestinationWithSourceIfHashesAreDifferent) {
   auto originalHash = calculateGitBlobHash(filePath_);
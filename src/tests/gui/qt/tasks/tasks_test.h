@@ -100,6 +100,56 @@ TEST(QueryTask, executeShouldEmitAFinishedIfQueryExecutionSucceeds) {
   auto result = finishedSpy.takeFirst().at(0).value<QueryResult>();
   EXPECT_EQ("1", std::get<PluginItem>(result).name);
 }
+
+TEST(executeConcurrentBackgroundTasks,
+     shouldRunTasksThatWaitForEventsOnTheGameWorker) {
+  QElapsedTimer timer;
+  timer.start();
+
+  const std::vector<Task *> tasks{new NonBlockingTestTask(false, timer),
+                                  new NonBlockingTestTask(false, timer)};
+
+  auto future = whenAllTasks(tasks);
+
+  executeConcurrentBackgroundTasks(tasks);
+
+  future.waitForFinished();
+
+  for (const auto &taskFuture : future.result()) {
+    EXPECT_NO_THROW(taskFuture.result());
+  }
+}
+
+TEST(executeConcurrentBackgroundTasks, shouldFinishIfATaskErrors) {
+  QElapsedTimer timer;
+  timer.start();
+
+  const std::vector<Task *> tasks{new NonBlockingTestTask(true, timer)};
+
+  auto future = whenAllTasks(tasks);
+
+  executeConcurrentBackgroundTasks(tasks);
+
+  future.waitForFinished();
+
+  EXPECT_THROW(future.result().at(0).result(), std::runtime_error);
+}
+
+TEST(executeBackgroundTask, shouldReturnTheResultOfTheTask) {
+  auto future =
+      executeBackgroundTask(new QueryTask(std::make_unique<TestQuery>(1)));
+
+  future.waitForFinished();
+
+  EXPECT_EQ("1", std::get<PluginItem>(future.result()).name);
+}
+
+TEST(executeBackgroundTask, shouldThrowIfTheTaskErrors) {
+  auto future =
+      executeBackgroundTask(new QueryTask(std::make_unique<TestQuery>(-1)));
+
+  EXPECT_THROW(future.result(), std::runtime_error);
+}
 }
 }
 
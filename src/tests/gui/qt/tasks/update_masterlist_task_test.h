@@ -0,0 +1,393 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+#define LOOT_TESTS_GUI_QT_TASKS_UPDATE_MASTERLIST_TASK_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtNetwork/QTcpServer>
+#include <QtNetwork/QTcpSocket>
+#include <QtTest/QSignalSpy>
+#include <fstream>
+
+#include "gui/qt/helpers.h"
+#include "gui/qt/tasks/update_masterlist_task.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+// A minimal HTTP server that serves one file and supports conditional
+// requests using its ETag.
+class HttpStandInServer {
+public:
+  HttpStandInServer() {
+    QObject::connect(&server, &QTcpServer::newConnection, [this]() {
+      while (server.hasPendingConnections()) {
+        handleConnection(server.nextPendingConnection());
+      }
+    });
+
+    server.listen(QHostAddress::LocalHost);
+  }
+
+  std::string getUrl() const {
+    return "http://127.0.0.1:" + std::to_string(server.serverPort()) +
+           "/masterlist.yaml";
+  }
+
+  void setFile(const std::string& newContent, const std::string& newEtag) {
+    content = newContent;
+    etag = newEtag;
+  }
+
+  int getRequestCount() const { return requestCount; }
+
+  int getNotModifiedCount() const { return notModifiedCount; }
+
+  const std::string& getLastIfNoneMatch() const { return lastIfNoneMatch; }
+
+private:
+  void handleConnection(QTcpSocket* socket) {
+    QObject::connect(socket, &QTcpSocket::disconnected, [socket]() {
+      socket->deleteLater();
+    });
+    QObject::connect(socket, &QTcpSocket::readyRead, [this, socket]() {
+      buffer += socket->readAll();
+
+      const auto headersEnd = buffer.indexOf("\r\n\r\n");
+      if (headersEnd < 0) {
+        return;
+      }
+
+      const auto request = buffer.left(headersEnd);
+      buffer.clear();
+
+      respond(*socket, readIfNoneMatch(request));
+    });
+  }
+
+  static std::string readIfNoneMatch(const QByteArray& request) {
+    for (const auto& line : request.split('\n')) {
+      const auto trimmedLine = line.trimmed();
+      if (trimmedLine.toLower().startsWith("if-none-match:")) {
+        return trimmedLine.mid(trimmedLine.indexOf(':') + 1)
+            .trimmed()
+            .toStdString();
+      }
+    }
+
+    return "";
+  }
+
+  void respond(QTcpSocket& socket, const std::string& ifNoneMatch) {
+    requestCount += 1;
+    lastIfNoneMatch = ifNoneMatch;
+
+    std::string response;
+    if (!ifNoneMatch.empty() && ifNoneMatch == etag) {
+      notModifiedCount += 1;
+      response = "HTTP/1.1 304 Not Modified\r\nETag: " + etag +
+                 "\r\nConnection: close\r\n\r\n";
+    } else {
+      response = "HTTP/1.1 200 OK\r\nETag: " + etag +
+                 "\r\nContent-Length: " + std::to_string(content.size()) +
+                 "\r\nConnection: close\r\n\r\n" + content;
+    }
+
+    socket.write(response.data(), static_cast<qint64>(response.size()));
+    socket.disconnectFromHost();
+  }
+
+  QTcpServer server;
+  QByteArray buffer;
+  std::string content;
+  std::string etag;
+  int requestCount{0};
+  int notModifiedCount{0};
+  std::string lastIfNoneMatch;
+};
+
+class UpdateMasterlistTaskTest : public ::testing::Test {
+protected:
+  UpdateMasterlistTaskTest() :
+      rootPath_(getTempPath()),
+      masterlistPath_(rootPath_ / "masterlist.yaml") {}
+
+  void SetUp() override {
+    std::filesystem::create_directories(rootPath_);
+
+    server_.setFile("globals: []\n", "\"abc\"");
+  }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  MasterlistUpdateResult updateMasterlist() {
+    return updateMasterlist(server_.getUrl());
+  }
+
+  MasterlistUpdateResult updateMasterlist(const std::string& source) {
+    UpdateMasterlistTask task("Skyrim",
+                              source,
+                              masterlistPath_,
+                              std::make_shared<NetworkSession>());
+    auto finishedSpy = QSignalSpy(&task, &Task::finished);
+    auto errorSpy = QSignalSpy(&task, &Task::error);
+
+    task.execute();
+
+    EXPECT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+    EXPECT_EQ(0, errorSpy.count());
+
+    if (finishedSpy.count() != 1) {
+      return MasterlistUpdateResult();
+    }
+
+    const auto result = finishedSpy.takeFirst().at(0).value<QueryResult>();
+    return std::get<MasterlistUpdateResult>(result);
+  }
+
+  std::string readMasterlist() const {
+    std::ifstream in(masterlistPath_);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  }
+
+  static constexpr int TIMEOUT_MS = 5000;
+
+  HttpStandInServer server_;
+  std::filesystem::path rootPath_;
+  std::filesystem::path masterlistPath_;
+};
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldDownloadTheFileAndRecordItsValidatorsIfItDoesNotExist) {
+  const auto result = updateMasterlist();
+
+  EXPECT_EQ("Skyrim", result.first);
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ("globals: []\n", readMasterlist());
+  EXPECT_EQ("", server_.getLastIfNoneMatch());
+
+  const auto validators = readHttpValidators(masterlistPath_);
+  ASSERT_TRUE(validators.has_value());
+  EXPECT_EQ("\"abc\"", validators.value().etag);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldNotUpdateTheFileIfTheServerSaysItIsNotModified) {
+  updateMasterlist();
+  const auto revision = getFileRevision(masterlistPath_);
+
+  const auto result = updateMasterlist();
+
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(1, server_.getNotModifiedCount());
+  EXPECT_EQ("\"abc\"", server_.getLastIfNoneMatch());
+  EXPECT_EQ(revision.id, getFileRevision(masterlistPath_).id);
+  EXPECT_TRUE(readHttpValidators(masterlistPath_).has_value());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldUpdateTheFileIfTheServerHasANewVersion) {
+  updateMasterlist();
+
+  server_.setFile("globals: []\nplugins: []\n", "\"def\"");
+
+  const auto result = updateMasterlist();
+
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(0, server_.getNotModifiedCount());
+  EXPECT_EQ("globals: []\nplugins: []\n", readMasterlist());
+  EXPECT_EQ("\"def\"", readHttpValidators(masterlistPath_).value().etag);
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldNotSendValidatorsIfTheFileHasBeenEdited) {
+  updateMasterlist();
+
+  std::ofstream out(masterlistPath_, std::ios_base::app);
+  out << "plugins: []\n";
+  out.close();
+
+  const auto result = updateMasterlist();
+
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ("", server_.getLastIfNoneMatch());
+  EXPECT_EQ("globals: []\n", readMasterlist());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldNotSendValidatorsIfTheSourceHasChanged) {
+  updateMasterlist();
+
+  const auto result = updateMasterlist(server_.getUrl() + "?branch=v0.21");
+
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(0, server_.getNotModifiedCount());
+  EXPECT_EQ("", server_.getLastIfNoneMatch());
+  EXPECT_FALSE(result.second);
+  EXPECT_EQ("globals: []\n", readMasterlist());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       tasksSharingASessionShouldOnlyDownloadTheSameSourceOnce) {
+  const auto otherMasterlistPath = rootPath_ / "other.yaml";
+  const auto networkSession = std::make_shared<NetworkSession>();
+
+  UpdateMasterlistTask task1(
+      "Skyrim", server_.getUrl(), masterlistPath_, networkSession);
+  UpdateMasterlistTask task2(
+      "Enderal", server_.getUrl(), otherMasterlistPath, networkSession);
+  auto finishedSpy1 = QSignalSpy(&task1, &Task::finished);
+  auto finishedSpy2 = QSignalSpy(&task2, &Task::finished);
+
+  task1.execute();
+  task2.execute();
+
+  EXPECT_TRUE(finishedSpy1.count() == 1 || finishedSpy1.wait(TIMEOUT_MS));
+  EXPECT_TRUE(finishedSpy2.count() == 1 || finishedSpy2.wait(TIMEOUT_MS));
+
+  EXPECT_EQ(1, server_.getRequestCount());
+  EXPECT_EQ("globals: []\n", readMasterlist());
+  EXPECT_TRUE(std::filesystem::exists(otherMasterlistPath));
+  EXPECT_EQ(calculateGitBlobHash(masterlistPath_),
+            calculateGitBlobHash(otherMasterlistPath));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       aSessionShouldSendTheSameRequestAgainOnceTheFirstHasFinished) {
+  const auto networkSession = std::make_shared<NetworkSession>();
+
+  for (int i = 0; i < 2; i += 1) {
+    UpdateMasterlistTask task(
+        "Skyrim", server_.getUrl(), masterlistPath_, networkSession);
+    auto finishedSpy = QSignalSpy(&task, &Task::finished);
+
+    task.execute();
+
+    EXPECT_TRUE(finishedSpy.wait(TIMEOUT_MS));
+  }
+
+  EXPECT_EQ(2, server_.getRequestCount());
+  EXPECT_EQ(1, server_.getNotModifiedCount());
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldEmitAnErrorWithoutSendingARequestIfCancelled) {
+  CancellationToken token;
+  token.cancel();
+
+  UpdateMasterlistTask task("Skyrim",
+                            server_.getUrl(),
+                            masterlistPath_,
+                            std::make_shared<NetworkSession>());
+  task.setCancellationToken(token);
+  auto finishedSpy = QSignalSpy(&task, &Task::finished);
+  auto errorSpy = QSignalSpy(&task, &Task::error);
+
+  task.execute();
+
+  EXPECT_EQ(0, finishedSpy.count());
+  EXPECT_EQ(1, errorSpy.count());
+  EXPECT_EQ(0, server_.getRequestCount());
+  EXPECT_FALSE(std::filesystem::exists(masterlistPath_));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       executeShouldNotWriteTheFileIfCancelledWhileTheRequestIsInFlight) {
+  CancellationToken token;
+
+  UpdateMasterlistTask task("Skyrim",
+                            server_.getUrl(),
+                            masterlistPath_,
+                            std::make_shared<NetworkSession>());
+  task.setCancellationToken(token);
+  auto finishedSpy = QSignalSpy(&task, &Task::finished);
+  auto errorSpy = QSignalSpy(&task, &Task::error);
+
+  task.execute();
+  token.cancel();
+
+  EXPECT_TRUE(errorSpy.wait(TIMEOUT_MS));
+  EXPECT_EQ(0, finishedSpy.count());
+  EXPECT_FALSE(std::filesystem::exists(masterlistPath_));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       cancellingATaskShouldAbortARequestThatIsInFlight) {
+  // This server never responds, so the task can only stop before its
+  // transfer timeout if its request is aborted.
+  QTcpServer silentServer;
+  silentServer.listen(QHostAddress::LocalHost);
+  const auto url = "http://127.0.0.1:" +
+                   std::to_string(silentServer.serverPort()) +
+                   "/masterlist.yaml";
+
+  CancellationToken token;
+
+  UpdateMasterlistTask task(
+      "Skyrim", url, masterlistPath_, std::make_shared<NetworkSession>());
+  task.setCancellationToken(token);
+  auto errorSpy = QSignalSpy(&task, &Task::error);
+
+  task.execute();
+  token.cancel();
+
+  EXPECT_TRUE(errorSpy.wait(TIMEOUT_MS));
+  EXPECT_FALSE(std::filesystem::exists(masterlistPath_));
+}
+
+TEST_F(UpdateMasterlistTaskTest,
+       cancellingOneOfTheTasksSharingARequestShouldNotAbortIt) {
+  const auto otherMasterlistPath = rootPath_ / "other.yaml";
+  const auto networkSession = std::make_shared<NetworkSession>();
+
+  CancellationToken token;
+
+  UpdateMasterlistTask task1(
+      "Skyrim", server_.getUrl(), masterlistPath_, networkSession);
+  UpdateMasterlistTask task2(
+      "Enderal", server_.getUrl(), otherMasterlistPath, networkSession);
+  task1.setCancellationToken(token);
+  auto errorSpy1 = QSignalSpy(&task1, &Task::error);
+  auto finishedSpy2 = QSignalSpy(&task2, &Task::finished);
+
+  task1.execute();
+  task2.execute();
+  token.cancel();
+
+  EXPECT_TRUE(finishedSpy2.count() == 1 || finishedSpy2.wait(TIMEOUT_MS));
+  EXPECT_TRUE(errorSpy1.count() == 1 || errorSpy1.wait(TIMEOUT_MS));
+
+  EXPECT_EQ(1, server_.getRequestCount());
+  EXPECT_FALSE(std::filesystem::exists(masterlistPath_));
+  EXPECT_TRUE(std::filesystem::exists(otherMasterlistPath));
+}
+}
+}
+
+#endif
@@ -117,6 +117,41 @@ TEST_P(Epic_FindGameInstallsTest, shouldFindAValidEpicInstall) {
   EXPECT_EQ("", install.value().localPath);
 }
 
+TEST_P(Epic_FindGameInstallsTest,
+       findEgsInstallLocationsShouldMapAppNamesToInstallLocations) {
+  const auto installLocations = epic::findEgsInstallLocations(registry);
+
+  const auto appName = epic::getEgsAppName(GetParam());
+  ASSERT_TRUE(appName.has_value());
+  ASSERT_EQ(1, installLocations.size());
+  EXPECT_EQ(gamePath, installLocations.at(appName.value()));
+}
+
+TEST_P(Epic_FindGameInstallsTest,
+       findEgsInstallLocationsShouldSkipManifestsWithNoInstallLocation) {
+  std::ofstream out(epicManifestsPath / "other.item");
+  out << "{\"AppName\": \"other\", \"InstallLocation\": \"\"}";
+  out.close();
+
+  const auto installLocations = epic::findEgsInstallLocations(registry);
+
+  EXPECT_EQ(1, installLocations.size());
+  EXPECT_EQ(0, installLocations.count("other"));
+}
+
+TEST_P(Epic_FindGameInstallsTest,
+       shouldFindAnInstallUsingPreviouslyReadInstallLocations) {
+  const auto installLocations = epic::findEgsInstallLocations(registry);
+  std::filesystem::remove_all(epicManifestsPath);
+
+  const auto install =
+      epic::findGameInstalls(installLocations, GetParam(), {});
+
+  ASSERT_TRUE(install.has_value());
+  EXPECT_EQ(GetParam(), install.value().gameId);
+  EXPECT_EQ(InstallSource::epic, install.value().source);
+}
+
 TEST_P(Epic_FindGameInstallsTest, shouldNotFindAnEpicInstallThatIsInvalid) {
   std::filesystem::remove_all(gamePath);
 
@@ -95,6 +95,29 @@ TEST_P(GOG_FindGameInstallsTest,
     EXPECT_EQ("", installs[0].localPath);
   }
 }
+
+TEST_P(GOG_FindGameInstallsTest,
+       shouldFindInstallsUsingInstallPathsReadForAllGogGames) {
+  TestRegistry registry;
+
+  const auto gogGameIds = gog::getGogGameIds(GetParam());
+  if (!gogGameIds.empty()) {
+    const auto subKey = "Software\\GOG.com\\Games\\" + gogGameIds[0];
+    registry.SetStringValue(subKey, gamePath.u8string());
+  }
+
+  const auto installPaths = gog::findGogInstallPaths(registry);
+  const auto installs = gog::findGameInstalls(installPaths, GetParam());
+
+  if (gogGameIds.empty()) {
+    ASSERT_TRUE(installs.empty());
+  } else {
+    ASSERT_EQ(1, installs.size());
+    EXPECT_EQ(GetParam(), installs[0].gameId);
+    EXPECT_EQ(InstallSource::gog, installs[0].source);
+    EXPECT_EQ(gamePath, installs[0].installPath);
+  }
+}
 }
 
 #endif
@@ -25,6 +25,8 @@ along with LOOT.  If not, see
 #ifndef LOOT_TESTS_GUI_STATE_GAME_DETECTION_MICROSOFT_STORE_TEST
 #define LOOT_TESTS_GUI_STATE_GAME_DETECTION_MICROSOFT_STORE_TEST
 
+#include <algorithm>
+
 #include "gui/helpers.h"
 #include "gui/state/game/detection/microsoft_store.h"
 #include "tests/common_game_test_fixture.h"
@@ -181,5 +183,39 @@ TEST_P(Microsoft_FindGameInstallsTest,
   EXPECT_EQ(gamesPaths[1], gameInstalls[0].installPath);
   EXPECT_EQ("", gameInstalls[0].localPath);
 }
+
+TEST_P(Microsoft_FindGameInstallsTest,
+       shouldMatchGameFolderNamesCaseInsensitively) {
+  const auto xboxGamingRootPath = gamePath.parent_path();
+  const auto relativeGamePath =
+      getGamePath(xboxGamingRootPath).lexically_relative(xboxGamingRootPath);
+
+  auto gameFolderName = relativeGamePath.begin()->u8string();
+  std::transform(gameFolderName.begin(),
+                 gameFolderName.end(),
+                 gameFolderName.begin(),
+                 [](unsigned char c) { return std::toupper(c); });
+
+  auto xboxGamePath =
+      xboxGamingRootPath / std::filesystem::u8path(gameFolderName);
+  for (auto it = std::next(relativeGamePath.begin());
+       it != relativeGamePath.end();
+       ++it) {
+    xboxGamePath /= *it;
+  }
+
+  std::filesystem::create_directories(xboxGamePath.parent_path());
+  std::filesystem::copy(
+      gamePath, xboxGamePath, std::filesystem::copy_options::recursive);
+
+  const auto gameId = GetParam();
+  const auto gameFolders =
+      loot::microsoft::findXboxGameFolders({xboxGamingRootPath});
+  const auto gameInstalls =
+      loot::microsoft::findGameInstalls(gameFolders, gameId, {});
+
+  ASSERT_EQ(1, gameInstalls.size());
+  EXPECT_EQ(xboxGamePath, gameInstalls[0].installPath);
+}
 }
 #endif
@@ -0,0 +1,246 @@
+/*  LOOT
+
+A load order optimisation tool for Oblivion, Skyrim, Fallout 3 and
+Fallout: New Vegas.
+
+Copyright (C) 2014 WrinklyNinja
+
+This file is part of LOOT.
+
+LOOT is free software: you can redistribute
+it and/or modify it under the terms of the GNU General Public License
+as published by the Free Software Foundation, either version 3 of
+the License, or (at your option) any later version.
+
+LOOT is distributed in the hope that it will
+be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with LOOT.  If not, see
+<https://www.gnu.org/licenses/>.
+*/
+
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_DETECTION_STORE_CACHE_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_DETECTION_STORE_CACHE_TEST
+
+#include "gui/state/game/detection/store_cache.h"
+#include "tests/common_game_test_fixture.h"
+#include "tests/gui/state/game/detection/test_registry.h"
+
+namespace loot::test {
+class GameStoreCacheTest : public ::testing::Test {
+public:
+  GameStoreCacheTest() :
+      rootPath_(getTempPath()),
+      cachePath_(rootPath_ / "game_detection_cache.json"),
+      heroicConfigPath_(rootPath_ / "heroic"),
+      egsManifestsPath_(rootPath_ / "Epic" / "Manifests") {}
+
+protected:
+  void SetUp() override {
+    std::filesystem::create_directories(heroicConfigPath_ / "gog_store");
+    std::filesystem::create_directories(egsManifestsPath_);
+
+    registry_.SetStringValue("Software\\Epic Games\\EpicGamesLauncher",
+                             egsManifestsPath_.parent_path().u8string());
+  }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  void writeEgsManifest(const std::string& filename,
+                        const std::string& appName) {
+    std::ofstream out(egsManifestsPath_ / filename);
+    out << "{\"AppName\": \"" + appName + "\", \"InstallLocation\": \"" +
+               boost::replace_all_copy(rootPath_.u8string(), "\\", "\\\\") +
+               "\"}";
+  }
+
+  StoreValidators getValidators(
+      const std::vector<std::string>& preferredUILanguages = {}) const {
+    return getStoreValidators(
+        registry_, {heroicConfigPath_}, preferredUILanguages);
+  }
+
+  std::filesystem::path rootPath_;
+  std::filesystem::path cachePath_;
+  std::filesystem::path heroicConfigPath_;
+  std::filesystem::path egsManifestsPath_;
+  TestRegistry registry_;
+};
+
+TEST_F(GameStoreCacheTest,
+       getStoreValidatorsShouldReturnTheSameValuesIfNothingHasChanged) {
+  const auto validators = getValidators();
+  const auto newValidators = getValidators();
+
+  EXPECT_FALSE(validators.steam.empty());
+  EXPECT_FALSE(validators.heroic.empty());
+  EXPECT_FALSE(validators.egs.empty());
+  EXPECT_EQ(validators.steam, newValidators.steam);
+  EXPECT_EQ(validators.heroic, newValidators.heroic);
+  EXPECT_EQ(validators.egs, newValidators.egs);
+}
+
+TEST_F(GameStoreCacheTest,
+       getStoreValidatorsShouldOnlyChangeTheHeroicValidatorIfHeroicChanges) {
+  const auto validators = getValidators();
+
+  std::ofstream out(heroicConfigPath_ / "gog_store" / "installed.json");
+  out << "{\"installed\": []}";
+  out.close();
+
+  const auto newValidators = getValidators();
+
+  EXPECT_EQ(validators.steam, newValidators.steam);
+  EXPECT_NE(validators.heroic, newValidators.heroic);
+  EXPECT_EQ(validators.egs, newValidators.egs);
+}
+
+TEST_F(GameStoreCacheTest,
+       getStoreValidatorsShouldChangeTheHeroicValidatorIfLanguagesChange) {
+  const auto validators = getValidators({"en"});
+  const auto newValidators = getValidators({"fr"});
+
+  EXPECT_NE(validators.heroic, newValidators.heroic);
+  EXPECT_EQ(validators.egs, newValidators.egs);
+}
+
+TEST_F(GameStoreCacheTest,
+       getStoreValidatorsShouldOnlyChangeTheEgsValidatorIfAManifestIsAdded) {
+  const auto validators = getValidators();
+
+  writeEgsManifest("manifest.item", "app");
+
+  const auto newValidators = getValidators();
+
+  EXPECT_EQ(validators.steam, newValidators.steam);
+  EXPECT_EQ(validators.heroic, newValidators.heroic);
+  EXPECT_NE(validators.egs, newValidators.egs);
+}
+
+#ifdef _WIN32
+TEST_F(GameStoreCacheTest,
+       getStoreValidatorsShouldOnlyChangeTheSteamValidatorIfALibraryChanges) {
+  const auto steamPath = rootPath_ / "Steam";
+  const auto libraryPath = rootPath_ / "Library";
+  std::filesystem::create_directories(steamPath / "config");
+  std::filesystem::create_directories(libraryPath / "steamapps");
+
+  registry_.SetStringValue("Software\\Valve\\Steam", steamPath.u8string());
+
+  std::ofstream vdf(steamPath / "config" / "libraryfolders.vdf");
+  vdf << "\"libraryfolders\"\n{\n\t\"0\"\n\t{\n\t\t\"path\"\t\t\""
+      << boost::replace_all_copy(libraryPath.u8string(), "\\", "\\\\")
+      << "\"\n\t}\n}\n";
+  vdf.close();
+
+  const auto validators = getValidators();
+
+  std::ofstream manifest(libraryPath / "steamapps" / "appmanifest_489830.acf");
+  manifest << "\"AppState\"\n{\n}\n";
+  manifest.close();
+
+  const auto newValidators = getValidators();
+
+  EXPECT_NE(validators.steam, newValidators.steam);
+  EXPECT_EQ(validators.heroic, newValidators.heroic);
+  EXPECT_EQ(validators.egs, newValidators.egs);
+}
+#endif
+
+TEST_F(GameStoreCacheTest,
+       readGameStoreCacheShouldReturnNulloptIfTheFileDoesNotExist) {
+  EXPECT_FALSE(readGameStoreCache(cachePath_).has_value());
+}
+
+TEST_F(GameStoreCacheTest,
+       readGameStoreCacheShouldReturnNulloptIfTheFileIsNotValidJson) {
+  std::ofstream out(cachePath_);
+  out << "{";
+  out.close();
+
+  EXPECT_FALSE(readGameStoreCache(cachePath_).has_value());
+}
+
+TEST_F(GameStoreCacheTest,
+       readGameStoreCacheShouldReturnNulloptIfWrittenByAnotherVersion) {
+  std::ofstream out(cachePath_);
+  out << "{\"version\": \"0.0.0\"}";
+  out.close();
+
+  EXPECT_FALSE(readGameStoreCache(cachePath_).has_value());
+}
+
+TEST_F(GameStoreCacheTest, readGameStoreCacheShouldReadAWrittenCache) {
+  GameStoreCache cache;
+  cache.validators = {"steam", "heroic", "egs"};
+  cache.installs.steam = {GameInstall{GameId::tes5se,
+                                      InstallSource::steam,
+                                      rootPath_ / "Skyrim Special Edition",
+                                      ""}};
+  cache.installs.heroic = {GameInstall{GameId::fo4,
+                                       InstallSource::gog,
+                                       rootPath_ / "Fallout 4",
+                                       rootPath_ / "local"}};
+  cache.installs.egsInstallLocations = {{"app", rootPath_ / "game"}};
+
+  writeGameStoreCache(cachePath_, cache);
+  const auto readCache = readGameStoreCache(cachePath_);
+
+  ASSERT_TRUE(readCache.has_value());
+  EXPECT_EQ("steam", readCache.value().validators.steam);
+  EXPECT_EQ("heroic", readCache.value().validators.heroic);
+  EXPECT_EQ("egs", readCache.value().validators.egs);
+
+  ASSERT_EQ(1, readCache.value().installs.steam.size());
+  EXPECT_EQ(GameId::tes5se, readCache.value().installs.steam[0].gameId);
+  EXPECT_EQ(InstallSource::steam, readCache.value().installs.steam[0].source);
+  EXPECT_EQ(rootPath_ / "Skyrim Special Edition",
+            readCache.value().installs.steam[0].installPath);
+  EXPECT_EQ("", readCache.value().installs.steam[0].localPath);
+
+  ASSERT_EQ(1, readCache.value().installs.heroic.size());
+  EXPECT_EQ(GameId::fo4, readCache.value().installs.heroic[0].gameId);
+  EXPECT_EQ(InstallSource::gog, readCache.value().installs.heroic[0].source);
+  EXPECT_EQ(rootPath_ / "Fallout 4",
+            readCache.value().installs.heroic[0].installPath);
+  EXPECT_EQ(rootPath_ / "local",
+            readCache.value().installs.heroic[0].localPath);
+
+  EXPECT_EQ(cache.installs.egsInstallLocations,
+            readCache.value().installs.egsInstallLocations);
+}
+
+TEST_F(GameStoreCacheTest,
+       updateGameStoreCacheShouldOnlyRescanStoresThatHaveChanged) {
+  GameStoreCache cache;
+
+  EXPECT_TRUE(
+      updateGameStoreCache(cache, registry_, {heroicConfigPath_}, {}));
+  EXPECT_TRUE(cache.installs.egsInstallLocations.empty());
+
+  EXPECT_FALSE(
+      updateGameStoreCache(cache, registry_, {heroicConfigPath_}, {}));
+
+  // Give the cache a result that wouldn't be found by a rescan, to check
+  // that unchanged stores aren't rescanned.
+  const GameInstall heroicInstall{
+      GameId::tes5se, InstallSource::gog, rootPath_, ""};
+  cache.installs.heroic = {heroicInstall};
+
+  writeEgsManifest("manifest.item", "app");
+
+  EXPECT_TRUE(
+      updateGameStoreCache(cache, registry_, {heroicConfigPath_}, {}));
+
+  ASSERT_EQ(1, cache.installs.egsInstallLocations.size());
+  EXPECT_EQ(rootPath_, cache.installs.egsInstallLocations.at("app"));
+  ASSERT_EQ(1, cache.installs.heroic.size());
+  EXPECT_EQ(heroicInstall.installPath, cache.installs.heroic[0].installPath);
+}
+}
+
+#endif
@@ -179,6 +179,32 @@ protected:
     return loadOrder;
   }
 
+  std::filesystem::path getSortCachePath(const Game& game) {
+    return lootDataPath / std::filesystem::u8path("games") /
+           std::filesystem::u8path(game.getSettings().getFolderName()) /
+           "sort_cache.json";
+  }
+
+  // Replace the cached sort result with the given load order, keeping the
+  // cached fingerprint.
+  void overwriteCachedSortResult(const Game& game,
+                                 const std::vector<std::string>& loadOrder) {
+    const auto cachePath = getSortCachePath(game);
+    auto file = QFile(QString::fromStdString(cachePath.u8string()));
+
+    file.open(QIODevice::ReadOnly | QIODevice::Text);
+    const auto content = file.readAll();
+    file.close();
+
+    const auto fingerprint = QJsonDocument::fromJson(content)
+                                 .object()
+                                 .value("fingerprint")
+                                 .toString()
+                                 .toStdString();
+
+    writeCachedSortResult(cachePath, fingerprint, loadOrder);
+  }
+
   uint32_t getBlankEsmCrc() const {
     switch (GetParam()) {
       case GameId::tes3:
@@ -1172,6 +1198,103 @@ TEST_P(
   EXPECT_EQ(0, index.value());
 }
 
+TEST_P(GameTest, getSnapshotShouldReturnAnEmptySnapshotBeforeInit) {
+  Game game(defaultGameSettings, lootDataPath, "");
+
+  const auto snapshot = game.getSnapshot();
+
+  ASSERT_NE(nullptr, snapshot);
+  EXPECT_TRUE(snapshot->loadOrder.empty());
+  EXPECT_EQ(0, snapshot->loadedPluginCount);
+}
+
+TEST_P(GameTest, loadAllInstalledPluginsShouldPublishASnapshot) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  const auto snapshot = game.getSnapshot();
+
+  EXPECT_EQ(game.getLoadOrder(), snapshot->loadOrder);
+  EXPECT_EQ(game.getPlugins().size(), snapshot->loadedPluginCount);
+  EXPECT_EQ(game.isLoadOrderAmbiguous(), snapshot->isLoadOrderAmbiguous);
+  EXPECT_EQ(game.supportsLightPlugins(), snapshot->supportsLightPlugins);
+}
+
+TEST_P(GameTest, setLoadOrderShouldPublishASnapshotWithTheNewLoadOrder) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  const auto oldSnapshot = game.getSnapshot();
+
+  game.setLoadOrder(loadOrderToSet_);
+
+  EXPECT_EQ(game.getLoadOrder(), game.getSnapshot()->loadOrder);
+  EXPECT_NE(oldSnapshot, game.getSnapshot());
+}
+
+TEST_P(GameTest, setUserGroupsShouldPublishASnapshotWithTheNewGroups) {
+  Game game = createInitialisedGame();
+
+  game.setUserGroups({Group("group1")});
+
+  const auto snapshot = game.getSnapshot();
+  EXPECT_NE(snapshot->groupNames.end(),
+            std::find(snapshot->groupNames.begin(),
+                      snapshot->groupNames.end(),
+                      "group1"));
+
+  ASSERT_EQ(1, snapshot->userGroups.size());
+  EXPECT_EQ("group1", snapshot->userGroups[0].GetName());
+  EXPECT_EQ(game.getMasterlistGroups().size(),
+            snapshot->masterlistGroups.size());
+}
+
+TEST_P(GameTest, mapFromLoadOrderDataShouldThrowIfTheTokenIsCancelled) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  const std::function<std::optional<short>(
+      std::shared_ptr<const PluginInterface>, std::optional<short>, bool)>
+      mapper = [](std::shared_ptr<const PluginInterface>,
+                  std::optional<short> loadOrderIndex,
+                  bool) { return loadOrderIndex; };
+
+  CancellationToken token;
+  token.cancel();
+
+  EXPECT_THROW(
+      mapFromLoadOrderData(game, game.getLoadOrder(), mapper, token),
+      OperationCancelledError);
+}
+
+TEST_P(GameTest, mapFromLoadOrderDataShouldReportProgressUpToTheTotal) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  const std::function<std::optional<short>(
+      std::shared_ptr<const PluginInterface>, std::optional<short>, bool)>
+      mapper = [](std::shared_ptr<const PluginInterface>,
+                  std::optional<short> loadOrderIndex,
+                  bool) { return loadOrderIndex; };
+
+  std::mutex mutex;
+  size_t maxCompleted = 0;
+  size_t reportedTotal = 0;
+  const auto sendProgressUpdate = [&](size_t completed, size_t total) {
+    std::lock_guard<std::mutex> guard(mutex);
+    maxCompleted = std::max(maxCompleted, completed);
+    reportedTotal = total;
+  };
+
+  const auto loadOrder = game.getLoadOrder();
+  const auto indexes = mapFromLoadOrderData(
+      game, loadOrder, mapper, CancellationToken(), sendProgressUpdate);
+
+  ASSERT_FALSE(indexes.empty());
+  EXPECT_EQ(indexes.size(), reportedTotal);
+  EXPECT_EQ(indexes.size(), maxCompleted);
+}
+
 TEST_P(GameTest, setLoadOrderWithoutLoadedPluginsShouldIgnoreCurrentState) {
   using std::filesystem::u8path;
   Game game = createInitialisedGame();
@@ -1282,6 +1405,43 @@ TEST_P(GameTest, sortPluginsShouldSupportPluginsAtExternalPaths) {
             loadOrder);
 }
 
+TEST_P(GameTest, sortPluginsShouldCacheTheSortedLoadOrder) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  const auto loadOrder = game.sortPlugins();
+
+  EXPECT_EQ(loadOrder, readBackedUpLoadOrder(getSortCachePath(game)));
+}
+
+TEST_P(GameTest, sortPluginsShouldReuseTheCachedResultIfNothingHasChanged) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  auto loadOrder = game.sortPlugins();
+  std::reverse(loadOrder.begin(), loadOrder.end());
+  overwriteCachedSortResult(game, loadOrder);
+
+  EXPECT_EQ(loadOrder, game.sortPlugins());
+}
+
+TEST_P(GameTest,
+       sortPluginsShouldNotReuseTheCachedResultIfAPluginHasBeenModified) {
+  Game game = createInitialisedGame();
+  game.loadAllInstalledPlugins(true);
+
+  auto loadOrder = game.sortPlugins();
+  std::reverse(loadOrder.begin(), loadOrder.end());
+  overwriteCachedSortResult(game, loadOrder);
+
+  const auto pluginPath = dataPath / BLANK_DIFFERENT_ESP;
+  std::filesystem::last_write_time(
+      pluginPath,
+      std::filesystem::last_write_time(pluginPath) + std::chrono::seconds(1));
+
+  EXPECT_NE(loadOrder, game.sortPlugins());
+}
+
 TEST_P(GameTest,
        incrementLoadOrderSortCountShouldSupressTheDefaultCachedMessage) {
   Game game = createInitialisedGame();
@@ -179,6 +179,25 @@ TEST(
             manager.getCurrentGame().getSettings().getMasterlistSource());
 }
 
+TEST(GamesManager, setInstalledGamesShouldKeepTheCurrentGameObject) {
+  TestGamesManager manager;
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  manager.setCurrentGame(TEST_GAMES_SETTINGS[1].getFolderName());
+  const auto currentGame = &manager.getCurrentGame();
+
+  manager.setInstalledGames(TEST_GAMES_SETTINGS);
+
+  EXPECT_EQ(currentGame, &manager.getCurrentGame());
+
+  manager.setInstalledGames(
+      {createSettings(GameId::tes5).setGamePath("different")});
+
+  EXPECT_EQ(currentGame, &manager.getCurrentGame());
+  EXPECT_EQ(std::filesystem::path("different"),
+            manager.getCurrentGame().getSettings().getGamePath());
+}
+
 TEST(GamesManager, getCurrentGameShouldThrowIfNoGamesAreInstalled) {
   TestGamesManager manager;
   EXPECT_THROW(manager.getCurrentGame(), std::runtime_error);
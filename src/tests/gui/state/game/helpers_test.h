@@ -27,7 +27,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
+#include <thread>
 
 #include "gui/state/game/helpers.h"
 #include "tests/common_game_test_fixture.h"
@@ -166,6 +169,378 @@ TEST(GetTagConflicts,
   EXPECT_EQ(expectedConflicts, conflicts);
 }
 
+TEST(CachedSortResult, shouldBeReadIfTheFingerprintMatches) {
+  const auto cachePath = getTempPath() / "sort_cache.json";
+  const std::vector<std::string> loadOrder{"Blank.esm", "Blank.esp"};
+
+  writeCachedSortResult(cachePath, "abc", loadOrder);
+
+  EXPECT_EQ(loadOrder, readCachedSortResult(cachePath, "abc"));
+
+  std::filesystem::remove_all(cachePath.parent_path());
+}
+
+TEST(CachedSortResult, shouldNotBeReadIfTheFingerprintDoesNotMatch) {
+  const auto cachePath = getTempPath() / "sort_cache.json";
+
+  writeCachedSortResult(cachePath, "abc", {"Blank.esm", "Blank.esp"});
+
+  EXPECT_FALSE(readCachedSortResult(cachePath, "abd").has_value());
+
+  std::filesystem::remove_all(cachePath.parent_path());
+}
+
+TEST(CachedSortResult, shouldNotBeReadIfItIsEmpty) {
+  const auto cachePath = getTempPath() / "sort_cache.json";
+
+  writeCachedSortResult(cachePath, "abc", {});
+
+  EXPECT_FALSE(readCachedSortResult(cachePath, "abc").has_value());
+
+  std::filesystem::remove_all(cachePath.parent_path());
+}
+
+TEST(CachedSortResult, shouldNotBeReadIfTheFileDoesNotExist) {
+  EXPECT_FALSE(
+      readCachedSortResult(std::filesystem::temp_directory_path() / "missing",
+                           "abc")
+          .has_value());
+}
+
+class LoadOrderBackupIndexTest : public ::testing::Test {
+protected:
+  LoadOrderBackupIndexTest() : backupsPath(getTempPath() / "backups") {}
+
+  void TearDown() override {
+    std::filesystem::remove_all(backupsPath.parent_path());
+  }
+
+  std::filesystem::path getIndexPath() const {
+    return backupsPath / "index.json";
+  }
+
+  const std::filesystem::path backupsPath;
+  const std::vector<std::string> loadOrder{"Blank.esm", "Blank.esp"};
+};
+
+TEST_F(LoadOrderBackupIndexTest, backupLoadOrderShouldCreateTheIndex) {
+  backupLoadOrder(loadOrder, backupsPath, "test");
+
+  EXPECT_TRUE(std::filesystem::exists(getIndexPath()));
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       findLoadOrderBackupsShouldReturnBackupsWithoutTheirLoadOrders) {
+  backupLoadOrder(loadOrder, backupsPath, "test");
+
+  const auto backups = findLoadOrderBackups(backupsPath);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("test", backups[0].name);
+  EXPECT_FALSE(backups[0].autoDelete);
+  EXPECT_EQ(loadOrder.size(), backups[0].pluginCount);
+  EXPECT_TRUE(backups[0].loadOrder.empty());
+  EXPECT_EQ(loadOrder, readLoadOrderBackup(backups[0].path));
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       findLoadOrderBackupsShouldRebuildTheIndexIfItIsMissing) {
+  backupLoadOrder(loadOrder, backupsPath, "test");
+  std::filesystem::remove(getIndexPath());
+
+  const auto backups = findLoadOrderBackups(backupsPath);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("test", backups[0].name);
+  EXPECT_EQ(loadOrder.size(), backups[0].pluginCount);
+  EXPECT_TRUE(std::filesystem::exists(getIndexPath()));
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       findLoadOrderBackupsShouldSkipIndexedBackupsThatNoLongerExist) {
+  backupLoadOrder(loadOrder, backupsPath, "test");
+
+  const auto backups = findLoadOrderBackups(backupsPath);
+  ASSERT_EQ(1, backups.size());
+  std::filesystem::remove(backups[0].path);
+
+  EXPECT_TRUE(findLoadOrderBackups(backupsPath).empty());
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       backupLoadOrderShouldOnlyKeepTheTenNewestAutomaticBackups) {
+  for (int i = 0; i < 12; i += 1) {
+    backupLoadOrder(loadOrder, backupsPath);
+    // Backup filenames have millisecond resolution.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  }
+  backupLoadOrder(loadOrder, backupsPath, "test");
+
+  const auto backups = findLoadOrderBackups(backupsPath);
+
+  size_t fileCount = 0;
+  for (const auto& entry : std::filesystem::directory_iterator(backupsPath)) {
+    if ((entry.path().extension() == ".json" ||
+         entry.path().extension() == ".delta") &&
+        entry.path().filename() != "index.json") {
+      fileCount += 1;
+    }
+  }
+
+  EXPECT_EQ(11, backups.size());
+  EXPECT_EQ(11, fileCount);
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       deleteLoadOrderBackupShouldRemoveTheBackupFileAndItsIndexEntry) {
+  backupLoadOrder(loadOrder, backupsPath, "test1");
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  backupLoadOrder(loadOrder, backupsPath, "test2");
+
+  auto backups = findLoadOrderBackups(backupsPath);
+  ASSERT_EQ(2, backups.size());
+
+  deleteLoadOrderBackup(backups[0].path);
+
+  EXPECT_FALSE(std::filesystem::exists(backups[0].path));
+
+  backups = findLoadOrderBackups(backupsPath);
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ("test2", backups[0].name);
+}
+
+TEST_F(LoadOrderBackupIndexTest,
+       readLoadOrderBackupShouldThrowIfTheFileIsNotABackup) {
+  EXPECT_THROW(readLoadOrderBackup(backupsPath / "index.json"),
+               std::runtime_error);
+}
+
+class DeltaLoadOrderBackupTest : public LoadOrderBackupIndexTest {
+protected:
+  std::vector<std::string> getLargeLoadOrder(size_t size) const {
+    std::vector<std::string> plugins;
+    for (size_t i = 0; i < size; i += 1) {
+      plugins.push_back("Plugin" + std::to_string(i) + ".esp");
+    }
+    return plugins;
+  }
+
+  void backup(const std::vector<std::string>& plugins) {
+    // Backup filenames have millisecond resolution.
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    backupLoadOrder(plugins, backupsPath);
+  }
+
+  // Backups may be rewritten when other backups are added or removed, so
+  // they need to be found again afterwards.
+  std::vector<LoadOrderBackup> findSortedBackups() const {
+    auto backups = findLoadOrderBackups(backupsPath);
+    std::sort(backups.begin(),
+              backups.end(),
+              [](const LoadOrderBackup& lhs, const LoadOrderBackup& rhs) {
+                return lhs.unixTimestampMs < rhs.unixTimestampMs;
+              });
+    return backups;
+  }
+};
+
+TEST_F(DeltaLoadOrderBackupTest,
+       backupLoadOrderShouldStoreThePreviousBackupAsADeltaAgainstTheNewOne) {
+  auto plugins = getLargeLoadOrder(100);
+  const auto firstPlugins = plugins;
+  backup(plugins);
+
+  std::rotate(plugins.begin() + 10, plugins.begin() + 11, plugins.begin() + 50);
+  plugins.erase(plugins.begin() + 70);
+  plugins.push_back("New.esp");
+  backup(plugins);
+
+  const auto backups = findSortedBackups();
+  ASSERT_EQ(2, backups.size());
+
+  EXPECT_EQ(backups[1].path, backups[0].basePath);
+  EXPECT_TRUE(backups[1].basePath.empty());
+  EXPECT_EQ(firstPlugins.size(), backups[0].pluginCount);
+  EXPECT_EQ(firstPlugins, readLoadOrderBackup(backups[0].path));
+  EXPECT_EQ(plugins, readLoadOrderBackup(backups[1].path));
+  EXPECT_LT(std::filesystem::file_size(backups[0].path),
+            std::filesystem::file_size(backups[1].path));
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       deltasShouldNotUseTheFileExtensionOfFullSnapshots) {
+  auto plugins = getLargeLoadOrder(100);
+  backup(plugins);
+
+  std::swap(plugins[0], plugins[1]);
+  backup(plugins);
+
+  const auto backups = findSortedBackups();
+  ASSERT_EQ(2, backups.size());
+
+  EXPECT_EQ(".delta", backups[0].path.extension());
+  EXPECT_EQ(".json", backups[1].path.extension());
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       backupLoadOrderShouldPeriodicallyKeepAFullSnapshot) {
+  auto plugins = getLargeLoadOrder(100);
+
+  std::vector<std::vector<std::string>> loadOrders;
+  for (size_t i = 0; i < 6; i += 1) {
+    std::swap(plugins[i], plugins[i + 1]);
+    loadOrders.push_back(plugins);
+    backup(plugins);
+  }
+
+  const auto backups = findSortedBackups();
+  ASSERT_EQ(6, backups.size());
+
+  for (size_t i = 0; i < 4; i += 1) {
+    EXPECT_FALSE(backups[i].basePath.empty());
+  }
+  EXPECT_TRUE(backups[4].basePath.empty());
+  EXPECT_TRUE(backups[5].basePath.empty());
+
+  for (size_t i = 0; i < backups.size(); i += 1) {
+    EXPECT_EQ(loadOrders[i], readLoadOrderBackup(backups[i].path));
+  }
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       backupLoadOrderShouldKeepThePreviousBackupIfALargeChangeIsMade) {
+  auto plugins = getLargeLoadOrder(100);
+  const auto firstPlugins = plugins;
+  backup(plugins);
+
+  std::reverse(plugins.begin(), plugins.end());
+  backup(plugins);
+
+  const auto backups = findSortedBackups();
+  ASSERT_EQ(2, backups.size());
+
+  EXPECT_TRUE(backups[0].basePath.empty());
+  EXPECT_TRUE(backups[1].basePath.empty());
+  EXPECT_EQ(firstPlugins, readLoadOrderBackup(backups[0].path));
+  EXPECT_EQ(plugins, readLoadOrderBackup(backups[1].path));
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       removingABackupShouldKeepBackupsBasedOnItRestorable) {
+  auto plugins = getLargeLoadOrder(100);
+  const auto firstPlugins = plugins;
+  backup(plugins);
+
+  std::swap(plugins[0], plugins[1]);
+  backup(plugins);
+
+  auto backups = findSortedBackups();
+  ASSERT_EQ(2, backups.size());
+  ASSERT_EQ(backups[1].path, backups[0].basePath);
+
+  deleteLoadOrderBackup(backups[1].path);
+
+  backups = findSortedBackups();
+  ASSERT_EQ(1, backups.size());
+  EXPECT_TRUE(backups[0].basePath.empty());
+  EXPECT_EQ(".json", backups[0].path.extension());
+  EXPECT_EQ(firstPlugins, readLoadOrderBackup(backups[0].path));
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       removingABackupShouldKeepItIfABackupBasedOnItCannotBeRewritten) {
+  auto plugins = getLargeLoadOrder(100);
+  backup(plugins);
+
+  std::swap(plugins[0], plugins[1]);
+  backup(plugins);
+
+  auto backups = findSortedBackups();
+  ASSERT_EQ(2, backups.size());
+  ASSERT_EQ(backups[1].path, backups[0].basePath);
+
+  std::ofstream out(backups[0].path);
+  out << "invalid";
+  out.close();
+
+  EXPECT_THROW(deleteLoadOrderBackup(backups[1].path), std::runtime_error);
+
+  EXPECT_TRUE(std::filesystem::exists(backups[1].path));
+
+  const auto remainingBackups = findSortedBackups();
+  ASSERT_EQ(2, remainingBackups.size());
+  EXPECT_EQ(backups[1].path, remainingBackups[0].basePath);
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       pruningOldBackupsShouldKeepAllRemainingBackupsRestorable) {
+  auto plugins = getLargeLoadOrder(100);
+
+  std::vector<std::vector<std::string>> loadOrders;
+  for (size_t i = 0; i < 15; i += 1) {
+    std::swap(plugins[i], plugins[i + 1]);
+    loadOrders.push_back(plugins);
+    backup(plugins);
+  }
+
+  const auto backups = findSortedBackups();
+
+  ASSERT_EQ(10, backups.size());
+  for (size_t i = 0; i < backups.size(); i += 1) {
+    EXPECT_EQ(loadOrders[i + 5], readLoadOrderBackup(backups[i].path));
+  }
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       pruningOldBackupsShouldNotRewriteTheRemainingBackupsAsFullSnapshots) {
+  auto plugins = getLargeLoadOrder(100);
+
+  for (size_t i = 0; i < 12; i += 1) {
+    std::swap(plugins[i], plugins[i + 1]);
+    backup(plugins);
+  }
+
+  const auto backups = findSortedBackups();
+  ASSERT_EQ(10, backups.size());
+
+  // Every fifth backup is kept as a full snapshot, and the newest backup is
+  // always one.
+  size_t snapshotCount = 0;
+  for (const auto& backup : backups) {
+    if (backup.basePath.empty()) {
+      snapshotCount += 1;
+    }
+  }
+
+  EXPECT_EQ(3, snapshotCount);
+}
+
+TEST_F(DeltaLoadOrderBackupTest,
+       readLoadOrderBackupShouldReadTheFormatWrittenByOlderVersions) {
+  std::filesystem::create_directories(backupsPath);
+  const auto path = backupsPath / "loadorder.1700000000000.json";
+
+  std::ofstream out(path);
+  out << R"({
+    "autoDelete": true,
+    "creationTimestamp": "2023-11-14T22:13:20.000Z",
+    "loadOrder": [
+        "Blank.esm",
+        "Blank.esp"
+    ],
+    "name": "Automatic Load Order Backup"
+})";
+  out.close();
+
+  const auto backups = findLoadOrderBackups(backupsPath);
+
+  ASSERT_EQ(1, backups.size());
+  EXPECT_EQ(1700000000000, backups[0].unixTimestampMs);
+  EXPECT_EQ(2, backups[0].pluginCount);
+  EXPECT_TRUE(backups[0].basePath.empty());
+  EXPECT_EQ(loadOrder, readLoadOrderBackup(path));
+}
+
 class ResolveGameFilePathTest : public CommonGameTestFixture,
                                 public ::testing::WithParamInterface<GameId> {
 protected:
@@ -0,0 +1,164 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2012 WrinklyNinja
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+    */
+
+#ifndef LOOT_TESTS_GUI_STATE_GAME_USERLIST_WRITER_TEST
+#define LOOT_TESTS_GUI_STATE_GAME_USERLIST_WRITER_TEST
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "gui/state/game/userlist_writer.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class UserlistWriterTest : public ::testing::Test {
+protected:
+  UserlistWriterTest() :
+      rootPath_(getTempPath()), userlistPath_(rootPath_ / "userlist.yaml") {}
+
+  void SetUp() override { std::filesystem::create_directories(rootPath_); }
+
+  void TearDown() override { std::filesystem::remove_all(rootPath_); }
+
+  std::string readUserlist() {
+    std::ifstream in(userlistPath_);
+    return std::string(std::istreambuf_iterator<char>(in),
+                       std::istreambuf_iterator<char>());
+  }
+
+  void writeUserlist(const std::string& content) {
+    std::ofstream out(userlistPath_);
+    out << content;
+  }
+
+  std::filesystem::path rootPath_;
+  std::filesystem::path userlistPath_;
+};
+
+TEST_F(UserlistWriterTest, flushShouldDoNothingIfNoWritesHaveBeenRequested) {
+  UserlistWriter writer(userlistPath_);
+
+  writer.flush();
+
+  EXPECT_FALSE(std::filesystem::exists(userlistPath_));
+}
+
+TEST_F(UserlistWriterTest, flushShouldWaitForRequestedWritesToComplete) {
+  UserlistWriter writer(userlistPath_, std::chrono::hours(1));
+
+  writer.requestWrite("content");
+  writer.flush();
+
+  EXPECT_EQ("content", readUserlist());
+}
+
+TEST_F(UserlistWriterTest,
+       writesRequestedInQuickSuccessionShouldWriteTheLastContent) {
+  UserlistWriter writer(userlistPath_, std::chrono::hours(1));
+
+  writer.requestWrite("content 1");
+  writer.requestWrite("content 2");
+  writer.requestWrite("content 3");
+  writer.flush();
+
+  EXPECT_EQ("content 3", readUserlist());
+}
+
+TEST_F(UserlistWriterTest, destructorShouldCompletePendingWrites) {
+  {
+    UserlistWriter writer(userlistPath_, std::chrono::hours(1));
+
+    writer.requestWrite("content");
+  }
+
+  EXPECT_EQ("content", readUserlist());
+}
+
+TEST_F(UserlistWriterTest, writeShouldReplaceTheUserlistViaATemporaryFile) {
+  writeUserlist("old content");
+
+  UserlistWriter writer(userlistPath_);
+
+  writer.requestWrite("new content");
+  writer.flush();
+
+  auto tempPath = userlistPath_;
+  tempPath += ".tmp";
+
+  EXPECT_FALSE(std::filesystem::exists(tempPath));
+  EXPECT_EQ("new content", readUserlist());
+}
+
+TEST_F(UserlistWriterTest, aFailedWriteShouldBeReportedToTheErrorHandler) {
+  const auto missingDirectoryPath = rootPath_ / "missing" / "userlist.yaml";
+  std::vector<std::string> errors;
+
+  UserlistWriter writer(missingDirectoryPath);
+  writer.setErrorHandler(
+      [&](const std::string& error) { errors.push_back(error); });
+
+  writer.requestWrite("content");
+  writer.flush();
+
+  EXPECT_EQ(1, errors.size());
+  EXPECT_FALSE(std::filesystem::exists(missingDirectoryPath));
+}
+
+TEST_F(UserlistWriterTest,
+       aWriteThatFailsWhileDestroyingTheWriterShouldBeReported) {
+  std::vector<std::string> errors;
+
+  {
+    UserlistWriter writer(rootPath_ / "missing" / "userlist.yaml",
+                          std::chrono::hours(1));
+    writer.setErrorHandler(
+        [&](const std::string& error) { errors.push_back(error); });
+
+    writer.requestWrite("content");
+  }
+
+  EXPECT_EQ(1, errors.size());
+}
+
+TEST_F(UserlistWriterTest, aSuccessfulWriteShouldNotBeReportedAsAnError) {
+  std::vector<std::string> errors;
+
+  UserlistWriter writer(userlistPath_);
+  writer.setErrorHandler(
+      [&](const std::string& error) { errors.push_back(error); });
+
+  writer.requestWrite("content");
+  writer.flush();
+
+  EXPECT_TRUE(errors.empty());
+}
+}
+}
+
+#endif
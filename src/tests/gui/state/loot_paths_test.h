@@ -77,6 +77,13 @@ TEST(LootPaths, getPreludePathShouldUseLootDataPath) {
             paths.getPreludePath());
 }
 
+TEST(LootPaths, getGameDetectionCachePathShouldUseLootDataPath) {
+  LootPaths paths("", "");
+
+  EXPECT_EQ(paths.getLootDataPath() / "game_detection_cache.json",
+            paths.getGameDetectionCachePath());
+}
+
 #ifdef _WIN32
 TEST(LootPaths,
      constructorShouldSetAppPathToExecutableDirectoryIfGivenPathIsEmpty) {
@@ -0,0 +1,172 @@
+/*  LOOT
+
+    A load order optimisation tool for
+    Morrowind, Oblivion, Skyrim, Skyrim Special Edition, Skyrim VR,
+    Fallout 3, Fallout: New Vegas, Fallout 4 and Fallout 4 VR.
+
+    Copyright (C) 2026    Oliver Hamlet
+
+    This file is part of LOOT.
+
+    LOOT is free software: you can redistribute
+    it and/or modify it under the terms of the GNU General Public License
+    as published by the Free Software Foundation, either version 3 of
+    the License, or (at your option) any later version.
+
+    LOOT is distributed in the hope that it will
+    be useful, but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with LOOT.  If not, see
+    <https://www.gnu.org/licenses/>.
+*/
+
+#ifndef LOOT_TESTS_GUI_STATE_TRACING_TEST
+#define LOOT_TESTS_GUI_STATE_TRACING_TEST
+
+#include <gtest/gtest.h>
+
+#include <QtCore/QFile>
+#include <QtCore/QJsonArray>
+#include <QtCore/QJsonDocument>
+#include <QtCore/QJsonObject>
+#include <thread>
+
+#include "gui/state/tracing.h"
+#include "tests/gui/test_helpers.h"
+
+namespace loot {
+namespace test {
+class TracingTest : public ::testing::Test {
+protected:
+  TracingTest() : traceFilePath(getTempPath() / "trace.json") {}
+
+  void SetUp() override {
+    std::filesystem::create_directories(traceFilePath.parent_path());
+  }
+
+  void TearDown() override {
+    // Tracing is global state, so don't leak it into other tests.
+    disableTracing();
+
+    std::filesystem::remove_all(traceFilePath.parent_path());
+  }
+
+  QJsonArray readTraceEvents() const {
+    QFile file(QString::fromStdString(traceFilePath.u8string()));
+    file.open(QIODevice::ReadOnly);
+
+    return QJsonDocument::fromJson(file.readAll())
+        .object()
+        .value("traceEvents")
+        .toArray();
+  }
+
+  std::vector<QJsonObject> findEvents(const QJsonArray& events,
+                                      const QString& name) const {
+    std::vector<QJsonObject> found;
+    for (const auto& event : events) {
+      if (event.toObject().value("name").toString() == name) {
+        found.push_back(event.toObject());
+      }
+    }
+
+    return found;
+  }
+
+  std::filesystem::path traceFilePath;
+};
+
+TEST_F(TracingTest, enableTracingShouldEnableTracing) {
+  enableTracing();
+
+  EXPECT_TRUE(isTracingEnabled());
+}
+
+TEST_F(TracingTest, disableTracingShouldDisableTracingAndDiscardSpans) {
+  enableTracing();
+
+  { TraceSpan span("TracingTest::discardedSpan"); }
+
+  disableTracing();
+
+  EXPECT_FALSE(isTracingEnabled());
+
+  { TraceSpan span("TracingTest::disabledSpan"); }
+
+  writeTraceFile(traceFilePath);
+
+  EXPECT_TRUE(readTraceEvents().isEmpty());
+}
+
+TEST_F(TracingTest, writeTraceFileShouldWriteCompletedSpansAsCompleteEvents) {
+  enableTracing();
+
+  { TraceSpan span("TracingTest::span"); }
+
+  writeTraceFile(traceFilePath);
+
+  const auto events = findEvents(readTraceEvents(), "TracingTest::span");
+
+  ASSERT_EQ(1, events.size());
+  EXPECT_EQ("X", events[0].value("ph").toString());
+  EXPECT_TRUE(events[0].value("ts").isDouble());
+  EXPECT_LE(0, events[0].value("dur").toDouble());
+}
+
+TEST_F(TracingTest, writeTraceFileShouldNotWriteSpansThatHaveNotEnded) {
+  enableTracing();
+
+  TraceSpan span("TracingTest::unfinishedSpan");
+
+  writeTraceFile(traceFilePath);
+
+  EXPECT_TRUE(
+      findEvents(readTraceEvents(), "TracingTest::unfinishedSpan").empty());
+}
+
+TEST_F(TracingTest, spansOnDifferentThreadsShouldHaveDifferentThreadIds) {
+  enableTracing();
+
+  { TraceSpan span("TracingTest::threadSpan"); }
+  std::thread([]() { TraceSpan span("TracingTest::threadSpan"); }).join();
+
+  writeTraceFile(traceFilePath);
+
+  const auto events = findEvents(readTraceEvents(), "TracingTest::threadSpan");
+
+  ASSERT_EQ(2, events.size());
+  EXPECT_NE(events[0].value("tid").toInt(), events[1].value("tid").toInt());
+}
+
+TEST_F(TracingTest,
+       markStartupMilestoneShouldOnlyRecordTheFirstTimeItIsReached) {
+  startStartupTimeline();
+
+  const auto elapsed = markStartupMilestone("TracingTest::onceMilestone");
+
+  ASSERT_TRUE(elapsed.has_value());
+  EXPECT_LE(0, elapsed.value().count());
+  EXPECT_FALSE(markStartupMilestone("TracingTest::onceMilestone").has_value());
+}
+
+TEST_F(TracingTest, markStartupMilestoneShouldRecordASpanIfTracingIsEnabled) {
+  enableTracing();
+  startStartupTimeline();
+
+  markStartupMilestone("TracingTest::spanMilestone");
+
+  writeTraceFile(traceFilePath);
+
+  const auto events =
+      findEvents(readTraceEvents(), "TracingTest::spanMilestone");
+
+  ASSERT_EQ(1, events.size());
+  EXPECT_EQ("X", events[0].value("ph").toString());
+}
+}
+}
+
+#endif